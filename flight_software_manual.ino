@@ -12,8 +12,28 @@
     #ifndef HAB_Actuator_h
         #include <HAB_Actuator.h>
     #endif
+    #include <HAB_BME280.h>
+    #include <HAB_Burst.h>
+    #include <HAB_Calibration.h>
     #include <HAB_Camera.h>
+    #include <HAB_CaptureQueue.h>
+    #include <HAB_Downlink.h>
+    #include <HAB_Fixed.h>
     #include <HAB_GPS.h>
+    #include <HAB_History.h>
+    #include <HAB_Landing.h>
+    #include <HAB_Link.h>
+    #include <HAB_Motion.h>
+    #include <HAB_Outbox.h>
+    #include <HAB_Parse.h>
+    #include <HAB_Phase.h>
+    #include <HAB_PodDriver.h>
+    #include <HAB_Power.h>
+    #include <HAB_Sequencer.h>
+    #include <HAB_Sleep.h>
+    #include <HAB_Startup.h>
+    #include <HAB_Stats.h>
+    #include <HAB_Telemetry.h>
     #ifndef HAB_Logging_h
         #include <HAB_Logging.h>
     #endif
@@ -25,8 +45,6 @@
     //SPI and Sensor Libraries (BME uses I2C)
     #include <Wire.h>
     #include <SPI.h>
-    #include <Adafruit_Sensor.h>
-    #include <Adafruit_BME280.h>
 
     //Mission Specific Library. Struct definitions and Constants are in this library
     #ifndef HAB_Structs_h
@@ -35,6 +53,9 @@
 
     //This one MUST be included LAST in order to override any redeclared definitions
     #include <HAB_Definitions.h>
+
+    //After the definitions, which turn PROFILING on for a bench build
+    #include <HAB_Profile.h>
     
 
 //---------------------------------------------------------------------------------------------\
@@ -43,7 +64,7 @@
 
 
     //Don't really need prototypes section otherwise...
-    void sendGSmessage(const char* msg, bool ignoreConn = false);
+    void sendGSmessage(const char* msg, MessagePriority priority = MSG_INFO, bool ignoreConn = false);
 
 
 //---------------------------------------------------------------------------------------------\
@@ -57,13 +78,17 @@
     //Used for formatting our messages
     char msgPtr[100]; 
     
-    //Is the HAB descending? Control via command
-    bool isDescending = false;
+    //Mission phase, it sets the rates of the work in the loop. Moved on by the climb rate, or by command.
+    HAB_Phase* _phase;
+    unsigned long lastBeaconTime = 0;
+
+    //Brings the subsystems up together, and follows up those the flight started without
+    HAB_Startup* _startup;
 
     //----------------------------------------------------------\
     //Sensors and camera----------------------------------------|
-        //The interface of the BME sensor should be I2C
-        Adafruit_BME280 _bme;
+        //The interface of the BME sensor should be I2C, it runs in forced mode and is collected without waiting
+        HAB_BME280 _bme;
         BMEReadings _BMEreadings;
         bool BMPstatus = false;
         
@@ -74,16 +99,46 @@
         bool HAB_GPS_enabled = true;
         bool CSA_GPS_enabled = true;
 
+        //Climb rate from the HAB GPS altitude, smoothed over a few readings (negative descending)
+        CentimetresPerSecond _climbRate;
+        Centimetres lastClimbAltitude;
+        unsigned long lastClimbTime = 0;
+
+        //Landing point predicted from the winds met on the way up
+        HAB_Landing* _landing;
+
         //Camera object, image name
         HAB_Camera* _cam;
         char imgNamePtr[30];
+
+        //Capture queue, takes pod, altitude, time-lapse and command captures in turn
+        HAB_CaptureQueue* _captureQueue;
+
+        //Image downlink, sends thumbnails to the ground as they are written
+        HAB_Downlink* _downlink;
+        bool autoDownlink = true;
+        uint16_t lastWrittenCount = 0;
         
-        //Heating temperatures
-        float minTemp = MIN_ACTUATOR_TEMP;
-        float maxTemp = MAX_ACTUATOR_TEMP;
+        //Heating temperatures, the heaters hold the middle of the band
+        CentiCelsius minTemp = fromCelsius(MIN_ACTUATOR_TEMP);
+        CentiCelsius maxTemp = fromCelsius(MAX_ACTUATOR_TEMP);
         
         //Readings timing
         unsigned long lastReadingsTime = 0;  
+        unsigned long lastSampleTime = 0;
+
+        //Per-minute statistics of each sensor, sampled at the phase's sample rate. Channel order matches sampleSensors.
+        HAB_Stats* _stats;
+        const char* const statsTags[] = { "ALT", "SPD", "TMP", "PRS", "HUM", "P1T", "P2T", "P3T", "P4T" };
+        const uint16_t statsFields[] = { TLM_HAB_ALT, TLM_HAB_SPEED, TLM_TEMP, TLM_PRESSURE, TLM_HUMIDITY, TLM_PODS, TLM_PODS, TLM_PODS, TLM_PODS };
+
+        //Sections measured by a PROFILING build, in the order of their names
+        enum ProfileSlot : uint8_t { PROF_TEMPERATURE, PROF_TELEMETRY, PROF_EXCEL, PROF_COMMAND, PROF_GPS, PROF_SLOTS };
+        const char* const profileNames[] = { "TEMP", "TELEMETRY", "EXCEL", "COMMAND", "GPS" };
+
+        //High-rate science capture while a pod is open
+        HAB_Burst* _burst;
+        burstSample _burstSample;
     
     //----------------------------------------------------------\
     //Actuators-------------------------------------------------|
@@ -94,21 +149,26 @@
         //If the actuator was force-switched
         bool switchForced = false;
 
-        //Additional push time after the actuator has reached the limit, to ensure its extended/retracted as far as it can
-        unsigned long limitReachedTime = 0;
-        bool isHalting = false;
-        
+        //Measured open and closed stops of each pod, kept in EEPROM
+        HAB_Calibration* _calibration;
+
+        //Each pod's heater and actuator outputs, written straight to the port (the pins are fixed in HAB_Definitions)
+        HAB_PodPins<HEAT1_EN, ACT1_EN, ACT1_PUSH, ACT1_PULL> _pod1Pins;
+        HAB_PodPins<HEAT2_EN, ACT2_EN, ACT2_PUSH, ACT2_PULL> _pod2Pins;
+        HAB_PodPins<HEAT3_EN, ACT3_EN, ACT3_PUSH, ACT3_PULL> _pod3Pins;
+        HAB_PodPins<HEAT4_EN, ACT4_EN, ACT4_PUSH, ACT4_PULL> _pod4Pins;
+
         HAB_Actuator _actArray[] = { //Order matters! We will give each atleast a 1.5Km buffer
-            HAB_Actuator("POD_1", ACT1_EN, ACT1_PUSH, ACT1_PULL, ACT1_POS, HEAT1_EN, THERMISTOR1, 2000, 10000),
-            HAB_Actuator("POD_2", ACT2_EN, ACT2_PUSH, ACT2_PULL, ACT2_POS, HEAT2_EN, THERMISTOR2, 12000, 20000),
-            HAB_Actuator("POD_3", ACT3_EN, ACT3_PUSH, ACT3_PULL, ACT3_POS, HEAT3_EN, THERMISTOR3, 22000, 30000),
-            HAB_Actuator("POD_4", ACT4_EN, ACT4_PUSH, ACT4_PULL, ACT4_POS, HEAT4_EN, THERMISTOR4, 32000, 999999)
+            HAB_Actuator("POD_1", &_pod1Pins, ACT1_POS, THERMISTOR1, fromMetres(2000), fromMetres(10000)),
+            HAB_Actuator("POD_2", &_pod2Pins, ACT2_POS, THERMISTOR2, fromMetres(12000), fromMetres(20000)),
+            HAB_Actuator("POD_3", &_pod3Pins, ACT3_POS, THERMISTOR3, fromMetres(22000), fromMetres(30000)),
+            HAB_Actuator("POD_4", &_pod4Pins, ACT4_POS, THERMISTOR4, fromMetres(32000), fromMetres(999999))
         };
         actuatorReadings _actReadingsArray[] = {
-            actuatorReadings(),
-            actuatorReadings(),
-            actuatorReadings(),
-            actuatorReadings()
+            { 0, CentiCelsius(0), ACT_AUTO, HEAT_AUTO, MOTION_IDLE },
+            { 0, CentiCelsius(0), ACT_AUTO, HEAT_AUTO, MOTION_IDLE },
+            { 0, CentiCelsius(0), ACT_AUTO, HEAT_AUTO, MOTION_IDLE },
+            { 0, CentiCelsius(0), ACT_AUTO, HEAT_AUTO, MOTION_IDLE }
         };  
 
     //----------------------------------------------------------\
@@ -124,15 +184,55 @@
 
         //Buffer to hold incoming/outgoing packets
         char rcvBuffer[UDP_TX_PACKET_MAX_SIZE];
-        char sendBuffer[UDP_TX_PACKET_MAX_SIZE];
 
-        //Command arguments
-        char firstArg[ARGUMENT_MAX_LENGTH];
-        char secondArg[ARGUMENT_MAX_LENGTH];
-        char thirdArg[ARGUMENT_MAX_LENGTH];
+        //Command arguments, these point into rcvBuffer
+        char* commandArgs[COMMAND_MAX_ARGS];
+
+        //Every command, with the arguments it needs and whether an uploaded sequence may run it. A
+        //command must be here to be run, so sequences are checked against the same list.
+        struct commandSpec {
+            const char* name;
+            uint8_t args;
+            bool scriptable;
+        };
+        const commandSpec commandTable[] = {
+            { "SET_ACTIVE", 1, true }, { "OVR_ACT_HALT", 0, true }, { "OVR_ACT_OPEN", 0, true }, { "OVR_ACT_CLOSE", 0, true },
+            { "ACT_ENABLE_LOCK", 0, true }, { "ACT_DISABLE_LOCK", 0, true }, { "CALIBRATE", 1, false }, { "CAL_CANCEL", 0, true },
+            { "SET_MIN_TEMP", 1, true }, { "SET_MAX_TEMP", 1, true }, { "OVR_HEAT_ENABLE", 0, true }, { "OVR_HEAT_DISABLE", 0, true },
+            { "OVR_HEAT_RELEASE", 0, true }, { "HEAT_REPORT", 0, true },
+            { "POWER_BUDGET", 1, true }, { "POWER_SOC", 1, true }, { "POWER_REPORT", 0, true },
+            { "CAPTURE", 1, true }, { "CAM_TIMELAPSE", 1, true }, { "CAM_BUDGET", 1, true },
+            { "IMG_SEND", 1, true }, { "IMG_NACK", 2, false }, { "IMG_ACK", 1, false }, { "IMG_CANCEL", 0, true },
+            { "IMG_AUTO_ENABLE", 0, true }, { "IMG_AUTO_DISABLE", 0, true }, { "IMG_RATE", 1, true },
+            { "GET_HISTORY", 2, false }, { "HIST_CANCEL", 0, false }, { "BME_CONFIG", 4, true }, { "BURST_RATE", 1, true },
+            { "SUB_ADD", 5, false }, { "SUB_DEL", 1, false }, { "SUB_LIST", 0, false },
+            { "SET_PHASE", 1, true }, { "SET_DESCENDING", 0, true }, { "HAB_END_FLIGHT", 0, true }, { "STARTUP_REPORT", 0, true },
+            { "SEQ_ADD", 3, false }, { "SEQ_DEL", 1, false }, { "SEQ_LIST", 0, false }, { "SEQ_CLEAR", 0, false },
+            { "PROFILE_REPORT", 0, true }, { "PROFILE_RESET", 0, true }
+        };
+
+        //Commands uploaded to run at an altitude or up-time, and the one being run
+        HAB_Sequencer* _sequencer;
+        char sequenceCommand[SEQUENCE_COMMAND_SIZE];
         
         //Creates the UDP connection object, IP address
         EthernetUDP _conn;
+
+        //Outgoing messages, batched and sent by priority within each destination's rate limit
+        HAB_Outbox* _outbox;
+
+        //Telemetry subscribers, each with its own format, fields and rate. Managed with the SUB_ commands.
+        HAB_Telemetry* _telemetry;
+        int8_t GS1sub;
+        int8_t GS2sub;
+
+        //Every record on the SD card, to backfill link outages and answer GET_HISTORY
+        HAB_History* _history;
+        historyRecord _historyRecord;
+
+        //Link quality from pings to the ground, sets the groundstations' telemetry rate
+        HAB_Link* _link;
+        uint16_t linkInterval = READINGS_TIME_STEP;
             //Balloon address
             IPAddress _localIP(LOCAL_IP_O1, LOCAL_IP_O2, LOCAL_IP_O3, LOCAL_IP_O4);
             byte _localMAC[] = MAC; 
@@ -159,6 +259,7 @@
     void setup() {
         //Serial setup
         Serial.begin(9600);
+        PROFILE_SETUP(profileNames, PROF_SLOTS);
 
         Ethernet.init(10);
 
@@ -173,6 +274,12 @@
     
             //Gets the length of the actuator array
             act_arr_len = sizeof(_actArray) / sizeof(_actArray[0]);
+
+            //Sets each pod's limits from its last calibration
+            _calibration = new HAB_Calibration(_actArray, act_arr_len);
+            if(!_calibration->load()){
+                HAB_Logging::printLogln("No pod calibration, using the default limits");
+            }
     
             //Set up the Excel file
             HAB_Logging::initExcelFile(act_arr_len);
@@ -183,15 +290,58 @@
             //Sets up the camera
             _cam = new HAB_Camera(SD_CHIPSELECT, CAM1_RX_PIN, CAM1_TX_PIN);
                 _cam->emptyImageBuffer(); //Ensures the buffer is empty beforehand
+                _cam->setThumbnailsEnabled(true);
+            _captureQueue = new HAB_CaptureQueue(_cam);
+            _burst = new HAB_Burst();
+            _sequencer = new HAB_Sequencer();
+
+            //Starts on the pad, it can only have landed below STOP_ALTITUDE
+            _phase = new HAB_Phase(fromMetres(STOP_ALTITUDE));
+            _landing = new HAB_Landing();
+
+            //Sets up the statistics, one channel per sensor
+            _stats = new HAB_Stats();
+                for(uint8_t i = 0; i != sizeof(statsFields) / sizeof(statsFields[0]); i++){
+                    _stats->addChannel(statsTags[i], statsFields[i]);
+                }
 
-        //----------------------------------------------------------\
-        //Begin and check startup conditions------------------------|  
-            checkStartupConditions();
+            //Sets up the outbox and telemetry, both groundstations get events and the full packet
+            //PRISM is not sent to by default, add it with SUB_ADD
+            _outbox = new HAB_Outbox(&_conn);
+            _telemetry = new HAB_Telemetry(_outbox, formatTelemetry);
+                GS1sub = _telemetry->addSubscriber(_GSIP1, GS1_PORT, TLM_FULL, TLM_ALL, READINGS_TIME_STEP, true);
+                GS2sub = _telemetry->addSubscriber(_GSIP2, GS2_PORT, TLM_FULL, TLM_ALL, READINGS_TIME_STEP, true);
+            _link = new HAB_Link(&_conn, _GSIP1, GS1_PORT);
+            _history = new HAB_History(&_conn);
+                _history->addDestination(_GSIP1, GS1_PORT);
+                _history->addDestination(_GSIP2, GS2_PORT);
+
+            //Sets up the image downlink to both groundstations
+            _downlink = new HAB_Downlink(&_conn);
+                _downlink->addDestination(_GSIP1, GS1_PORT);
+                _downlink->addDestination(_GSIP2, GS2_PORT);
 
         //----------------------------------------------------------\
-        //Startup checks passed, begin program----------------------|
-            HAB_Logging::printLog("\r\n                     *!GPS lock obtained!*\r\n", "");
+        //Begin and check startup conditions------------------------|
+            //Every subsystem is checked at once, each within its own deadline. The flight starts
+            //once none is pending, without those that are late (they are followed up in the loop).
+            startSubsystems();
+            while(!_startup->isStarted()){
+                updateStartup();
+                recievePacketsUDP();
+                _outbox->flush();
+            }
+            sendStartupReport();
             printInfo();
+
+            //The pad's rates
+            applyPhaseRates();
+
+            //The loop sleeps between its work, woken early by GPS input (or a packet, if the Ethernet interrupt is wired)
+            HAB_Sleep::addWakeSerial(&Serial1);
+            #ifdef ETHERNET_INT_PIN
+                HAB_Sleep::setWakePin(ETHERNET_INT_PIN);
+            #endif
     }
 
 
@@ -201,20 +351,48 @@
 
 
     void loop() {
+        PROFILE_LOOP();
                
+        //----------------------------------------------------------\
+        //Power budget----------------------------------------------|
+            PROFILE_SECTION("Power budget");
+            //Counts the battery charge used, the heaters, actuators and camera each ask the arbiter before switching on
+            HAB_Power::update();
+
         //----------------------------------------------------------\
         //Actuators-------------------------------------------------|
+            PROFILE_SECTION("Actuators");
             //This will open/close pods based on the altitudes specified in the actuator constructor calls
-            if(activeIndex < act_arr_len){ //Makes sure the actuator exists
+            if(activeIndex < act_arr_len && !(_calibration->isRunning() && _calibration->getPod() == activeIndex)){ //Makes sure the actuator exists, and is not being calibrated
                 handleActuator(_actArray + activeIndex);
             }
 
+            //The science burst only runs while the active pod is held open: a close that stalled, a halt, or another pod made active ends it
+            if(_burst->isActive() && !(activeIndex < act_arr_len && _actArray[activeIndex].isActuatorOverridden() && _actArray[activeIndex].isActuatorOverrideOpen())){
+                _burst->stop();
+            }
+
+            //A calibration drives its pod itself
+            if(_calibration->update()){
+                reportCalibration(_calibration->getLastPod());
+            }
+
         //----------------------------------------------------------\
         //Telecommands-----------------------------------------------|
+            PROFILE_SECTION("Telecommands");
              recievePacketsUDP();
 
+        //----------------------------------------------------------\
+        //Late subsystems-------------------------------------------|
+            PROFILE_SECTION("Late subsystems");
+            //Until each subsystem the flight started without is ready or has failed
+            if(!_startup->isSettled()){
+                updateStartup();
+            }
+
         //----------------------------------------------------------\
         //GPS readings----------------------------------------------|
+            PROFILE_SECTION("GPS readings");
 
             if(!noGPS01Connection){
                 //We have a connection to the CSA's GPS, so do nothing
@@ -225,52 +403,188 @@
                 _HABGPSreadings.second = _gps->getReadings()->time.second();
                 _HABGPSreadings.minute = _gps->getReadings()->time.minute();
                 _HABGPSreadings.hour = _gps->getReadings()->time.hour();
-                _HABGPSreadings.speed = _gps->getReadings()->speed.mps();
-                _HABGPSreadings.altitude = _gps->getReadings()->altitude.meters();
-                _HABGPSreadings.latitude = _gps->getReadings()->location.lat();
-                _HABGPSreadings.longitude = _gps->getReadings()->location.lng();               
+                _HABGPSreadings.speed = _gps->getSpeed();
+                _HABGPSreadings.altitude = _gps->getAltitude();
+                _HABGPSreadings.latitude = _gps->getLatitude();
+                _HABGPSreadings.longitude = _gps->getLongitude();               
             }    
 
+        //----------------------------------------------------------\
+        //Command sequence------------------------------------------|
+            PROFILE_SECTION("Command sequence");
+            //Runs the uploaded commands whose altitude or up-time is reached, connected or not
+            while(_sequencer->next(_HABGPSreadings.altitude, millis() / 1000, sequenceCommand)){
+                PROFILE_BEGIN(PROF_COMMAND);
+                handleCommand(sequenceCommand, "SEQUENCE");
+                PROFILE_END(PROF_COMMAND);
+            }
+
+        //----------------------------------------------------------\
+        //BME conversions-------------------------------------------|
+            PROFILE_SECTION("BME conversions");
+            //Collects a finished conversion in one read, then starts the next as often as the readings are used
+            if(BMPstatus){
+                if(_bme.poll()){
+                    _BMEreadings.temperature = CentiCelsius(_bme.getTemperature());
+                    _BMEreadings.pressure = Pascals((_bme.getPressure() + 128) >> 8); //From Q24.8
+                    _BMEreadings.humidity = CentiPercent((_bme.getHumidity() * 100 + 512) >> 10); //From Q22.10
+
+                    //A burst takes one sample per conversion, stamped with when the BME measured it
+                    if(_burst->isActive()){
+                        sampleBurst(_bme.getSampleTime());
+                    }
+                }
+                if(!_bme.isMeasuring() && (millis() - _bme.getSampleTime()) >= (_burst->isActive() ? _burst->getInterval() : _phase->getSampleInterval())){
+                    _bme.start();
+                }
+            }
+
+        //----------------------------------------------------------\
+        //Sensor sampling and statistics----------------------------|
+            PROFILE_SECTION("Sensor sampling and statistics");
+            //Samples faster than the readings are logged, so the statistics see everything in between (at the phase's rate)
+            if((millis() - lastSampleTime) >= _phase->getSampleInterval()){
+                lastSampleTime = millis();
+                sampleSensors();
+            }
+
+            //Once a minute, logs the statistics (the summary telemetry picks them up too)
+            if(_stats->update()){
+                _stats->logSummaries();
+            }
+
+            //While a pod is open, samples at the burst rate (with the BME conversions, above) and writes each full block to its science file
+            if(!BMPstatus && _burst->isSampleDue()){
+                sampleBurst(millis());
+            }
+            _burst->update();
+
+        //----------------------------------------------------------\
+        //Pod heating-----------------------------------------------|
+            PROFILE_SECTION("Pod heating");
+            //Every pod, from the sampled temperatures. Each holds the middle of the band from just before its interval, else only keeps from freezing.
+            //Once landed the heaters stay off.
+            if(_phase->getPhase() != PHASE_LANDED){
+                CentiCelsius heatTarget = CentiCelsius((minTemp.value() + maxTemp.value()) / 2);
+                for(int i = 0; i != act_arr_len; i++){
+                    _actArray[i].updateHeating(_actReadingsArray[i].temperature, _BMEreadings.temperature, BMPstatus,
+                        _HABGPSreadings.altitude, _climbRate, heatTarget);
+                }
+            }
+
         //----------------------------------------------------------\
         //Log and transmit readings---------------------------------|
-            if((millis() - lastReadingsTime) > READINGS_TIME_STEP){
+            PROFILE_SECTION("Log and transmit readings");
+            if((millis() - lastReadingsTime) > _phase->getReadingsInterval()){
                 //Sets the new last readings time
                 lastReadingsTime = millis();
 
-                //BME readings----------------------------------------------|
-                    if(BMPstatus){
-                        _BMEreadings.temperature = _bme.readTemperature();
-                        _BMEreadings.pressure = _bme.readPressure();
-                        _BMEreadings.humidity = _bme.readHumidity();
+                //Climb rate-------------------------------------------------|
+                    if(lastClimbTime != 0){
+                        int32_t climb = (_HABGPSreadings.altitude - lastClimbAltitude).value() * 1000 / (int32_t)(lastReadingsTime - lastClimbTime);
+                        _climbRate = CentimetresPerSecond(_climbRate.value() + (climb - _climbRate.value()) / 4);
                     }
+                    lastClimbAltitude = _HABGPSreadings.altitude;
+                    lastClimbTime = lastReadingsTime;
+
+                //Mission phase-----------------------------------------------|
+                    if(_phase->update(_HABGPSreadings.altitude, _climbRate, isSampling())){
+                        changePhase();
+                    }
+
+                //Landing prediction------------------------------------------|
+                    //Each fix adds to the winds, and once descending the landing point is predicted again
+                    if(_gps->getLockStatus()){
+                        _landing->update(_HABGPSreadings.altitude, _climbRate, _HABGPSreadings.latitude, _HABGPSreadings.longitude,
+                            _phase->getPadAltitude(), _phase->getPhase() == PHASE_DESCENT);
+                    }
+
                 //Actuator readings-----------------------------------------|
+                    //BME readings are kept current by its conversions, actuator temperatures and statuses by sampleSensors
                     for(int i = 0; i != act_arr_len; i++){
                         _actReadingsArray[i].position = _actArray[i].getPosition();
-                        _actReadingsArray[i].temperature = _actArray[i].getTemperature();
-                        strcpy(_actReadingsArray[i].actuatorStatusPtr, (_actArray[i].isActuatorOverridden() ? (_actArray[i].isActuatorOverrideOpen() ? "OVR_OPEN" : "OVR_CLOSE") : "AUTO"));
-                        strcpy(_actReadingsArray[i].heaterStatusPtr, (_actArray[i].isHeaterOverridden() ? (_actArray[i].isHeaterOverrideEnabled() ? "OVR_ENABLED" : "OVR_DISABLED") : "AUTO"));
                     }
-                //Logging and telemetry-------------------------------------|
+                //Logging---------------------------------------------------|
                     //Section for handling logging
+                     PROFILE_BEGIN(PROF_EXCEL);
                      HAB_Logging::writeToExcel(_BMEreadings, _HABGPSreadings, _actReadingsArray, act_arr_len);   
-                     sendTelemetry();
+                     PROFILE_END(PROF_EXCEL);
+
+                    //Keeps the record on the card whether or not there is a connection
+                     fillHistoryRecord(&_historyRecord);
+                     _history->append(_historyRecord);
             }
 
         //----------------------------------------------------------\
         //GPS feed and camera writing-------------------------------|
+            PROFILE_SECTION("GPS feed and camera writing");
             //Feeds input to the GPS receiver to get new data
+            PROFILE_BEGIN(PROF_GPS);
             _gps->feedReceiver();
+            PROFILE_END(PROF_GPS);
+
+            //Queues time-lapse and altitude captures, starts the next capture once the camera is free
+            _captureQueue->update(_HABGPSreadings.altitude);
 
             //If there is data in the camera buffer, writes it to the SD card
             _cam->writeImage();
+
+        //----------------------------------------------------------\
+        //Image downlink--------------------------------------------|
+            PROFILE_SECTION("Image downlink");
+            //Starts sending each new thumbnail once it is on the SD card
+            if(_cam->getWrittenCount() != lastWrittenCount){
+                lastWrittenCount = _cam->getWrittenCount();
+                if(autoDownlink && _cam->isLastImageThumbnail() && !_downlink->isBusy()){
+                    _downlink->startImage(_cam->getLastImageName());
+                }
+            }
+
+            //Sends chunks within the bandwidth cap, pauses (and later resumes) while there is no connection
+            if(!noConnection){
+                _downlink->update();
+            }
+
+        //----------------------------------------------------------\
+        //Outgoing messages-----------------------------------------|
+            PROFILE_SECTION("Outgoing messages");
+            if(!noConnection){
+                //Pings the ground, and follows the telemetry rate the link can carry (10 Hz down to the survival rate)
+                _link->update();
+                if(_link->getInterval() != linkInterval){
+                    linkInterval = _link->getInterval();
+                    setGroundstationRate();
+                }
+
+                //Formats telemetry for the subscribers that are due, each distinct packet once
+                PROFILE_BEGIN(PROF_TELEMETRY);
+                _telemetry->update();
+                PROFILE_END(PROF_TELEMETRY);
+            }
+
+            //Records missed during outages, and GET_HISTORY ranges, at a bounded rate behind live telemetry
+            _history->setConnected(!noConnection);
+            if(!noConnection){
+                _history->update();
+            }
+
+            //Sends the queued events and latest telemetry, at most one datagram to each destination
+            _outbox->flush();
+
         //----------------------------------------------------------\
-        //Check if the balloon has descended------------------------|
-            //THIS IS CURRENTLY NEVER TRIGGERED
-            if(_HABGPSreadings.altitude < STOP_ALTITUDE && isDescending){
-                HAB_Logging::printLogln("Flight ended!");
-                sendGSmessage("Flight ended!");
-                exit(0);
+        //Recovery beacon-------------------------------------------|
+            PROFILE_SECTION("Recovery beacon");
+            //Once landed, the position goes out now and then whether or not the ground is heard from
+            if(_phase->getBeaconInterval() != 0 && (millis() - lastBeaconTime) >= _phase->getBeaconInterval()){
+                lastBeaconTime = millis();
+                sendBeacon();
             }
+
+        //----------------------------------------------------------\
+        //Idle------------------------------------------------------|
+            PROFILE_SECTION("Idle");
+            //Sleeps until the next timed work is due, with the ADC and SPI off
+            HAB_Sleep::idle(getIdleTime());
     }
 
 
@@ -281,8 +595,8 @@
 
     /*-------------------------------------------------------------------------------------*\
     |   Name:       handleActuator                                                          |
-    |   Purpose:    Used to open and close the pods, and maintain proper temperature        |
-    |               of the actuators when they are required to move.                        |
+    |   Purpose:    Used to open and close the pods. Their heaters are run for every pod    |
+    |               in the loop.                                                            |
     |   Arguments:  Actuator                                                                |
     |   Returns:    Void                                                                    |
     \*-------------------------------------------------------------------------------------*/
@@ -290,113 +604,323 @@
 
             //----------------------------------------------------------\
             //Actuator movement-----------------------------------------|
+                //Follows the travel, so it ends as soon as the position settles at the limit
+                actuator->updateMotion();
+
                 //Handle opening-----------------------------------------------//
-                    //If overridden open, not fully open, not opening: start opening
-                    if(actuator->isActuatorOverridden() && actuator->isActuatorOverrideOpen() && !actuator->isFullyOpen() && (!actuator->isMoveEnabled() || !actuator->isOpening())){
-                        //Starts opening the pod
-                        actuator->retract();
-
-                        //Send a message to the ground station
-                        strcpy(msgPtr, "Retracting actuator of ");
-                        strcat(msgPtr, actuator->getName());
-                        sendGSmessage(msgPtr);
+                    //If overridden open, not fully open, not opening, not stalled: start opening
+                    if(actuator->isActuatorOverridden() && actuator->isActuatorOverrideOpen() && !actuator->isFullyOpen() && (!actuator->isMoveEnabled() || !actuator->isOpening()) && actuator->getMotionStatus() != MOTION_STALLED){
+                        //Starts opening the pod, once the power arbiter allows it (else tried again next loop)
+                        if(actuator->retract()){
+                            //Send a message to the ground station
+                            strcpy(msgPtr, "Retracting actuator of ");
+                            strcat(msgPtr, actuator->getName());
+                            PROFILE_EVENT(msgPtr, NULL, "actuator");
+                            sendGSmessage(msgPtr);
+                        }
                                                    
                         //Optional picture
                     }
-                    //Else if overridden open, fully opened, and is moving: halt movement
-                    else if((actuator->isActuatorOverridden() && actuator->isActuatorOverrideOpen()) && actuator->isFullyOpen() && actuator->isMoveEnabled()){
-                        //If this is the first time in here, records the time
-                        if(!isHalting){
-                            isHalting = true;
-                            limitReachedTime = millis();
-                        }
-                        //Once the additional push time has elapsed, halt the actuator and capture an image
-                        else if(isHalting && (millis() - limitReachedTime) >= ADDITIONAL_PUSH_TIME){
-                            isHalting = false;
+                    //Else if overridden open and opening: halt once it has settled at the limit, or if it stalls
+                    else if(actuator->isActuatorOverridden() && actuator->isActuatorOverrideOpen() && actuator->isMoveEnabled() && actuator->isOpening()){
+                        if(actuator->isTravelDone(ADDITIONAL_PUSH_TIME)){
+                            //Halts the actuator and reports its travel time
+                            actuator->halt();
+                            reportTravel(actuator);
                             
-                             //Halts the actuator
+                            //Creates the name of the image and attempts capture (DOS 8.3 format)
+                            strcpy(imgNamePtr, "");
+                            strcat(imgNamePtr, itoa(activeIndex, genStringPtr, 10)); strcat(imgNamePtr, "_O.jpg");                                             
+                            _captureQueue->add(imgNamePtr, CAPTURE_POD, 0);
+
+                            //Starts the science burst for this pod, until it closes
+                            _burst->stop();
+                            _burst->start(actuator->getName());
+                        }
+                        else if(actuator->getMotionStatus() == MOTION_STALLED){
                             actuator->halt();
+                            reportTravel(actuator);
+                        }
+                    }
 
+                //Handle closing-----------------------------------------------//
+                    //If overridden close, not closed, not closing, not stalled: start closing
+                    if(actuator->isActuatorOverridden() && !actuator->isActuatorOverrideOpen() && !actuator->isClosed() && (!actuator->isMoveEnabled() || actuator->isOpening()) && actuator->getMotionStatus() != MOTION_STALLED){
+                        //Starts closing the pod, once the power arbiter allows it (else tried again next loop)
+                        if(actuator->extend()){
                             //Send a message to the ground station
-                            strcpy(msgPtr, "Halting actuator of ");
+                            strcpy(msgPtr, "Extending actuator of ");
                             strcat(msgPtr, actuator->getName());
+                            PROFILE_EVENT(msgPtr, NULL, "actuator");
                             HAB_Logging::printLogln(msgPtr);
                             sendGSmessage(msgPtr);
+                        }
+                                                
+                        //Optional picture
+                    }
+                    //Else if overridden close and closing: halt once it has settled at the limit, or if it stalls
+                    else if(actuator->isActuatorOverridden() && !actuator->isActuatorOverrideOpen() && actuator->isMoveEnabled() && !actuator->isOpening()){
+                        if(actuator->isTravelDone(ADDITIONAL_PUSH_TIME)){
+                            //Halts the actuator and reports its travel time
+                            actuator->halt();
+                            reportTravel(actuator);
                             
                             //Creates the name of the image and attempts capture (DOS 8.3 format)
                             strcpy(imgNamePtr, "");
-                            strcat(imgNamePtr, itoa(activeIndex, genStringPtr, 10)); strcat(imgNamePtr, "_O.jpg");                                             
-                            _cam->captureImage(imgNamePtr, 0);
+                            strcat(imgNamePtr, itoa(activeIndex, genStringPtr, 10)); strcat(imgNamePtr, "_C.jpg"); 
+                            _captureQueue->add(imgNamePtr, CAPTURE_POD, 0);
+
+                            //Pod is sealed, ends its science burst
+                            _burst->stop();
+                        }
+                        else if(actuator->getMotionStatus() == MOTION_STALLED){
+                            actuator->halt();
+                            reportTravel(actuator);
                         }
                     }
+        }
 
-                //Handle closing-----------------------------------------------//
-                    //If overridden close, open, not closing: start closing
-                    if(actuator->isActuatorOverridden() && !actuator->isActuatorOverrideOpen() && !actuator->isClosed() && (!actuator->isMoveEnabled() || actuator->isOpening())){
-                        //Starts closing the pod
-                        actuator->extend();
-
-                        //Send a message to the ground station
-                        strcpy(msgPtr, "Extending actuator of ");
-                        strcat(msgPtr, actuator->getName());
-                        HAB_Logging::printLogln(msgPtr);
-                        sendGSmessage(msgPtr);                      
-                                                
-                        //Optional picture
-                    }
-                    //Else if overridden close, and is closed
-                    else if(actuator->isActuatorOverridden() && !actuator->isActuatorOverrideOpen() && actuator->isClosed()){
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       reportTravel                                                            |
+    |   Purpose:    Logs and sends how an actuator's travel ended: its travel time (marked  |
+    |               if it was slow), or an alarm if it stalled.                             |
+    |   Arguments:  Actuator                                                                |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void reportTravel(HAB_Actuator* actuator){
+            MessagePriority priority = MSG_INFO;
+            if(actuator->getMotionStatus() == MOTION_STALLED){
+                strcpy(msgPtr, "Actuator of ");
+                strcat(msgPtr, actuator->getName());
+                strcat(msgPtr, " stalled at ");
+                strcat(msgPtr, utoa(actuator->getPosition(), genStringPtr, 10));
+                priority = MSG_ALARM;
+            }
+            else{
+                strcpy(msgPtr, "Halting actuator of ");
+                strcat(msgPtr, actuator->getName());
+                strcat(msgPtr, ", travel ");
+                strcat(msgPtr, formatFixed(genStringPtr, (int32_t)(actuator->getTravelTime() / 100), 1));
+                strcat(msgPtr, " s");
+                if(actuator->getMotionStatus() == MOTION_SLOW){ strcat(msgPtr, " (slow)"); }
+            }
+            PROFILE_EVENT(msgPtr, NULL, "actuator");
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, priority);
+        }
 
-                        //If overridden close or not overridden, and move is enabled: halts (avoids disabling in case of overridden-open), take picture
-                        if((!actuator->isActuatorOverridden() || (actuator->isActuatorOverridden() && !actuator->isActuatorOverrideOpen())) && actuator->isMoveEnabled()){
-                            //If this is the first time in here, records the time
-                            if(!isHalting){
-                                isHalting = true;
-                                limitReachedTime = millis();
-                            }
-                            //Once the additional push time has elapsed, halt the actuator and capture an image
-                            else if(isHalting && (millis() - limitReachedTime) >= ADDITIONAL_PUSH_TIME){
-                                isHalting = false;
-                                
-                                //Halts the actuator
-                                actuator->halt();
-
-                                //Send a message to the ground station
-                                strcpy(msgPtr, "Halting actuator of ");
-                                strcat(msgPtr, actuator->getName());
-                                HAB_Logging::printLogln(msgPtr);
-                                sendGSmessage(msgPtr);
-                                
-                                //Creates the name of the image and attempts capture (DOS 8.3 format)
-                                strcpy(imgNamePtr, "");
-                                strcat(imgNamePtr, itoa(activeIndex, genStringPtr, 10)); strcat(imgNamePtr, "_C.jpg"); 
-                                _cam->captureImage(imgNamePtr, 0);
-                            }                       
-                        }       
-                    }       
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       reportCalibration                                                       |
+    |   Purpose:    Logs and sends a pod's calibration result: where it stops when open     |
+    |               and closed, and how long each travel took.                              |
+    |   Arguments:  uint8_t                                                                 |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void reportCalibration(uint8_t index){
+            podCalibration calibration;
+            strcpy(msgPtr, "Calibration of ");
+            strcat(msgPtr, _actArray[index].getName());
+            if(!_calibration->getLastSucceeded() || !_calibration->getCalibration(index, calibration)){
+                strcat(msgPtr, " failed");
+            }
+            else{
+                strcat(msgPtr, ": open ");
+                strcat(msgPtr, utoa(calibration.openStop, genStringPtr, 10));
+                strcat(msgPtr, " in ");
+                strcat(msgPtr, formatFixed(genStringPtr, calibration.openTime, 1));
+                strcat(msgPtr, " s, closed ");
+                strcat(msgPtr, utoa(calibration.closedStop, genStringPtr, 10));
+                strcat(msgPtr, " in ");
+                strcat(msgPtr, formatFixed(genStringPtr, calibration.closeTime, 1));
+                strcat(msgPtr, " s");
+            }
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, MSG_ACK);
+        }
 
-            //----------------------------------------------------------\
-            //Heating---------------------------------------------------|
-                //If its not overridden
-                if(!actuator->isHeaterOverridden()){
-                    //If we're below the temperature limit and not currently heating: start heating
-                    if(actuator->getTemperature() <= minTemp && !actuator->isHeatEnabled()){
-                         actuator->startHeating();            
-                    }
-                    //Else if we're above the temperature limit and currently heating: stop heating
-                    else if(actuator->getTemperature() > maxTemp && actuator->isHeatEnabled()){
-                        actuator->stopHeating();
-                    }
-                }
-                else{
-                    //If heater is not already doing what we want (check its status first), then set it
-                    if(actuator->isHeaterOverrideEnabled() && !actuator->isHeatEnabled()){
-                        actuator->startHeating();
-                    }
-                    else if(!actuator->isHeaterOverrideEnabled() && actuator->isHeatEnabled()){
-                        actuator->stopHeating();
-                    }
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       reportHeating                                                           |
+    |   Purpose:    Sends each pod's heater energy and duty, and its fitted model (time     |
+    |               constant, and how far above the ambient the heater alone holds it).     |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void reportHeating(){
+            for(int i = 0; i != act_arr_len; i++){
+                strcpy(msgPtr, _actArray[i].getName());
+                strcat(msgPtr, " heater ");
+                strcat(msgPtr, ultoa(_actArray[i].getHeaterEnergy(), genStringPtr, 10));
+                strcat(msgPtr, " J, duty ");
+                strcat(msgPtr, utoa(_actArray[i].getHeaterDuty(), genStringPtr, 10));
+                strcat(msgPtr, "%, tau ");
+                strcat(msgPtr, ultoa((uint32_t)_actArray[i].getThermal()->getTimeConstant(), genStringPtr, 10));
+                strcat(msgPtr, " s, rise ");
+                strcat(msgPtr, formatFixed(genStringPtr, roundFixed(_actArray[i].getThermal()->getHeatingRise() * 10), 1));
+                strcat(msgPtr, " C");
+                sendGSmessage(msgPtr, MSG_ACK);
+            }
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       isSampling                                                              |
+    |   Purpose:    Returns true while a pod is within its interval or a science burst is   |
+    |               running, which is the mission's SAMPLING phase.                         |
+    |   Arguments:  void                                                                    |
+    |   Returns:    bool                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        bool isSampling(){
+            if(_burst->isActive()){ return true; }
+            for(int i = 0; i != act_arr_len; i++){
+                if(_actArray[i].isInInterval(_HABGPSreadings.altitude)){ return true; }
+            }
+            return false;
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       changePhase                                                             |
+    |   Purpose:    Reports a new mission phase and switches the loop to its rates. On      |
+    |               landing the pods and science are shut down, leaving the beacon.         |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void changePhase(){
+            strcpy(msgPtr, "Phase ");
+            strcat(msgPtr, HAB_Phase::getName(_phase->getPreviousPhase()));
+            strcat(msgPtr, " to ");
+            strcat(msgPtr, HAB_Phase::getName(_phase->getPhase()));
+            PROFILE_EVENT(msgPtr, NULL, "phase");
+            sendGSmessage(msgPtr, MSG_ALARM);
+            applyPhaseRates();
+
+            if(_phase->getPhase() == PHASE_LANDED){
+                _burst->stop();
+                for(int i = 0; i != act_arr_len; i++){
+                    _actArray[i].deactivateAll();
                 }
+                lastBeaconTime = millis();
+                sendBeacon();
+                _outbox->flushAll();
+            }
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       applyPhaseRates                                                         |
+    |   Purpose:    Sets the camera time-lapse and groundstation telemetry to the phase's   |
+    |               rates. The sensor and logging rates are read from it in the loop.       |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void applyPhaseRates(){
+            _captureQueue->setTimelapseInterval(_phase->getTimelapseInterval());
+            setGroundstationRate();
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       setGroundstationRate                                                    |
+    |   Purpose:    Sets both groundstations' telemetry to what the link can carry, but no  |
+    |               faster than the phase needs.                                            |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void setGroundstationRate(){
+            uint16_t interval = max(linkInterval, _phase->getTelemetryInterval());
+            _telemetry->setSubscriberInterval(GS1sub, interval);
+            _telemetry->setSubscriberInterval(GS2sub, interval);
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       sendBeacon                                                              |
+    |   Purpose:    Sends the position for recovery, e.g. BEACON,43.009600,-81.273700,251.00 |
+    |               even while the ground has not been heard from.                          |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void sendBeacon(){
+            strcpy(msgPtr, "BEACON,");
+            strcat(msgPtr, formatFixed(genStringPtr, _HABGPSreadings.latitude));
+            strcat(msgPtr, ",");
+            strcat(msgPtr, formatFixed(genStringPtr, _HABGPSreadings.longitude));
+            strcat(msgPtr, ",");
+            strcat(msgPtr, formatFixed(genStringPtr, _HABGPSreadings.altitude));
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, MSG_ALARM, true);
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       getIdleTime                                                             |
+    |   Purpose:    Returns how long the loop can sleep: until the next sample, log,        |
+    |               telemetry or beacon is due, at most IDLE_MAX_TIME. Work that carries on |
+    |               every loop (a capture being written, a travel, a burst, messages still  |
+    |               queued) keeps it awake.                                                 |
+    |   Arguments:  void                                                                    |
+    |   Returns:    uint16_t (ms)                                                           |
+    \*-------------------------------------------------------------------------------------*/
+        uint16_t getIdleTime(){
+            if(_cam->getBufferStatus() || _burst->isActive() || _calibration->isRunning() || _outbox->getQueuedCount() != 0){
+                return 0;
+            }
+            if(!noConnection && (_downlink->isBusy() || _history->isQueryActive())){
+                return 0;
+            }
+            for(int i = 0; i != act_arr_len; i++){
+                if(_actArray[i].isMoveEnabled()){ return 0; }
+            }
+
+            unsigned long idleTime = IDLE_MAX_TIME;
+            idleTime = min(idleTime, HAB_Sleep::getTimeUntil(lastSampleTime, _phase->getSampleInterval()));
+            idleTime = min(idleTime, HAB_Sleep::getTimeUntil(lastReadingsTime, _phase->getReadingsInterval()));
+            if(!noConnection){
+                idleTime = min(idleTime, _telemetry->getTimeToNext());
+            }
+            if(_phase->getBeaconInterval() != 0){
+                idleTime = min(idleTime, HAB_Sleep::getTimeUntil(lastBeaconTime, _phase->getBeaconInterval()));
+            }
+            return idleTime;
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       reportPower                                                             |
+    |   Purpose:    Sends the power arbiter's draw, budget and battery charge, the MCU's    |
+    |               duty cycle and current, then each load's schedule: on, waiting or off,  |
+    |               and how long it has been deferred.                                      |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void reportPower(){
+            static const char* const loadTypes[] = { " heater ", " camera ", " actuator " };
+            strcpy(msgPtr, "Power ");
+            strcat(msgPtr, utoa(HAB_Power::getCurrent(), genStringPtr, 10));
+            strcat(msgPtr, " of ");
+            strcat(msgPtr, utoa(HAB_Power::getAvailableBudget(), genStringPtr, 10));
+            strcat(msgPtr, " mA, battery ");
+            strcat(msgPtr, utoa(HAB_Power::getStateOfCharge(), genStringPtr, 10));
+            strcat(msgPtr, "%, deferred ");
+            strcat(msgPtr, ultoa(HAB_Power::getDeferredTime() / 1000, genStringPtr, 10));
+            strcat(msgPtr, " s");
+            sendGSmessage(msgPtr, MSG_ACK);
+
+            strcpy(msgPtr, "CPU awake ");
+            strcat(msgPtr, utoa(HAB_Sleep::getDutyCycle(), genStringPtr, 10));
+            strcat(msgPtr, "%, ~");
+            strcat(msgPtr, utoa(HAB_Sleep::getCurrent(), genStringPtr, 10));
+            strcat(msgPtr, " mA, slept ");
+            strcat(msgPtr, ultoa(HAB_Sleep::getSleepTime() / 1000, genStringPtr, 10));
+            strcat(msgPtr, " s");
+            sendGSmessage(msgPtr, MSG_ACK);
+
+            uint16_t granted = HAB_Power::getGrantedMask();
+            uint16_t waiting = HAB_Power::getWaitingMask();
+            for(uint8_t i = 0; i != HAB_Power::getLoadCount(); i++){
+                strcpy(msgPtr, HAB_Power::getLoadOwner(i));
+                strcat(msgPtr, loadTypes[HAB_Power::getLoadType(i)]);
+                strcat(msgPtr, (granted & (1 << i)) ? "on" : ((waiting & (1 << i)) ? "waiting" : "off"));
+                strcat(msgPtr, ", ");
+                strcat(msgPtr, utoa(HAB_Power::getLoadCurrent(i), genStringPtr, 10));
+                strcat(msgPtr, " mA, deferred ");
+                strcat(msgPtr, ultoa(HAB_Power::getLoadDeferredTime(i) / 1000, genStringPtr, 10));
+                strcat(msgPtr, " s");
+                sendGSmessage(msgPtr, MSG_ACK);
+            }
         }
 
     /*-------------------------------------------------------------------------------------*\
@@ -423,78 +947,24 @@
 
     /*-------------------------------------------------------------------------------------*\
     |   Name:       recievePacketsUDP                                                       |
-    |   Purpose:    Reads in UDP packets and deals with them accordingly.                   |
+    |   Purpose:    Reads in every pending UDP packet (within a time budget) and deals      |
+    |               with them accordingly.                                                  |
     |   Arguments:  void                                                                    |
     |   Returns:    void                                                                    |
     \*-------------------------------------------------------------------------------------*/
         void recievePacketsUDP(){
-            //Gets the size of the packet (0 if no packet)
-            int pktSize = _conn.parsePacket();
-
-            //If there was a packet
-            if(pktSize){
-                //Read the packet from the buffer
-                _conn.read(rcvBuffer, UDP_TX_PACKET_MAX_SIZE);
-                //Serial.print("Received message : ");
-                //Serial.println(rcvBuffer);
-
-                //Attempts to find the sender, if it was listed in the packet
-                char* msgPtr = strtok(rcvBuffer, FIELD_DELIMITER);
-
-                //If PRISM, GPS or GROUNDSTATION packets, interpret them
-                if(strcmp(msgPtr, PRISM_NAME) == 0){
-                    msgPtr = strtok(NULL, FIELD_DELIMITER);
-                    //Check if its a GPS packet and parse it
-
-                    //Parse extra fields...
-                    msgPtr = strtok(NULL, FIELD_DELIMITER);
-                    msgPtr = strtok(NULL, FIELD_DELIMITER);
-
-                    if(strcmp(msgPtr, GPS_NAME) == 0 && CSA_GPS_enabled){
-                        //Latitude
-                        msgPtr = strtok(NULL, FIELD_DELIMITER);             
-                        _CSAGPSreadings.latitude = atof(msgPtr);
-
-                        //Longitude
-                        msgPtr = strtok(NULL, FIELD_DELIMITER);
-                        _CSAGPSreadings.longitude = atof(msgPtr);
-
-                        //Altitude
-                        msgPtr = strtok(NULL, FIELD_DELIMITER);
-                        _CSAGPSreadings.altitude = atof(msgPtr);
-                    }
-                }
-                else if(strcmp(msgPtr, GROUNDSTATION_NAME) == 0 && HAB_GPS_enabled){
-                    msgPtr = strtok(NULL, FIELD_DELIMITER);
-
-                    //Converts all ASCII characters in the packet to upper case and ends the string if non-ascii characters found
-                    for(uint16_t i = 0; sizeof(msgPtr); i++){
-                        //If its a non-ascii character, replace it with the null terminator and break
-                        if((uint32_t)msgPtr[i] > 255 || (uint32_t)msgPtr[i] == 0){
-                            msgPtr[i] = '\0';
-                            break;
-                        }
-    
-                        //Converts the character to upper case
-                        msgPtr[i] = toupper(msgPtr[i]);
-                     }
-    
-                    //If it was a heartbeat packet, record the last time
-                    if(strcmp(msgPtr, "HBT") == 0){
-                        lastHeartbeat = millis();
-                        if(noConnection){
-                            HAB_Logging::printLogln("Connection obtained!");
-                            noConnection = false;
-                        }                   
-                    }
-                    //If not a heartbeat, attempt to interpret it as a command
-                    else{
-                        handleCommand(msgPtr);
-                    }
-                }
-
-                //Wipes the buffer
-                for(int i=0;i<UDP_TX_PACKET_MAX_SIZE;i++)rcvBuffer[i] = 0;
+            unsigned long startTime = millis();
+            uint8_t handled = 0;
+
+            //Drains the packets queued in the ethernet chip, so a burst does not wait a loop per packet
+            while(handled < RECEIVE_MAX_PACKETS && (millis() - startTime) < RECEIVE_TIME_BUDGET && _conn.parsePacket()){
+                handled++;
+
+                //Read the packet from the buffer, only the bytes recieved are terminated (no need to wipe the buffer)
+                int len = _conn.read(rcvBuffer, UDP_TX_PACKET_MAX_SIZE - 1);
+                if(len <= 0){ continue; }
+                rcvBuffer[len] = '\0';
+                handlePacket(rcvBuffer, len);
             }
             
             //Check the last heartbeat time
@@ -516,23 +986,88 @@
             if((millis() - lastGPS01) > CSA_GPS_TIMEOUT && !noGPS01Connection){
                 noGPS01Connection = true;
                 HAB_Logging::printLogln("GPS01 connection lost!");
-                sendGSmessage("GPS01 connection lost!");
+                sendGSmessage("GPS01 connection lost!", MSG_ALARM);
             }
 
             //If no connection, attempts to reinitialize it every second
             if((millis() - lastInit) > RECONNECT_DELAY && noConnection){
                 lastInit = millis();
-                sendGSmessage("INTLZ", true);
+                sendGSmessage("INTLZ", MSG_INFO, true);
+            }
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       handlePacket                                                            |
+    |   Purpose:    Interprets a single packet. Fields are parsed in place.                 |
+    |   Arguments:  char*, uint16_t                                                         |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void handlePacket(char* packet, uint16_t len){
+            HAB_Cursor cursor = HAB_Parse::begin(packet, len);
+            HAB_Token field;
+            int32_t value;
+
+            //Attempts to find the sender, if it was listed in the packet
+            if(!HAB_Parse::next(cursor, FIELD_DELIMITER[0], field)){ return; }
+
+            //If PRISM, GPS or GROUNDSTATION packets, interpret them
+            if(HAB_Parse::equals(field, PRISM_NAME)){
+                //Parse extra fields, then check if its a GPS packet and parse it
+                if(HAB_Parse::skip(cursor, FIELD_DELIMITER[0], 2) && HAB_Parse::next(cursor, FIELD_DELIMITER[0], field)
+                    && HAB_Parse::equals(field, GPS_NAME) && CSA_GPS_enabled){
+                    //Latitude (micro-degrees)
+                    if(HAB_Parse::next(cursor, FIELD_DELIMITER[0], field) && HAB_Parse::parseFixed(field, 6, value)){
+                        _CSAGPSreadings.latitude = MicroDegrees(value); }
+
+                    //Longitude (micro-degrees)
+                    if(HAB_Parse::next(cursor, FIELD_DELIMITER[0], field) && HAB_Parse::parseFixed(field, 6, value)){
+                        _CSAGPSreadings.longitude = MicroDegrees(value); }
+
+                    //Altitude (centimetres)
+                    if(HAB_Parse::next(cursor, FIELD_DELIMITER[0], field) && HAB_Parse::parseFixed(field, 2, value)){
+                        _CSAGPSreadings.altitude = Centimetres(value); }
+                }
+            }
+            else if(HAB_Parse::equals(field, GROUNDSTATION_NAME) && HAB_GPS_enabled){
+                if(!HAB_Parse::next(cursor, FIELD_DELIMITER[0], field)){ return; }
+
+                //Converts the message to upper case, and ends it at any non-printable character
+                HAB_Parse::toUpper(field);
+
+                //If it was a heartbeat or a ping echo, record the last time
+                bool isPong = HAB_Parse::equals(field, "PONG");
+                if(isPong || HAB_Parse::equals(field, "HBT")){
+                    lastHeartbeat = millis();
+                    if(noConnection){
+                        HAB_Logging::printLogln("Connection obtained!");
+                        noConnection = false;
+                    }
+
+                    //Ping echoes have the sequence number and the time it was sent
+                    if(isPong){
+                        int32_t seq;
+                        if(HAB_Parse::next(cursor, FIELD_DELIMITER[0], field) && HAB_Parse::parseFixed(field, 0, seq)
+                            && HAB_Parse::next(cursor, FIELD_DELIMITER[0], field) && HAB_Parse::parseFixed(field, 0, value)){
+                            _link->handlePong(seq, value);
+                        }
+                    }
+                }
+                //If not a heartbeat, attempt to interpret it as a command
+                else{
+                    PROFILE_BEGIN(PROF_COMMAND);
+                    handleCommand(field.ptr, "GROUNDSTATION");
+                    PROFILE_END(PROF_COMMAND);
+                }
             }
         }
 
     /*-------------------------------------------------------------------------------------*\
     |   Name:       handleCommands                                                          |
     |   Purpose:    Interprets the given string and executes it if it is a command.         |
-    |   Arguments:  char*                                                                   |
+    |   Arguments:  char*, const char* (who sent it, for the log)                           |
     |   Returns:    void                                                                    |
     \*-------------------------------------------------------------------------------------*/        
-        void handleCommand(char* command){
+        void handleCommand(char* command, const char* source){
 
             //----------------------------------------------------------\
             //Parse the command-----------------------------------------|
@@ -540,27 +1075,26 @@
                 bool validCommand = true;
 
                 //Outputs the recieved command
-                HAB_Logging::printLog("GROUNDSTATION : ");
+                HAB_Logging::printLog(source);
+                HAB_Logging::printLog(" : ", "");
                 HAB_Logging::printLogln(command, "");
-                sendGSmessage(command);
+                PROFILE_EVENT(command, source, "command");
+                sendGSmessage(command, MSG_ACK);
                 
-                //Gets the first argument
-                char* argPtr = strtok(command, COMMAND_DELIMITER);
-                strncpy(firstArg, argPtr, ARGUMENT_MAX_LENGTH);
-    
-                //Gets the second argument
-                argPtr = strtok(NULL, COMMAND_DELIMITER);
-                strncpy(secondArg, argPtr, ARGUMENT_MAX_LENGTH);
-    
-                //Gets the third argument
-                argPtr = strtok(NULL, COMMAND_DELIMITER);
-                strncpy(thirdArg, argPtr, ARGUMENT_MAX_LENGTH);
+                //Splits the arguments in place, missing ones are empty strings
+                HAB_Parse::split(command, COMMAND_DELIMITER[0], commandArgs, COMMAND_MAX_ARGS);
+                char* firstArg = commandArgs[0];
+                char* secondArg = commandArgs[1];
+                char* thirdArg = commandArgs[2];
 
             //----------------------------------------------------------\
             //Execute the command---------------------------------------|
     
+                //Unknown commands, and missing arguments
+                    if(findCommand(commandArgs) < 0){ validCommand = false; }
+
                 //Actuators-------------------------------------------------|
-                    if(!strcmp(firstArg, "SET_ACTIVE")){
+                    else if(!strcmp(firstArg, "SET_ACTIVE")){
                         if(strcmp(secondArg, "") != 0 && getPodIndex(secondArg) != -1){
                             //Disable the last actuator
                             if(activeIndex < act_arr_len){
@@ -581,7 +1115,7 @@
                             else{
                                 validCommand = false;
                                 HAB_Logging::printLogln("Actuator is locked!");
-                                sendGSmessage("Actuator is locked!");
+                                sendGSmessage("Actuator is locked!", MSG_ACK);
                             }
                         }   
                     }
@@ -590,29 +1124,62 @@
                             _actArray[activeIndex].overrideActuatorClose();
                             _actArray[activeIndex].setLock(true);
                             HAB_Logging::printLogln("Locking actuator!");
-                            sendGSmessage("Locking actuator!");
+                            sendGSmessage("Locking actuator!", MSG_ACK);
                         }
                     }                  
                     //Locks and unlocks the actuators
                     else if(!strcmp(firstArg, "ACT_ENABLE_LOCK")) { if(activeIndex < act_arr_len) _actArray[activeIndex].setLock(true); }
                     else if(!strcmp(firstArg, "ACT_DISABLE_LOCK")){ if(activeIndex < act_arr_len) _actArray[activeIndex].setLock(false); }
+
+                    //CALIBRATE <pod name or ALL>, pre-flight: drives each (unlocked) pod to both stops and keeps them as its limits.
+                    //Only on the pad, in flight it would open the pods outside their intervals.
+                    else if(!strcmp(firstArg, "CALIBRATE")){
+                        int8_t index = getPodIndex(secondArg);
+                        if(!strcmp(secondArg, "ALL")){ index = act_arr_len; }
+                        else if(index == act_arr_len){ index = -1; }
+                        if(_phase->getPhase() != PHASE_PRELAUNCH){ index = -1; }
+                        if(index < 0 || !_calibration->start(index)){ validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "CAL_CANCEL")){ _calibration->cancel(); }
                     
                 //Heaters---------------------------------------------------|
                     else if(!strcmp(firstArg, "SET_MIN_TEMP")){
-                        if(strcmp(secondArg, "") != 0 && atof(secondArg) >= -20 && atof(secondArg) <= 30){ //We allow a 50 degree range. This sets the minimum for ALL heaters.
-                            minTemp = atof(secondArg); } 
+                        HAB_Token tempArg = { secondArg, (uint16_t)strlen(secondArg) };
+                        int32_t temp;
+                        if(HAB_Parse::parseFixed(tempArg, 2, temp) && temp >= fromCelsius(-20).value() && temp <= fromCelsius(30).value()){ //We allow a 50 degree range. This sets the minimum for ALL heaters.
+                            minTemp = CentiCelsius(temp); } 
                         else{
                             validCommand = false; }
                     }
                     else if(!strcmp(firstArg, "SET_MAX_TEMP")){
-                        if(strcmp(secondArg, "") != 0 && atof(secondArg) >= -20 && atof(secondArg) <= 30){ //We will allow a 50 degree range. This sets the maximum for ALL heaters.
-                            maxTemp = atof(secondArg); } 
+                        HAB_Token tempArg = { secondArg, (uint16_t)strlen(secondArg) };
+                        int32_t temp;
+                        if(HAB_Parse::parseFixed(tempArg, 2, temp) && temp >= fromCelsius(-20).value() && temp <= fromCelsius(30).value()){ //We will allow a 50 degree range. This sets the maximum for ALL heaters.
+                            maxTemp = CentiCelsius(temp); } 
                         else{
                             validCommand = false; }
                     }
                     else if(!strcmp(firstArg, "OVR_HEAT_ENABLE")) { if(activeIndex < act_arr_len) _actArray[activeIndex].overrideHeaterEnable();  }
                     else if(!strcmp(firstArg, "OVR_HEAT_DISABLE")){ if(activeIndex < act_arr_len) _actArray[activeIndex].overrideHeaterDisable(); }
                     else if(!strcmp(firstArg, "OVR_HEAT_RELEASE")){ if(activeIndex < act_arr_len) _actArray[activeIndex].overrideHeaterRelease(); }
+                    else if(!strcmp(firstArg, "HEAT_REPORT"))     { reportHeating(); }
+
+                //Power-----------------------------------------------------|
+                    //POWER_BUDGET <mA>, the most the heaters, actuators and camera may draw together (with the base load)
+                    else if(!strcmp(firstArg, "POWER_BUDGET")){
+                        if(strcmp(secondArg, "") != 0 && atol(secondArg) >= 500 && atol(secondArg) <= 5000){
+                            HAB_Power::setBudget(atol(secondArg)); }
+                        else{
+                            validCommand = false; }
+                    }
+                    //POWER_SOC <percent>, the battery's charge, e.g. after it is swapped before launch
+                    else if(!strcmp(firstArg, "POWER_SOC")){
+                        if(strcmp(secondArg, "") != 0 && atoi(secondArg) >= 0 && atoi(secondArg) <= 100){
+                            HAB_Power::setStateOfCharge(atoi(secondArg)); }
+                        else{
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "POWER_REPORT")){ reportPower(); }
 
                     //Enable or disable use of the HAB and CSA GPS units
                     //else if(!strcmp(firstArg, "HAB_GPS_ENABLE")) { HAB_GPS_enabled = true;  }
@@ -620,9 +1187,114 @@
                     //else if(!strcmp(firstArg, "CSA_GPS_ENABLE")) { CSA_GPS_enabled = true;  }
                     //else if(!strcmp(firstArg, "CSA_GPS_DISABLE")){ CSA_GPS_enabled = false; }
 
-                    //End flight
-                    else if(!strcmp(firstArg, "SET_DESCENDING")){ isDescending = true; }
-                    else if(!strcmp(firstArg, "HAB_END_FLIGHT")){ sendGSmessage("Ending flight!"); exit(0); }
+                //Camera----------------------------------------------------|
+                    else if(!strcmp(firstArg, "CAPTURE")){
+                        if(strcmp(secondArg, "") != 0 && atoi(secondArg) >= 0 && atoi(secondArg) <= 2){
+                            _captureQueue->add("CMD.jpg", CAPTURE_COMMAND, atoi(secondArg)); }
+                        else{
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "CAM_TIMELAPSE")){
+                        if(strcmp(secondArg, "") != 0 && atol(secondArg) >= 0 && atol(secondArg) <= 3600){ //Seconds, 0 disables
+                            _captureQueue->setTimelapseInterval(atol(secondArg) * 1000UL); }
+                        else{
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "CAM_BUDGET")){
+                        if(strcmp(secondArg, "") != 0 && atol(secondArg) > 0 && atol(secondArg) <= 4000){ //Megabytes
+                            _captureQueue->setStorageBudget(atol(secondArg) * 1000000UL); }
+                        else{
+                            validCommand = false; }
+                    }
+
+                //Image downlink--------------------------------------------|
+                    else if(!strcmp(firstArg, "IMG_SEND")){
+                        if(strcmp(secondArg, "") == 0 || !_downlink->startImage(secondArg)){
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "IMG_NACK")){
+                        //Chunks given as <first> or <first>-<last>
+                        char* rangePtr = strchr(thirdArg, '-');
+                        uint16_t firstChunk = atoi(thirdArg);
+                        uint16_t lastChunk = (rangePtr ? atoi(rangePtr + 1) : firstChunk);
+                        if(strcmp(thirdArg, "") == 0 || !_downlink->handleNack(atoi(secondArg), firstChunk, lastChunk)){
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "IMG_ACK"))       { if(!_downlink->handleAck(atoi(secondArg))) validCommand = false; }
+                    else if(!strcmp(firstArg, "IMG_CANCEL"))    { _downlink->cancel(); }
+                    else if(!strcmp(firstArg, "IMG_AUTO_ENABLE")) { autoDownlink = true;  }
+                    else if(!strcmp(firstArg, "IMG_AUTO_DISABLE")){ autoDownlink = false; }
+                    else if(!strcmp(firstArg, "IMG_RATE")){
+                        if(strcmp(secondArg, "") != 0 && atoi(secondArg) >= 256 && atoi(secondArg) <= 8192){ //Keeps room for telemetry on the link
+                            _downlink->setRate(atoi(secondArg)); }
+                        else{
+                            validCommand = false; }
+                    }
+
+                //History---------------------------------------------------|
+                    //GET_HISTORY <start s> <end s> [stride], times are up-time as in the logs
+                    else if(!strcmp(firstArg, "GET_HISTORY")){
+                        if(strcmp(thirdArg, "") == 0 || !_history->startQuery(atol(secondArg), atol(thirdArg), (strcmp(commandArgs[3], "") ? atoi(commandArgs[3]) : 1))){
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "HIST_CANCEL")){ _history->cancelQuery(); }
+
+                //BME------------------------------------------------------|
+                    //BME_CONFIG <temperature 1-5> <pressure 0-5> <humidity 0-5> <filter 0-4>, oversampling is 2^(n-1), 0 skips
+                    else if(!strcmp(firstArg, "BME_CONFIG")){
+                        if(strcmp(commandArgs[4], "") == 0 || !_bme.setSampling(atoi(secondArg), atoi(thirdArg), atoi(commandArgs[3]), atoi(commandArgs[4]))){
+                            validCommand = false; }
+                    }
+
+                //Science burst---------------------------------------------|
+                    //BURST_RATE <20 to 50 Hz>, not while a burst is running
+                    else if(!strcmp(firstArg, "BURST_RATE")){ if(strcmp(secondArg, "") == 0 || !_burst->setRate(atoi(secondArg))) validCommand = false; }
+
+                //Telemetry subscribers-------------------------------------|
+                    //SUB_ADD <ip> <port> <format 0-1> <field mask, hex> <interval ms> [events 0-1]
+                    else if(!strcmp(firstArg, "SUB_ADD")){
+                        IPAddress subIP;
+                        if(!subIP.fromString(secondArg) || atol(thirdArg) <= 0 || atol(thirdArg) > 65535
+                            || _telemetry->addSubscriber(subIP, atol(thirdArg), (TelemetryFormat)atoi(commandArgs[3]), strtoul(commandArgs[4], NULL, 16), atol(commandArgs[5]), !strcmp(commandArgs[6], "1")) == -1){
+                            validCommand = false; }
+                    }
+                    else if(!strcmp(firstArg, "SUB_DEL")){ if(strcmp(secondArg, "") == 0 || !_telemetry->removeSubscriber(atoi(secondArg))) validCommand = false; }
+                    else if(!strcmp(firstArg, "SUB_LIST")){
+                        for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+                            if(_telemetry->getSubscriberInfo(i, msgPtr)){ sendGSmessage(msgPtr); }
+                        }
+                    }
+
+                //Mission phase---------------------------------------------|
+                    //SET_PHASE <name>, e.g. back to PRELAUNCH after a false launch
+                    else if(!strcmp(firstArg, "SET_PHASE")){
+                        int8_t phase = PHASE_COUNT;
+                        while(--phase >= 0 && strcmp(secondArg, HAB_Phase::getName((MissionPhase)phase)) != 0);
+                        if(phase < 0){ validCommand = false; }
+                        else if(_phase->set((MissionPhase)phase)){ changePhase(); }
+                    }
+
+                    //End flight, landed keeps the recovery beacon going
+                    else if(!strcmp(firstArg, "SET_DESCENDING")){ if(_phase->set(PHASE_DESCENT)){ changePhase(); } }
+                    else if(!strcmp(firstArg, "HAB_END_FLIGHT")){ sendGSmessage("Ending flight!", MSG_ALARM); if(_phase->set(PHASE_LANDED)){ changePhase(); } }
+
+                //Startup---------------------------------------------------|
+                    else if(!strcmp(firstArg, "STARTUP_REPORT")){ sendStartupReport(); }
+
+                //Command sequence------------------------------------------|
+                    //SEQ_ADD <altitude m or -> <up-time s or -> <command>, runs the command once either is reached
+                    else if(!strcmp(firstArg, "SEQ_ADD")){ if(!addSequenceEntry()) validCommand = false; }
+                    else if(!strcmp(firstArg, "SEQ_DEL")){ if(!_sequencer->remove(atoi(secondArg))) validCommand = false; }
+                    else if(!strcmp(firstArg, "SEQ_CLEAR")){ _sequencer->clear(); }
+                    else if(!strcmp(firstArg, "SEQ_LIST")){
+                        for(uint8_t i = 0; i != _sequencer->getEntryCount(); i++){
+                            sendGSmessage(_sequencer->getEntryInfo(i, msgPtr), MSG_ACK);
+                        }
+                    }
+
+                //Profiling-------------------------------------------------|
+                    else if(!strcmp(firstArg, "PROFILE_REPORT")){ sendProfileReport(); }
+                    else if(!strcmp(firstArg, "PROFILE_RESET")){ HAB_Profile::reset(); }
 
                 //Else if not any of those, it is invalid
                 else{ validCommand = false; }
@@ -630,89 +1302,419 @@
             //----------------------------------------------------------\
             //Send result message---------------------------------------|
                 HAB_Logging::printLogln(validCommand ? "Command executed!" : "Invalid command!");
-                sendGSmessage(validCommand ? "Command executed!" : "Invalid command!");      
+                sendGSmessage(validCommand ? "Command executed!" : "Invalid command!", MSG_ACK);      
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       findCommand                                                             |
+    |   Purpose:    Returns a command's place in the command table, or -1 if it is not      |
+    |               there or is missing arguments.                                          |
+    |   Arguments:  char** (split arguments, missing ones empty)                            |
+    |   Returns:    int8_t                                                                  |
+    \*-------------------------------------------------------------------------------------*/
+        int8_t findCommand(char** args){
+            for(uint8_t i = 0; i != sizeof(commandTable) / sizeof(commandTable[0]); i++){
+                if(strcmp(args[0], commandTable[i].name) != 0){ continue; }
+                for(uint8_t arg = 1; arg <= commandTable[i].args; arg++){
+                    if(arg >= COMMAND_MAX_ARGS || strcmp(args[arg], "") == 0){ return -1; }
+                }
+                return i;
+            }
+            return -1;
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       addSequenceEntry                                                        |
+    |   Purpose:    Adds the SEQ_ADD being handled to the sequence. Its command is checked  |
+    |               against the command table first, and must be one a sequence may run.    |
+    |               Returns false if it is not, or there is no trigger or no room.          |
+    |   Arguments:  void (the split SEQ_ADD is in commandArgs)                              |
+    |   Returns:    bool                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        bool addSequenceEntry(){
+            //Altitude (m, to cm) and up-time (s), '-' leaves either unused
+            HAB_Token altitudeArg = { commandArgs[1], (uint16_t)strlen(commandArgs[1]) };
+            int32_t altitude = 0;
+            bool useAltitude = strcmp(commandArgs[1], "-") != 0;
+            bool useTime = strcmp(commandArgs[2], "-") != 0;
+            if(useAltitude && !HAB_Parse::parseFixed(altitudeArg, 2, altitude)){ return false; }
+            char* timeEnd;
+            unsigned long upTime = strtoul(commandArgs[2], &timeEnd, 10);
+            if(useTime && (!isdigit(commandArgs[2][0]) || *timeEnd != '\0')){ return false; }
+
+            //Joins the command back together from the arguments left
+            char command[SEQUENCE_COMMAND_SIZE] = "";
+            for(uint8_t i = 3; i != COMMAND_MAX_ARGS && strcmp(commandArgs[i], "") != 0; i++){
+                if(strlen(command) + strlen(commandArgs[i]) + 2 > sizeof(command)){ return false; }
+                if(i != 3){ strcat(command, COMMAND_DELIMITER); }
+                strcat(command, commandArgs[i]);
+            }
+
+            //Checks it as it would be run, on a copy as splitting cuts it up
+            char check[SEQUENCE_COMMAND_SIZE];
+            char* checkArgs[COMMAND_MAX_ARGS];
+            strcpy(check, command);
+            HAB_Parse::split(check, COMMAND_DELIMITER[0], checkArgs, COMMAND_MAX_ARGS);
+            int8_t index = findCommand(checkArgs);
+            if(index < 0 || !commandTable[index].scriptable){ return false; }
+
+            return _sequencer->add(useAltitude, Centimetres(altitude), useTime, upTime, command);
         }
 
     /*-------------------------------------------------------------------------------------*\
     |   Name:       sendGSmessage                                                           |
-    |   Purpose:    Sends a message to the ground station.                                  |
-    |   Arguments:  char*                                                                   |
+    |   Purpose:    Queues a message for the ground stations. It is sent by the outbox,     |
+    |               higher priorities first, repeats of a waiting message are merged.       |
+    |   Arguments:  char*, MessagePriority, bool                                            |
     |   Returns:    void                                                                    |
     \*-------------------------------------------------------------------------------------*/
-        void sendGSmessage(const char* msg, bool ignoreConn = false){
+        void sendGSmessage(const char* msg, MessagePriority priority, bool ignoreConn){
             if(!noConnection || ignoreConn){
-                strcpy(genStringPtr, "[EVENT]");
-                strcat(genStringPtr, HAB_Logging::getTimestamp());
-                strcat(genStringPtr, msg);
-                _conn.beginPacket(_GSIP1, GS1_PORT);
-                _conn.write(genStringPtr);
-                _conn.endPacket();
-
-                _conn.beginPacket(_GSIP2, GS2_PORT);
-                _conn.write(genStringPtr);
-                _conn.endPacket();
+                _outbox->queue(msg, priority);
             }
         }
         
     /*-------------------------------------------------------------------------------------*\
-    |   Name:       sendTelemetry                                                           |
-    |   Purpose:    Sends telemetry station to our groundstation and CSA's PRISM.           |
-    |   Arguments:  void                                                                    |
-    |   Returns:    void                                                                    |
+    |   Name:       formatTelemetry                                                         |
+    |   Purpose:    Formats a telemetry packet with the fields in the mask. TLM_FULL is     |
+    |               PRISM's format, fields left out are empty. TLM_TAGGED only has the      |
+    |               fields in the mask. TLM_SUMMARY has the last minute's statistics.       |
+    |               Called by the telemetry subscribers.                                    |
+    |   Arguments:  char*, uint16_t, TelemetryFormat, uint16_t                              |
+    |   Returns:    uint16_t (length, 0 if it did not fit)                                  |
     \*-------------------------------------------------------------------------------------*/
-        void sendTelemetry(){
-            if(!noConnection){
+        uint16_t formatTelemetry(char* buffer, uint16_t size, TelemetryFormat format, uint16_t mask){
+            //Readings in the order of their field bits, starting at TLM_HAB_ALT, as fixed point with their unit's decimals
+            const int32_t values[] = {
+                _HABGPSreadings.altitude.value(), _HABGPSreadings.speed.value(), _HABGPSreadings.longitude.value(), _HABGPSreadings.latitude.value(),
+                _CSAGPSreadings.altitude.value(), _CSAGPSreadings.longitude.value(), _CSAGPSreadings.latitude.value(),
+                _BMEreadings.temperature.value(), _BMEreadings.pressure.value(), _BMEreadings.humidity.value()
+            };
+            static const char* const tags[] = { "ALT", "SPD", "LON", "LAT", "CALT", "CLON", "CLAT", "TMP", "PRS", "HUM" };
+            static const uint8_t decimals[] = { 2, 2, 6, 6, 2, 6, 6, 2, 0, 2 };
+            uint16_t len = 0;
+            bool fits = true;
+            buffer[0] = '\0';
+
+            if(format == TLM_FULL){
                 //Formats the packet to PRISM's standards
-                strcpy(sendBuffer, ",,");
-                strcat(sendBuffer, _gps->getDate(genStringPtr));
-                strcat(sendBuffer, " ");
-                strcat(sendBuffer, HAB_Logging::getTimeFormatted());
-                strcat(sendBuffer, ",HAB,");
-                strcat(sendBuffer, dtostrf(_HABGPSreadings.altitude,    6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_HABGPSreadings.speed,       6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_HABGPSreadings.longitude,   6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_HABGPSreadings.latitude,    6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_CSAGPSreadings.altitude,    6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_CSAGPSreadings.longitude,   6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_CSAGPSreadings.latitude,    6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_BMEreadings.temperature, 6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_BMEreadings.pressure,    6, 3, genStringPtr)); strcat(sendBuffer, ",");
-                strcat(sendBuffer, dtostrf(_BMEreadings.humidity,    6, 3, genStringPtr));
-                
-                
+                fits = appendTelemetry(buffer, size, len, ",,");
+                if(mask & TLM_TIME){
+                    fits = fits && appendTelemetry(buffer, size, len, _gps->getDate(genStringPtr));
+                    fits = fits && appendTelemetry(buffer, size, len, " ");
+                    fits = fits && appendTelemetry(buffer, size, len, HAB_Logging::getTimeFormatted());
+                }
+                fits = fits && appendTelemetry(buffer, size, len, ",HAB");
+                for(uint8_t i = 0; i != sizeof(decimals); i++){
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    if(mask & (TLM_HAB_ALT << i)){ fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, values[i], decimals[i])); }
+                }
+
                 //Statuses of each actuator
                 for(int i = 0; i != act_arr_len; i++){
-                    strcat(sendBuffer, ",");
-                    strcat(sendBuffer, dtostrf(_actReadingsArray[i].position, 6, 3, genStringPtr));
-                    strcat(sendBuffer, ",");
-                    strcat(sendBuffer, dtostrf(_actReadingsArray[i].temperature, 6, 3, genStringPtr));
-                    strcat(sendBuffer, ",");
+                    if(!(mask & TLM_PODS)){
+                        fits = fits && appendTelemetry(buffer, size, len, ",,,,");
+                        continue;
+                    }
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].position, genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _actReadingsArray[i].temperature));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
                     //Status of actuator override: auto(none), open, close
-                    strcat(sendBuffer, (_actArray[i].isActuatorOverridden() ? (_actArray[i].isActuatorOverrideOpen() ? "1" : "0") : "2")); //OVR_OPEN(1), OVR_CLOSE(0), AUTO(2)
-                    strcat(sendBuffer, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].actuatorStatus, genStringPtr, 10)); //OVR_OPEN(1), OVR_CLOSE(0), AUTO(2)
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
                     //Status of heater override: auto(none), enabled, disabled
-                    strcat(sendBuffer, (_actArray[i].isHeaterOverridden() ? (_actArray[i].isHeaterOverrideEnabled() ? "1" : "0") : "2")); //OVR_ENABLE(1), OVR_DISABLE(0), AUTO(2)
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].heaterStatus, genStringPtr, 10)); //OVR_ENABLE(1), OVR_DISABLE(0), AUTO(2)
                 }
-    
+
+                //Link quality comes after PRISM's fields, so it is only added if asked for
+                if(mask & TLM_LINK){
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getRtt(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getJitter(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getLoss(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getInterval(), genStringPtr, 10));
+                }
+
+                //Then the power budget, mission phase and landing prediction, after the (possibly empty) fields before them
+                if(mask & (TLM_POWER | TLM_PHASE | TLM_LANDING)){
+                    if(!(mask & TLM_LINK)){ fits = fits && appendTelemetry(buffer, size, len, ",,,,"); }
+                }
+                if((mask & (TLM_PHASE | TLM_LANDING)) && !(mask & TLM_POWER)){
+                    fits = fits && appendTelemetry(buffer, size, len, ",,,,,,");
+                }
+                if(mask & TLM_POWER){
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getCurrent(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getAvailableBudget(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getStateOfCharge(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, ultoa(HAB_Power::getDeferredTime() / 1000, genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getGrantedMask(), genStringPtr, 16));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getWaitingMask(), genStringPtr, 16));
+                }
+                if(mask & TLM_PHASE){
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, HAB_Phase::getName(_phase->getPhase()));
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, ultoa(_phase->getPhaseTime() / 1000, genStringPtr, 10));
+                }
+                if((mask & TLM_LANDING) && !(mask & TLM_PHASE)){
+                    fits = fits && appendTelemetry(buffer, size, len, ",,");
+                }
+                if(mask & TLM_LANDING){
+                    if(_landing->hasPrediction()){
+                        fits = fits && appendTelemetry(buffer, size, len, ",");
+                        fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _landing->getLatitude()));
+                        fits = fits && appendTelemetry(buffer, size, len, ",");
+                        fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _landing->getLongitude()));
+                        fits = fits && appendTelemetry(buffer, size, len, ",");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getTimeToLanding(), genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, ",");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getErrorEast(), genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, ",");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getErrorNorth(), genStringPtr, 10));
+                    }
+                    else{
+                        fits = fits && appendTelemetry(buffer, size, len, ",,,,,");
+                    }
+                }
+
                 //Appends the end of the packet
-                strcat(sendBuffer, "\r\n");
-                //strcat(sendBuffer, 0x0D); strcat(rcvBuffer, 0x0A);
-
-                //Sends the packet to our first groundstation
-                _conn.beginPacket(_GSIP1, GS1_PORT);
-                _conn.write(sendBuffer);
-                _conn.endPacket();
-
-                //Sends the packet to our second groundstation
-                _conn.beginPacket(_GSIP2, GS2_PORT);
-                _conn.write(sendBuffer);
-                _conn.endPacket();
-                
-                //Sends the packet to PRISM
-                //_conn.beginPacket(_PRISMIP, PRISM_PORT);
-                //_conn.write(sendBuffer);
-                //_conn.endPacket();
-            }       
+                fits = fits && appendTelemetry(buffer, size, len, "\r\n");
+            }
+            else if(format == TLM_SUMMARY){
+                //Last minute of each channel in the mask, e.g. [STAT]120,ALT=600/20100.0/20512.3/20305.1/118.2
+                //as count/min/max/mean/standard deviation. Nothing is sent before the first minute is over.
+                if(_stats->getWindowEnd() == 0){ return 0; }
+                fits = appendTelemetry(buffer, size, len, "[STAT]");
+                fits = fits && appendTelemetry(buffer, size, len, ultoa(_stats->getWindowEnd(), genStringPtr, 10));
+                for(uint8_t i = 0; i != _stats->getChannelCount(); i++){
+                    if(!(mask & _stats->getField(i))){ continue; }
+                    fits = fits && appendTelemetry(buffer, size, len, ",");
+                    fits = fits && appendTelemetry(buffer, size, len, _stats->getTag(i));
+                    fits = fits && appendTelemetry(buffer, size, len, "=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_stats->getCount(i), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, dtostrf(_stats->getMin(i), 1, 1, genStringPtr));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, dtostrf(_stats->getMax(i), 1, 1, genStringPtr));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, dtostrf(_stats->getMean(i), 1, 1, genStringPtr));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, dtostrf(_stats->getStdDev(i), 1, 2, genStringPtr));
+                }
+            }
+            else{
+                //Only the fields asked for, e.g. [TLM]T=12:00:00,ALT=20512.3
+                const char* separator = "";
+                fits = appendTelemetry(buffer, size, len, "[TLM]");
+                if(mask & TLM_TIME){
+                    fits = fits && appendTelemetry(buffer, size, len, "T=");
+                    fits = fits && appendTelemetry(buffer, size, len, HAB_Logging::getTimeFormatted());
+                    separator = ",";
+                }
+                for(uint8_t i = 0; i != sizeof(decimals); i++){
+                    if(!(mask & (TLM_HAB_ALT << i))){ continue; }
+                    fits = fits && appendTelemetry(buffer, size, len, separator);
+                    fits = fits && appendTelemetry(buffer, size, len, tags[i]);
+                    fits = fits && appendTelemetry(buffer, size, len, "=");
+                    fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, values[i], decimals[i]));
+                    separator = ",";
+                }
+
+                //Each pod as P<n>=position/temperature/actuator override/heater override/motion
+                if(mask & TLM_PODS){
+                    for(int i = 0; i != act_arr_len; i++){
+                        fits = fits && appendTelemetry(buffer, size, len, separator);
+                        fits = fits && appendTelemetry(buffer, size, len, "P");
+                        fits = fits && appendTelemetry(buffer, size, len, itoa(i + 1, genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "=");
+                        fits = fits && appendTelemetry(buffer, size, len, itoa(_actReadingsArray[i].position, genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _actReadingsArray[i].temperature));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].actuatorStatus, genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].heaterStatus, genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_actReadingsArray[i].motionStatus, genStringPtr, 10));
+                        separator = ",";
+                    }
+                }
+
+                //Link quality as RTT=ms,JIT=ms,LOSS=percent,TI=telemetry interval ms
+                if(mask & TLM_LINK){
+                    fits = fits && appendTelemetry(buffer, size, len, separator);
+                    fits = fits && appendTelemetry(buffer, size, len, "RTT=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getRtt(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",JIT=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getJitter(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",LOSS=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getLoss(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",TI=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(_link->getInterval(), genStringPtr, 10));
+                    separator = ",";
+                }
+
+                //Power as PWR=draw mA/budget mA/battery percent/deferred s, and the load schedule as
+                //LOAD=on/waiting, each a hex mask with bit n for load n (see POWER_REPORT), and the MCU as
+                //CPU=awake percent/mA
+                if(mask & TLM_POWER){
+                    fits = fits && appendTelemetry(buffer, size, len, separator);
+                    fits = fits && appendTelemetry(buffer, size, len, "PWR=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getCurrent(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getAvailableBudget(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getStateOfCharge(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, ultoa(HAB_Power::getDeferredTime() / 1000, genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, ",LOAD=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getGrantedMask(), genStringPtr, 16));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Power::getWaitingMask(), genStringPtr, 16));
+                    fits = fits && appendTelemetry(buffer, size, len, ",CPU=");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Sleep::getDutyCycle(), genStringPtr, 10));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, utoa(HAB_Sleep::getCurrent(), genStringPtr, 10));
+                    separator = ",";
+                }
+
+                //Mission phase as PH=name/seconds in it
+                if(mask & TLM_PHASE){
+                    fits = fits && appendTelemetry(buffer, size, len, separator);
+                    fits = fits && appendTelemetry(buffer, size, len, "PH=");
+                    fits = fits && appendTelemetry(buffer, size, len, HAB_Phase::getName(_phase->getPhase()));
+                    fits = fits && appendTelemetry(buffer, size, len, "/");
+                    fits = fits && appendTelemetry(buffer, size, len, ultoa(_phase->getPhaseTime() / 1000, genStringPtr, 10));
+                    separator = ",";
+                }
+
+                //Landing prediction as LND=latitude/longitude/seconds to landing/east error m/north error m,
+                //the error 1 sigma. LND=- until descending.
+                if(mask & TLM_LANDING){
+                    fits = fits && appendTelemetry(buffer, size, len, separator);
+                    fits = fits && appendTelemetry(buffer, size, len, "LND=");
+                    if(_landing->hasPrediction()){
+                        fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _landing->getLatitude()));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, formatFixed(genStringPtr, _landing->getLongitude()));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getTimeToLanding(), genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getErrorEast(), genStringPtr, 10));
+                        fits = fits && appendTelemetry(buffer, size, len, "/");
+                        fits = fits && appendTelemetry(buffer, size, len, utoa(_landing->getErrorNorth(), genStringPtr, 10));
+                    }
+                    else{
+                        fits = fits && appendTelemetry(buffer, size, len, "-");
+                    }
+                }
+            }
+            return (fits ? len : 0);
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       sampleSensors                                                           |
+    |   Purpose:    Reads the pod temperatures and override statuses into the latest        |
+    |               readings, and adds every sensor to the statistics.                      |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void sampleSensors(){
+            //Pods, the BME readings are kept current by its conversions in the loop
+            for(int i = 0; i != act_arr_len; i++){
+                PROFILE_BEGIN(PROF_TEMPERATURE);
+                _actReadingsArray[i].temperature = _actArray[i].getTemperature();
+                PROFILE_END(PROF_TEMPERATURE);
+                _actReadingsArray[i].actuatorStatus = _actArray[i].getActuatorStatus();
+                _actReadingsArray[i].heaterStatus = _actArray[i].getHeaterStatus();
+                _actReadingsArray[i].motionStatus = _actArray[i].getMotionStatus();
+            }
+
+            //Same order as statsTags
+            _stats->add(0, toFloat(_HABGPSreadings.altitude));
+            _stats->add(1, toFloat(_HABGPSreadings.speed));
+            if(BMPstatus){
+                _stats->add(2, toFloat(_BMEreadings.temperature));
+                _stats->add(3, toFloat(_BMEreadings.pressure));
+                _stats->add(4, toFloat(_BMEreadings.humidity));
+            }
+            for(int i = 0; i != act_arr_len && i != 4; i++){
+                _stats->add(5 + i, toFloat(_actReadingsArray[i].temperature));
+            }
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       sampleBurst                                                             |
+    |   Purpose:    Reads the pod thermistors and adds them, with the BME readings, to the  |
+    |               science burst. Called with each BME conversion collected, stamped with  |
+    |               the time it was measured (else with the time now, without the BME).     |
+    |   Arguments:  unsigned long (millis() of the sample)                                  |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void sampleBurst(unsigned long sampleTime){
+            _burstSample.time = sampleTime;
+
+            //The BME runs conversions at the burst rate while a burst is on, this is the one just collected
+            _burstSample.temperature = _BMEreadings.temperature.value();
+            _burstSample.pressure = _BMEreadings.pressure.value();
+            _burstSample.humidity = _BMEreadings.humidity.value();
+
+            for(int i = 0; i != BURST_PODS; i++){
+                _burstSample.podTemperature[i] = (i < act_arr_len ? _actArray[i].getTemperature().value() : 0);
+            }
+
+            _burst->add(_burstSample);
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       fillHistoryRecord                                                       |
+    |   Purpose:    Copies the latest readings to a history record.                         |
+    |   Arguments:  historyRecord*                                                          |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void fillHistoryRecord(historyRecord* record){
+            record->time = millis() / 1000;
+            record->altitude = _HABGPSreadings.altitude.value();
+            record->latitude = _HABGPSreadings.latitude.value();
+            record->longitude = _HABGPSreadings.longitude.value();
+            record->speed = _HABGPSreadings.speed.value();
+            record->temperature = _BMEreadings.temperature.value();
+            record->pressure = _BMEreadings.pressure.value();
+            record->humidity = _BMEreadings.humidity.value();
+
+            record->podStatus = 0;
+            for(int i = 0; i != act_arr_len && i != HISTORY_PODS; i++){
+                record->podPosition[i] = _actReadingsArray[i].position;
+                record->podTemperature[i] = _actReadingsArray[i].temperature.value();
+                //OVR_OPEN(1), OVR_CLOSE(0), AUTO(2), then OVR_ENABLE(1), OVR_DISABLE(0), AUTO(2)
+                record->podStatus |= _actReadingsArray[i].actuatorStatus << (i * 4);
+                record->podStatus |= _actReadingsArray[i].heaterStatus << (i * 4 + 2);
+            }
+        }
+
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       appendTelemetry                                                         |
+    |   Purpose:    Appends text to a telemetry packet if it fits.                          |
+    |   Arguments:  char*, uint16_t, uint16_t, char*                                        |
+    |   Returns:    bool (false if it did not fit)                                          |
+    \*-------------------------------------------------------------------------------------*/
+        bool appendTelemetry(char* buffer, uint16_t size, uint16_t& len, const char* text){
+            uint16_t textLen = strlen(text);
+            if(len + textLen + 1 > size){ return false; }
+            memcpy(buffer + len, text, textLen + 1);
+            len += textLen;
+            return true;
         }
 
     /*-------------------------------------------------------------------------------------*\
@@ -760,119 +1762,139 @@
 
 
     /*-------------------------------------------------------------------------------------*\
-    |   Name:       checkStartupConditions                                                  |
-    |   Purpose:    Holds the program until all startup conditions passed.                  |
+    |   Name:       startSubsystems                                                         |
+    |   Purpose:    Starts the Ethernet and adds each subsystem's check, with how long the  |
+    |               flight waits for it (see HAB_Definitions). The GPS dynamic model and    |
+    |               lock, and the groundstation, come up side by side.                      |
     |   Arguments:  void                                                                    |
     |   Returns:    void                                                                    |
     \*-------------------------------------------------------------------------------------*/
-        void checkStartupConditions(){
-
-            //----------------------------------------------------------\
-            //Telemetry check-------------------------------------------|
-                //Sets up the ethernet
-                Ethernet.begin(_localMAC, _localIP, dns, gate, sub);
-                Ethernet.setRetransmissionCount(0);
-                
-                while(!_conn.begin(LOCAL_PORT));
-                //_conn.flush(); //?
-                HAB_Logging::printLogln("UDP OKAY");
-
-                //Obtain a connection to the ground station               
-                while(noConnection){
-                    sendGSmessage("INTLZ", true);
-                    recievePacketsUDP();
-                    delay(500);
-                }
-                HAB_Logging::printLogln("CONNECTION OKAY");
-                sendGSmessage("CONNECTION OKAY");
-
-                //Sets status LED
-                //digitalWrite(TELEMETRY_LED, HIGH);
+        void startSubsystems(){
+            //Sets up the ethernet
+            Ethernet.begin(_localMAC, _localIP, dns, gate, sub);
+            Ethernet.setRetransmissionCount(0);
+
+            _startup = new HAB_Startup();
+                _startup->add("NET", checkNetwork, STARTUP_NET_TIMEOUT);
+                _startup->add("GS", checkGroundstation, STARTUP_GS_TIMEOUT);
+                _startup->add("LOG", checkLogging, 0);
+                _startup->add("CAM", checkCamera, 0);
+                _startup->add("BME", checkBME, 0);
+                _startup->add("GPSM", checkGPSMode, STARTUP_GPS_MODE_TIMEOUT);
+                _startup->add("GPS", checkGPSLock, STARTUP_GPS_LOCK_TIMEOUT);
+                _startup->add("PODS", checkPods, STARTUP_POD_TIMEOUT);
+        }
 
-            //----------------------------------------------------------\
-            //Pod check-------------------------------------------------|
-                for(int i = 0; i != act_arr_len; i++){
-                    if(!_actArray[i].isClosed()){
-                        strcpy(msgPtr, _actArray[i].getName());
-                        strcat(msgPtr, " is not closed.");
-                        HAB_Logging::printLogln(msgPtr);              
-                        sendGSmessage(msgPtr);
-                        //while(!podBypass){ recievePacketsUDP(); }
-                    }
-                }
-                HAB_Logging::printLogln("PODS OKAY");              
-                sendGSmessage("PODS OKAY");
-                
-                //Sets status LED
-                //digitalWrite(POD_LED, HIGH);
-            
-            //----------------------------------------------------------\
-            //Logging check---------------------------------------------|
-                //while(!HAB_Logging::checkReady() && !loggingBypass){ recievePacketsUDP(); }
-                    HAB_Logging::printLogln("LOGGING OKAY");              
-                    sendGSmessage("LOGGING OKAY");
-                    
-                //Sets status LED
-                //digitalWrite(LOGGING_LED, HIGH);
-    
-            //----------------------------------------------------------\
-            //Camera check----------------------------------------------|
-                if(!_cam->getReadyStatus()){
-                    HAB_Logging::printLogln("CAMERA OKAY");              
-                    sendGSmessage("CAMERA OKAY");
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       updateStartup                                                           |
+    |   Purpose:    Polls the subsystems that are pending or late, and logs and sends each  |
+    |               one that became ready, failed or late, e.g. "GPS READY 42.1 s".         |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void updateStartup(){
+            int8_t index = _startup->update();
+            if(index < 0){ return; }
+
+            MessagePriority priority = MSG_ALARM;
+            strcpy(msgPtr, _startup->getName(index));
+            switch(_startup->getStatus(index)){
+                case STARTUP_READY:
+                    strcat(msgPtr, " READY ");
+                    strcat(msgPtr, formatFixed(genStringPtr, (int32_t)(_startup->getSettledTime(index) / 100), 1));
+                    strcat(msgPtr, " s");
+                    priority = MSG_INFO;
+                    break;
+                case STARTUP_FAILED:
+                    strcat(msgPtr, " FAILED");
+                    break;
+                default:
+                    strcat(msgPtr, " LATE, starting without it");
+                    break;
+            }
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, priority, true);
+        }
 
-                    //Sets status LED
-                    //digitalWrite(CAMERA_LED, HIGH);
-                }
-                else{
-                    HAB_Logging::printLogln("CAMERA FAILED");              
-                    sendGSmessage("CAMERA FAILED");
-                }     
-    
-            //----------------------------------------------------------\
-            //BME check-------------------------------------------------|
-                if(BMPstatus = _bme.begin()){
-                    HAB_Logging::printLogln("BME OKAY");              
-                    sendGSmessage("BME OKAY");
-                    
-                    //Sets status LED
-                    //digitalWrite(BME_LED, HIGH);
-                }
-                else{
-                    HAB_Logging::printLogln("BME FAILED");              
-                    sendGSmessage("BME FAILED");
-                }      
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       sendStartupReport                                                       |
+    |   Purpose:    Logs and sends the readiness report, each subsystem's time to ready or  |
+    |               its state, e.g. STARTUP 4.2,NET=0.0,GS=2.3,CAM=FAIL,GPS=LATE. It is an  |
+    |               alarm while the flight runs without any of them.                        |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void sendStartupReport(){
+            _startup->getReport(msgPtr, sizeof(msgPtr));
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, (_startup->getDegradedMask() != 0 ? MSG_ALARM : MSG_INFO), true);
+        }
 
-            //----------------------------------------------------------\
-            //GPS check-------------------------------------------------|
-                if(!_gps->isModeSet()){
-                    HAB_Logging::printLogln("GPS MODE OKAY");              
-                    sendGSmessage("GPS MODE OKAY"); 
-                }
-                else{
-                    HAB_Logging::printLogln("GPS MODE FAILED");              
-                    sendGSmessage("GPS MODE FAILED"); 
-                }
-                    
-     
-                if(!_gps->getLockStatus()){           
-                    HAB_Logging::printLogln("GPS LOCK OKAY");              
-                    sendGSmessage("GPS LOCK OKAY");
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       sendProfileReport                                                       |
+    |   Purpose:    Logs and sends a PROFILING build's measurements, a CSV line per section |
+    |               (see HAB_Profile::getReport) then the least free stack as PROF,FREE,n.  |
+    |               Only PROF,OFF when profiling is not built in.                           |
+    |   Arguments:  void                                                                    |
+    |   Returns:    void                                                                    |
+    \*-------------------------------------------------------------------------------------*/
+        void sendProfileReport(){
+            if(HAB_Profile::getSlotCount() == 0){
+                strcpy(msgPtr, "PROF,OFF");
+                HAB_Logging::printLogln(msgPtr);
+                sendGSmessage(msgPtr, MSG_ACK);
+                return;
+            }
+            for(uint8_t i = 0; i != HAB_Profile::getSlotCount(); i++){
+                HAB_Logging::printLogln(HAB_Profile::getReport(i, msgPtr));
+                sendGSmessage(msgPtr, MSG_ACK);
+            }
+            strcpy(msgPtr, "PROF,FREE,");
+            utoa(HAB_Profile::getStackHeadroom(), msgPtr + strlen(msgPtr), 10);
+            HAB_Logging::printLogln(msgPtr);
+            sendGSmessage(msgPtr, MSG_ACK);
+        }
 
-                    //Sets status LED
-                    //digitalWrite(GPS_LED, HIGH);
-                }
-                else{
-                    HAB_Logging::printLogln("GPS LOCK FAILED");              
-                    sendGSmessage("GPS LOCK FAILED");
-                }     
-
-           /*delay(3000);
-           digitalWrite(TELEMETRY_LED, LOW);
-           digitalWrite(POD_LED, LOW);
-           digitalWrite(LOGGING_LED, LOW);
-           digitalWrite(CAMERA_LED, LOW);
-           digitalWrite(BME_LED, LOW);
-           digitalWrite(BME_LED, LOW);
-           digitalWrite(GPS_LED, LOW);*/
+    /*-------------------------------------------------------------------------------------*\
+    |   Name:       checkNetwork, checkGroundstation, checkLogging, checkCamera, checkBME,  |
+    |               checkGPSMode, checkGPSLock, checkPods                                   |
+    |   Purpose:    The subsystems' startup checks, none of them wait. The groundstation is |
+    |               asked for by recievePacketsUDP, the GPS's dynamic model is set by       |
+    |               feedReceiver (through getLockStatus). The SD card and camera were       |
+    |               found when they were set up, and the BME is started on its only poll.   |
+    |   Arguments:  void                                                                    |
+    |   Returns:    StartupStatus                                                           |
+    \*-------------------------------------------------------------------------------------*/
+        StartupStatus checkNetwork(){
+            if(Ethernet.hardwareStatus() == EthernetNoHardware){ return STARTUP_FAILED; }
+            return (_conn.begin(LOCAL_PORT) ? STARTUP_READY : STARTUP_PENDING);
+        }
+        StartupStatus checkGroundstation(){
+            if(Ethernet.hardwareStatus() == EthernetNoHardware){ return STARTUP_FAILED; }
+            return (noConnection ? STARTUP_PENDING : STARTUP_READY);
+        }
+        StartupStatus checkLogging(){
+            return (HAB_Logging::getStatus() ? STARTUP_READY : STARTUP_FAILED);
+        }
+        StartupStatus checkCamera(){
+            return (_cam->getReadyStatus() ? STARTUP_READY : STARTUP_FAILED);
+        }
+        StartupStatus checkBME(){
+            BMPstatus = (_bme.begin() && _bme.setSampling(BME_OVERSAMPLING_T, BME_OVERSAMPLING_P, BME_OVERSAMPLING_H, BME_FILTER));
+            return (BMPstatus ? STARTUP_READY : STARTUP_FAILED);
+        }
+        StartupStatus checkGPSMode(){
+            _gps->feedReceiver();
+            if(_gps->isModePending()){ return STARTUP_PENDING; }
+            return (_gps->isModeSet() ? STARTUP_READY : STARTUP_FAILED);
+        }
+        StartupStatus checkGPSLock(){
+            //Either position source will do
+            return ((_gps->getLockStatus() || !noGPS01Connection) ? STARTUP_READY : STARTUP_PENDING);
+        }
+        StartupStatus checkPods(){
+            for(int i = 0; i != act_arr_len; i++){
+                if(!_actArray[i].isClosed()){ return STARTUP_PENDING; }
+            }
+            return STARTUP_READY;
         }
@@ -0,0 +1,83 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : image_downlink.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : Reassembles the images the balloon downlinks in chunks, for the groundstation server. It has no GUI or
+#                    socket of its own, so it can be run over loopback by the tests.
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import os
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                Image downlink                                             |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+class ImageAssembler:
+    #Reassembles images sent in chunks, and asks for any missing chunks.
+    #send_command is called with the command text, so this can be run over loopback without the GUI.
+    def __init__(self, send_command, directory="images"):
+        self.send_command = send_command
+        self.directory = directory
+        self.images = {}
+
+    def handle_chunk(self, packet):
+        #Format: [IMAGE]<id>,<chunk>,<count>,<binary data>
+        header = packet[len(b"[IMAGE]"):].split(b",", 3)
+        image_id, chunk, count = int(header[0]), int(header[1]), int(header[2])
+        image = self.images.setdefault(image_id, {"count": count, "chunks": {}, "done": False})
+        image["chunks"][chunk] = header[3]
+
+    def handle_end(self, message_text):
+        #Format: [IMGEND]<id>,<count>,<size>,<name>
+        fields = message_text[len("[IMGEND]"):].split(",", 3)
+        image_id, count, size, name = int(fields[0]), int(fields[1]), int(fields[2]), fields[3].strip("\0\r\n")
+        image = self.images.setdefault(image_id, {"count": count, "chunks": {}, "done": False})
+
+        #The name comes off the link, so only its last part is kept to stay inside the directory
+        name = os.path.basename(name.replace("\\", "/"))
+        if(name in ("", ".", "..")):
+            print("Image " + str(image_id) + " has no usable name, not saved")
+            return None
+
+        #Already saved, the acknowledgement was lost
+        if(image["done"]):
+            self.send_command("IMG_ACK " + str(image_id))
+            return None
+
+        missing = self.missing_ranges(image_id, count)
+        if(missing):
+            for first, last in missing:
+                self.send_command("IMG_NACK " + str(image_id) + " " + str(first) + ("-" + str(last) if last != first else ""))
+            return None
+
+        #Complete, saves the image
+        data = b"".join(image["chunks"][i] for i in range(count))[:size]
+        os.makedirs(self.directory, exist_ok=True)
+        path = os.path.join(self.directory, name)
+        with open(path, "wb") as imageFile:
+            imageFile.write(data)
+        image["done"] = True
+        image["chunks"] = {}
+        self.send_command("IMG_ACK " + str(image_id))
+        return path
+
+    def missing_ranges(self, image_id, count):
+        chunks = self.images[image_id]["chunks"]
+        ranges = []
+        first = None
+        for i in range(count + 1):
+            if(i < count and i not in chunks):
+                if(first is None):
+                    first = i
+            elif(first is not None):
+                ranges.append((first, i - 1))
+                first = None
+        return ranges
@@ -13,21 +13,47 @@
 	#include "HAB_Actuator.h"
 
 
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Thermistor temperature (hundredths of a degree C) every THERMISTOR_TABLE_STEP ADC counts,
+	//from the B equation. Within 0.14C between -40C and 60C once interpolated.
+	static const int16_t thermistorTable[1024 / THERMISTOR_TABLE_STEP + 1] PROGMEM = {
+		32767, 19680, 16062, 14178, 12928, 12002, 11270, 10668,
+		10156, 9713, 9322, 8973, 8657, 8369, 8104, 7858,
+		7630, 7416, 7215, 7025, 6845, 6675, 6512, 6356,
+		6207, 6064, 5927, 5794, 5666, 5542, 5422, 5306,
+		5192, 5082, 4975, 4871, 4769, 4669, 4572, 4477,
+		4383, 4291, 4201, 4113, 4026, 3941, 3857, 3774,
+		3692, 3611, 3532, 3453, 3375, 3298, 3222, 3147,
+		3072, 2998, 2925, 2852, 2780, 2708, 2637, 2566,
+		2496, 2425, 2355, 2286, 2216, 2147, 2078, 2009,
+		1940, 1871, 1802, 1734, 1665, 1596, 1526, 1457,
+		1388, 1318, 1248, 1177, 1107, 1036, 964, 892,
+		819, 746, 672, 597, 521, 445, 367, 289,
+		209, 129, 47, -37, -122, -209, -297, -388,
+		-481, -576, -673, -774, -878, -985, -1096, -1211,
+		-1332, -1458, -1590, -1729, -1876, -2033, -2202, -2385,
+		-2584, -2806, -3055, -3341, -3682, -4108, -4687, -5643,
+		-7739
+	};
+
+
 //--------------------------------------------------------------------------\
 //								  Constructor					   			|
 //--------------------------------------------------------------------------/
 
 
-	HAB_Actuator::HAB_Actuator(const char* namePtr, uint8_t act_en, uint8_t act_push, uint8_t act_pull,
-		uint8_t act_pos, uint8_t heat_en, uint8_t thermistor, double openAlt, double closeAlt
+	//Pins switched by a driver, normally a HAB_PodPins so they are written directly to the port
+	HAB_Actuator::HAB_Actuator(const char* namePtr, HAB_PodDriver* driver, uint8_t act_pos, uint8_t thermistor,
+		Centimetres openAlt, Centimetres closeAlt
 	){
 		//Sets the variables
 		strcpy(this->namePtr, namePtr);
-		this->act_en = act_en;
-		this->act_push = act_push;
-		this->act_pull = act_pull;
+		this->driver = driver;
 		this->act_pos = act_pos;
-		this->heat_en = heat_en;
 		this->thermistor = thermistor;
 		this->openAlt = openAlt;
 		this->closeAlt = closeAlt;
@@ -40,14 +66,21 @@
 		heaterOverride = false;
 		heaterOverrideEnabled = false;
 		
+		//Both ask the power arbiter before switching on
+		actuatorLoad = HAB_Power::addLoad(POWER_ACTUATOR, this->namePtr);
+		heaterLoad = HAB_Power::addLoad(POWER_HEATER, this->namePtr);
+		
 		//Sets the pins
-		pinMode(heat_en,       OUTPUT);
-		pinMode(act_en,        OUTPUT);
-		pinMode(act_push,      OUTPUT);
-		pinMode(act_pull,      OUTPUT);
+		driver->begin();
 		pinMode(thermistor,    INPUT);
 		pinMode(act_pos,       INPUT);
 	}
+
+	//Pins only known at run time, switched with digitalWrite
+	HAB_Actuator::HAB_Actuator(const char* namePtr, uint8_t act_en, uint8_t act_push, uint8_t act_pull,
+		uint8_t act_pos, uint8_t heat_en, uint8_t thermistor, Centimetres openAlt, Centimetres closeAlt
+	) : HAB_Actuator(namePtr, new HAB_PodDriver(heat_en, act_en, act_push, act_pull), act_pos, thermistor, openAlt, closeAlt){
+	}
 	
 	
 //--------------------------------------------------------------------------\
@@ -72,9 +105,9 @@
 		| 	Name: 		getOpenAlt																|
 		|	Purpose: 	Gets the opening altitude of the actuator.								|
 		|	Arguments:	void																	|
-		|	Returns:	double																	|
+		|	Returns:	Centimetres																|
 		\*-------------------------------------------------------------------------------------*/
-			double HAB_Actuator::getOpenAlt(){
+			Centimetres HAB_Actuator::getOpenAlt(){
 				return openAlt;
 			}
 			
@@ -82,9 +115,9 @@
 		| 	Name: 		getCloseAlt																|
 		|	Purpose: 	Gets the closing altitude of the actuator.								|
 		|	Arguments:	void																	|
-		|	Returns:	double																	|
+		|	Returns:	Centimetres																|
 		\*-------------------------------------------------------------------------------------*/
-			double HAB_Actuator::getCloseAlt(){
+			Centimetres HAB_Actuator::getCloseAlt(){
 				return closeAlt;
 			}
 		
@@ -133,7 +166,7 @@
 				uint16_t reading = analogRead(act_pos);	
 
 				//return (pos >= POD_CLOSED);
-				return (reading >= POD_CLOSED);
+				return (reading >= closedLimit);
 			}
 	
 		/*-------------------------------------------------------------------------------------*\
@@ -143,34 +176,28 @@
 		|	Returns:	boolean																	|
 		\*-------------------------------------------------------------------------------------*/
 			bool HAB_Actuator::isFullyOpen(){
-				unsigned int reading = analogRead(act_pos); //Check trend at all?
+				unsigned int reading = analogRead(act_pos); //The trend is followed by the motion tracker
 				
 				//return (pos <= POD_OPEN);
-				return (reading <= POD_OPEN);
+				return (reading <= openLimit);
 			}
 						
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		getTemperature															|
-		|	Purpose: 	Returns the temperature read by the thermistor.							|
+		|	Purpose: 	Returns the temperature read by the thermistor, interpolated from the	|
+		|				lookup table rather than taking a log in software floating point.		|
 		|	Arguments:	void																	|
-		|	Returns:	float																	|
+		|	Returns:	CentiCelsius															|
 		\*-------------------------------------------------------------------------------------*/
-			float HAB_Actuator::getTemperature(){
+			CentiCelsius HAB_Actuator::getTemperature(){
 				//Get reading
-				float reading = analogRead(thermistor);
-				reading = (1023 / reading)  - 1;     // (1023/ADC - 1) 
-				reading = SERIESRESISTOR / reading;  // 10K / (1023/ADC - 1)
-
-				//Get temperature
-				float temp;
-				temp = reading / THERMISTORNOMINAL;     	// (R/Ro)
-				temp = log(temp);                  			// ln(R/Ro)
-				temp /= BCOEFFICIENT;                   	// 1/B * ln(R/Ro)
-				temp += 1.0 / (TEMPERATURENOMINAL + 273.15);// + (1/To)
-				temp = 1.0 / temp;                 			// Invert
-				temp -= 273.15;                         	// convert to C
-				
-				return temp;
+				uint16_t reading = analogRead(thermistor);
+				uint8_t index = reading / THERMISTOR_TABLE_STEP;
+
+				//Interpolates between the entries either side
+				int16_t low = pgm_read_word(&thermistorTable[index]);
+				int16_t high = pgm_read_word(&thermistorTable[index + 1]);
+				return CentiCelsius(low + (int16_t)(((int32_t)(high - low) * (reading % THERMISTOR_TABLE_STEP)) / THERMISTOR_TABLE_STEP));
 			}
 			
 		/*-------------------------------------------------------------------------------------*\
@@ -186,10 +213,10 @@
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		isInInterval															|
 		|	Purpose: 	Returns true if the provided altitude is within the actuator's inteval. |
-		|	Arguments:	float																	|
+		|	Arguments:	Centimetres																|
 		|	Returns:	bool																	|
 		\*-------------------------------------------------------------------------------------*/
-			bool HAB_Actuator::isInInterval(float altitude){
+			bool HAB_Actuator::isInInterval(Centimetres altitude){
 				//If open < close
 				if(openAlt < closeAlt){
 					return (altitude >= openAlt && altitude < closeAlt);
@@ -233,6 +260,87 @@
 				return locked;
 			}
 			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMotionStatus															|
+		|	Purpose: 	Returns whether the actuator is moving, or how its last travel ended.	|
+		|	Arguments:	none																	|
+		|	Returns:	MotionStatus															|
+		\*-------------------------------------------------------------------------------------*/
+			MotionStatus HAB_Actuator::getMotionStatus(){
+				return motion.getStatus();
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTravelTime															|
+		|	Purpose: 	Returns how long the last travel took to reach its limit (ms).			|
+		|	Arguments:	none																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Actuator::getTravelTime(){
+				return motion.getTravelTime();
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isTravelDone															|
+		|	Purpose: 	Returns true once the actuator has reached its limit and settled, or	|
+		|				has been pushed past it for the given time (ms).						|
+		|	Arguments:	unsigned long															|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Actuator::isTravelDone(unsigned long maxPushTime){
+				return motion.isDone(maxPushTime);
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getOpenLimit															|
+		|	Purpose: 	Returns the position at or below which the pod is fully open.			|
+		|	Arguments:	none																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Actuator::getOpenLimit(){
+				return openLimit;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getClosedLimit															|
+		|	Purpose: 	Returns the position at or above which the pod is closed.				|
+		|	Arguments:	none																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Actuator::getClosedLimit(){
+				return closedLimit;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getThermal																|
+		|	Purpose: 	Returns the heater model, for reporting its fit.						|
+		|	Arguments:	none																	|
+		|	Returns:	HAB_Thermal*															|
+		\*-------------------------------------------------------------------------------------*/
+			HAB_Thermal* HAB_Actuator::getThermal(){
+				return &thermal;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHeaterDuty															|
+		|	Purpose: 	Returns the heater duty of the current step (percent).					|
+		|	Arguments:	none																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Actuator::getHeaterDuty(){
+				return dutyTime * 100 / THERMAL_STEP;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHeaterEnergy															|
+		|	Purpose: 	Returns the energy the heater has used since startup (J).				|
+		|	Arguments:	none																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Actuator::getHeaterEnergy(){
+				return heaterOnTime / 1000 * HEATER_POWER;
+			}
+			
 	
 	//--------------------------------------------------------------------------------\
 	//Setters-------------------------------------------------------------------------|
@@ -251,20 +359,20 @@
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		setOpenAltitude															|
 		|	Purpose: 	Sets the actuator's opening altitude.									|
-		|	Arguments:	double																	|
+		|	Arguments:	Centimetres																|
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Actuator::setOpenAltitude(double openAlt){
+			void HAB_Actuator::setOpenAltitude(Centimetres openAlt){
 				this->openAlt = openAlt;
 			}
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		setCloseAltitude														|
 		|	Purpose: 	Sets the actuator's closing altitude.									|
-		|	Arguments:	double																	|
+		|	Arguments:	Centimetres																|
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Actuator::setCloseAltitude(double closeAlt){
+			void HAB_Actuator::setCloseAltitude(Centimetres closeAlt){
 				this->closeAlt = closeAlt;
 			}
 			
@@ -288,50 +396,77 @@
 				this->locked = locked;
 			}
 
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setLimits																|
+		|	Purpose: 	Sets the positions at which the pod counts as fully open and closed.	|
+		|	Arguments:	uint16_t, uint16_t														|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Actuator::setLimits(uint16_t openLimit, uint16_t closedLimit){
+				this->openLimit = openLimit;
+				this->closedLimit = closedLimit;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setCalibrating															|
+		|	Purpose: 	While set, travels only end when the actuator stops (shown as			|
+		|				MOTION_STALLED), so it reaches its real stops. Clearing it clears		|
+		|				that status.															|
+		|	Arguments:	bool																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Actuator::setCalibrating(bool calibrating){
+				this->calibrating = calibrating;
+				if(!calibrating){ motion.clear(); }
+			}
+
 	//--------------------------------------------------------------------------------\
 	//Miscellaneous-------------------------------------------------------------------|	
 		
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		extend																	|
-		|	Purpose: 	Extends the actuator to its maximum length.								|
+		|	Purpose: 	Extends the actuator to its maximum length. False if the power		|
+		|				arbiter deferred it, it should be asked again next loop.				|
 		|	Arguments:	void																	|
 		|	Returns:	boolean																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Actuator::extend(){
-				//Enables the actuator
-				digitalWrite(act_en, HIGH);
+			bool HAB_Actuator::extend(){
+				if(!HAB_Power::acquire(actuatorLoad)){ return false; }
+				
+				//Enables the actuator and moves it, in one write
+				driver->drive(true, true, false);
 				this->moveEnabled = true;
 				
 				this->isMovingOpen = false;
-				
-				//Moves the actuator
-				digitalWrite(act_push, HIGH);
-				digitalWrite(act_pull, LOW);
+				motion.start(getPosition());
 				HAB_Logging::printLog("Started extending actuator of ");
 				HAB_Logging::printLog(this->getName(), "");
 				HAB_Logging::printLogln(" (Closing)", "");
+				return true;
 			}
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		retract																	|
-		|	Purpose: 	Retracts the actuator to its minimum length.							|
+		|	Purpose: 	Retracts the actuator to its minimum length. False if the power		|
+		|				arbiter deferred it, it should be asked again next loop.				|
 		|	Arguments:	void																	|
-		|	Returns:	void																	|
+		|	Returns:	boolean																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Actuator::retract(){				
-				//Enables the actuator
-				digitalWrite(act_en, HIGH);
+			bool HAB_Actuator::retract(){
+				if(!HAB_Power::acquire(actuatorLoad)){ return false; }
+				
+				//Enables the actuator and moves it, in one write
+				driver->drive(true, false, true);
 				this->moveEnabled = true;
 				
 				this->isMovingOpen = true;
+				motion.start(getPosition());
 				
-				//Moves the actuator
-				digitalWrite(act_push, LOW);
-				digitalWrite(act_pull, HIGH);
 				hasOpened = true; //Set upon retraction so that it does not reopen
 				HAB_Logging::printLog("Started retracting actuator of ");
 				HAB_Logging::printLog(this->getName(), "");
 				HAB_Logging::printLogln(" (Opening)", "");
+				return true;
 			}
 		
 		/*-------------------------------------------------------------------------------------*\
@@ -341,17 +476,27 @@
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_Actuator::halt(){
-				//Disables the actuator
-				digitalWrite(act_en, LOW);
+				//Disables and halts the actuator
+				driver->drive(false, false, false);
 				this->moveEnabled = false;
-				
-				//Halts the actuator
-				digitalWrite(act_push, LOW);
-				digitalWrite(act_pull, LOW);
+				motion.stop();
+				HAB_Power::release(actuatorLoad);
 				HAB_Logging::printLog("Halted actuator of ");
 				HAB_Logging::printLogln(this->getName(), "");
 			}	
 
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		updateMotion															|
+		|	Purpose: 	While moving, reads the position when the motion tracker is due one.	|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Actuator::updateMotion(){
+				if(!moveEnabled || !motion.isSampleDue()){ return; }
+				uint16_t position = getPosition();
+				motion.update(position, !calibrating && (isMovingOpen ? position <= openLimit : position >= closedLimit));
+			}
+
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		overrideActuatorHalt													|
 		|	Purpose: 	Halts movement of the actuator, dsiables any overrides.					|
@@ -359,17 +504,15 @@
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_Actuator::overrideActuatorHalt(){
-				//Disables the actuator
-				digitalWrite(act_en, LOW);
+				//Disables and halts the actuator
+				driver->drive(false, false, false);
 				this->moveEnabled = false;
+				motion.stop();
+				HAB_Power::release(actuatorLoad);
 				
 				//Disables any overrides
 				actuatorOverride = false;
 				actuatorOverrideOpen = false;
-				
-				//Halts the actuator
-				digitalWrite(act_push, LOW);
-				digitalWrite(act_pull, LOW);
 				HAB_Logging::printLog("Halted actuator of ");
 				HAB_Logging::printLogln(this->getName(), "");
 			}				
@@ -384,6 +527,7 @@
 				actuatorOverride = true;
 				actuatorOverrideOpen = true;
 				hasOpened = true;
+				motion.clear(); //A stalled actuator is tried again
 				HAB_Logging::printLog("Actuator of ");
 				HAB_Logging::printLog(this->getName(), "");
 				HAB_Logging::printLogln(" overridden to OPEN state", "");
@@ -398,6 +542,7 @@
 			void HAB_Actuator::overrideActuatorClose(){
 				actuatorOverride = true;
 				actuatorOverrideOpen = false;
+				motion.clear();
 				HAB_Logging::printLog("Actuator of ");
 				HAB_Logging::printLog(this->getName(), "");
 				HAB_Logging::printLogln(" overridden to CLOSED state", "");
@@ -439,18 +584,32 @@
 			bool HAB_Actuator::isActuatorOverrideOpen(){
 				return actuatorOverrideOpen;
 			}	
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getActuatorStatus														|
+		|	Purpose: 	Returns the actuator override as a status code.							|
+		|	Arguments:	void																	|
+		|	Returns:	ActuatorStatus															|
+		\*-------------------------------------------------------------------------------------*/
+			ActuatorStatus HAB_Actuator::getActuatorStatus(){
+				if(!actuatorOverride){ return ACT_AUTO; }
+				return (actuatorOverrideOpen ? ACT_OVR_OPEN : ACT_OVR_CLOSE);
+			}
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		startHeating															|
-		|	Purpose: 	Starts the heating of the actuator.										|
+		|	Purpose: 	Starts the heating of the actuator. False if the power arbiter			|
+		|				deferred it.															|
 		|	Arguments:	void																	|
-		|	Returns:	void																	|
+		|	Returns:	boolean																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Actuator::startHeating(){
-				digitalWrite(heat_en, HIGH);
+			bool HAB_Actuator::startHeating(){
+				if(!HAB_Power::acquire(heaterLoad)){ return false; }
+				driver->setHeating(true);
 				heatEnabled = true;
 				HAB_Logging::printLog("Started heating ");
 				HAB_Logging::printLogln(this->getName(), "");
+				return true;
 			}
 			
 		/*-------------------------------------------------------------------------------------*\
@@ -460,8 +619,9 @@
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_Actuator::stopHeating(){
-				digitalWrite(heat_en, LOW);
+				driver->setHeating(false);
 				heatEnabled = false;
+				HAB_Power::release(heaterLoad);
 				HAB_Logging::printLog("Stopped heating ");
 				HAB_Logging::printLogln(this->getName(), "");
 			}	
@@ -527,6 +687,105 @@
 			bool HAB_Actuator::isHeaterOverrideEnabled(){
 				return heaterOverrideEnabled;
 			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHeaterStatus															|
+		|	Purpose: 	Returns the heater override as a status code.							|
+		|	Arguments:	void																	|
+		|	Returns:	HeaterStatus															|
+		\*-------------------------------------------------------------------------------------*/
+			HeaterStatus HAB_Actuator::getHeaterStatus(){
+				if(!heaterOverride){ return HEAT_AUTO; }
+				return (heaterOverrideEnabled ? HEAT_OVR_ENABLED : HEAT_OVR_DISABLED);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		updateHeating															|
+		|	Purpose: 	Runs the heater, called every loop with the latest readings. The		|
+		|				heater pins are not PWM pins, and the actuator is slow, so the duty		|
+		|				is applied as on time at the start of each THERMAL_STEP, made up later	|
+		|				in the step if the power arbiter holds it off. At each step				|
+		|				the model is fitted to the last one and the next duty is chosen:		|
+		|				holding the target from when pre-heating has to start to reach it		|
+		|				as the interval arrives, else just THERMAL_SURVIVAL_TEMP. Without an	|
+		|				ambient reading the model is not fitted. An override wins.				|
+		|	Arguments:	CentiCelsius, CentiCelsius, bool, Centimetres, CentimetresPerSecond,	|
+		|				CentiCelsius															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Actuator::updateHeating(CentiCelsius temperature, CentiCelsius ambient, bool haveAmbient, Centimetres altitude,
+				CentimetresPerSecond climbRate, CentiCelsius target
+			){
+				unsigned long now = millis();
+				if(heatEnabled){ heaterOnTime += now - lastHeatUpdate; }
+				lastHeatUpdate = now;
+
+				//Overridden, the step starts over once released
+				if(heaterOverride){
+					setHeater(heaterOverrideEnabled);
+					stepValid = false;
+					return;
+				}
+
+				//Within a step
+				if(stepValid && (now - stepStart) < THERMAL_STEP){
+					setHeater((heaterOnTime - stepOnStart) < dutyTime);
+					return;
+				}
+
+				//Fits the step just finished, with the on time it actually got
+				float celsius = toFloat(temperature);
+				float ambientCelsius = (haveAmbient ? toFloat(ambient) : celsius);
+				if(stepValid && haveAmbient){
+					thermal.update(stepTemperature, stepAmbient, (float)(heaterOnTime - stepOnStart) / THERMAL_STEP, celsius);
+				}
+
+				//Next step's duty
+				float setpoint = (isHeatingNeeded(celsius, ambientCelsius, toFloat(target), altitude, climbRate) ? toFloat(target) : THERMAL_SURVIVAL_TEMP);
+				dutyTime = thermal.getDuty(celsius, ambientCelsius, setpoint) * THERMAL_STEP;
+				if(dutyTime < THERMAL_MIN_ON){ dutyTime = 0; }
+				stepStart = now;
+				stepOnStart = heaterOnTime;
+				stepTemperature = celsius;
+				stepAmbient = ambientCelsius;
+				stepValid = true;
+				setHeater(dutyTime > 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isHeatingNeeded															|
+		|	Purpose: 	Returns true if the actuator should be at its target: within its		|
+		|				interval, or when heating flat out would only just get it there (with	|
+		|				THERMAL_PREHEAT_MARGIN to spare) before the climb reaches the interval.	|
+		|	Arguments:	float, float, float, Centimetres, CentimetresPerSecond					|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Actuator::isHeatingNeeded(float temperature, float ambient, float target, Centimetres altitude, CentimetresPerSecond climbRate){
+				if(isInInterval(altitude)){ return true; }
+				if(hasOpened || altitude >= openAlt || climbRate.value() < THERMAL_MIN_CLIMB){ return false; }
+
+				float timeToInterval = (float)(openAlt - altitude).value() / climbRate.value();
+				return timeToInterval <= thermal.getTimeToReach(temperature, ambient, target) + THERMAL_PREHEAT_MARGIN;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setHeater																|
+		|	Purpose: 	Switches the heater if it is not already, without logging each switch.	|
+		|				It is only switched on once the power arbiter grants it, and off again	|
+		|				when the arbiter takes its turn away.									|
+		|	Arguments:	bool																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Actuator::setHeater(bool on){
+				if(on){
+					if(heatEnabled && !HAB_Power::isGranted(heaterLoad)){ on = false; } //Its turn is up
+					else if(!heatEnabled && !HAB_Power::acquire(heaterLoad)){ return; } //Deferred, asked again next loop
+				}
+				if(!on){ HAB_Power::release(heaterLoad); }
+				if(on == heatEnabled){ return; }
+				driver->setHeating(on);
+				heatEnabled = on;
+			}
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		deactivateAll															|
@@ -535,17 +794,16 @@
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_Actuator::deactivateAll(){
-				//Disables the actuator
-				digitalWrite(act_en, LOW);
+				//Disables and halts the actuator
+				driver->drive(false, false, false);
 				this->moveEnabled = false;
-				
-				//Halts the actuator
-				digitalWrite(act_push, LOW);
-				digitalWrite(act_pull, LOW);
+				motion.stop();
 				
 				//Disables the heater
-				digitalWrite(heat_en, LOW);
+				driver->setHeating(false);
 				heatEnabled = false;
+				HAB_Power::release(actuatorLoad);
+				HAB_Power::release(heaterLoad);
 				
 				//Disable overrides
 				actuatorOverride = false;
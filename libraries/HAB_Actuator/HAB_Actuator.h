@@ -18,6 +18,12 @@
 	#include "Arduino.h"
 	#include <Wire.h>
 	#include <SPI.h>
+	#include <HAB_Fixed.h>
+	#include <HAB_Structs.h>
+	#include <HAB_PodDriver.h>
+	#include <HAB_Motion.h>
+	#include <HAB_Thermal.h>
+	#include <HAB_Power.h>
 	#ifndef HAB_Logging_h
         #include <HAB_Logging.h>
     #endif
@@ -30,6 +36,7 @@ class HAB_Actuator {
 	//--------------------------------------------------------------------------/
 		private:
 		
+		//Default limits, until the pod is calibrated (see HAB_Calibration)
 		#ifndef POD_OPEN
 			#define POD_OPEN 10 //10 //0 most open
 		#endif
@@ -37,10 +44,29 @@ class HAB_Actuator {
 			#define POD_CLOSED 1020 //1020 //1023 most closed, give some leeway here
 		#endif
 		
+		//Thermistor the lookup table in the .cpp was generated for
 		#define SERIESRESISTOR 10000  
 		#define THERMISTORNOMINAL 10000   
 		#define TEMPERATURENOMINAL 25 
 		#define BCOEFFICIENT 3950
+		#define THERMISTOR_TABLE_STEP 8 //ADC counts between table entries
+		
+		//Heating
+		#ifndef HEATER_POWER
+			#define HEATER_POWER 5 //W, of each pod's heater
+		#endif
+		#ifndef THERMAL_SURVIVAL_TEMP
+			#define THERMAL_SURVIVAL_TEMP -30 //C, held outside the interval so the actuator does not freeze
+		#endif
+		#ifndef THERMAL_MIN_CLIMB
+			#define THERMAL_MIN_CLIMB 50 //cm/s, slower than this the interval's arrival is not predicted
+		#endif
+		#ifndef THERMAL_PREHEAT_MARGIN
+			#define THERMAL_PREHEAT_MARGIN 300 //s early the pre-heating aims to reach the target
+		#endif
+		#ifndef THERMAL_MIN_ON
+			#define THERMAL_MIN_ON 200 //ms, shorter heater pulses are dropped
+		#endif
 	
 	
 	//--------------------------------------------------------------------------\
@@ -50,15 +76,15 @@ class HAB_Actuator {
 		//Actuator name
 		char namePtr[10] = "";
 		
-		//Actuator pins
-		uint8_t act_en, act_push, act_pull, act_pos;
-		uint8_t heat_en, thermistor;
+		//Actuator pins, the outputs are switched by the driver
+		HAB_PodDriver* driver;
+		uint8_t act_pos, thermistor;
 		
 		//Enables statuses
 		bool moveEnabled, heatEnabled;
 		
 		//Opening and closing altitudes
-		double openAlt, closeAlt;
+		Centimetres openAlt, closeAlt;
 		
 		//If pod has opened already
 		bool hasOpened;
@@ -76,6 +102,32 @@ class HAB_Actuator {
 		//If use of the actuator is loked
 		bool locked = false;
 		
+		//Follows each travel from the position readings
+		HAB_Motion motion;
+		
+		//Positions at which the pod counts as fully open and closed
+		uint16_t openLimit = POD_OPEN;
+		uint16_t closedLimit = POD_CLOSED;
+		
+		//While calibrating the limits are ignored, so it travels to its stops
+		bool calibrating = false;
+		
+		//Heater model and its current step, the heater is on for dutyTime of each, from its start
+		//or, when it has to take turns for power, as soon as it gets it
+		HAB_Thermal thermal;
+		unsigned long stepStart = 0;
+		unsigned long dutyTime = 0;
+		uint32_t stepOnStart = 0;
+		float stepTemperature, stepAmbient;
+		bool stepValid = false;
+		
+		//Heater on time (ms), for the energy used
+		uint32_t heaterOnTime = 0;
+		unsigned long lastHeatUpdate = 0;
+		
+		//Power arbiter loads, the actuator and heater each ask before switching on
+		uint8_t actuatorLoad, heaterLoad;
+		
 		
 		
 		//TESTING
@@ -88,8 +140,11 @@ class HAB_Actuator {
 	//--------------------------------------------------------------------------/
 		public:
 	
+		HAB_Actuator(const char* namePtr, HAB_PodDriver* driver, uint8_t act_pos, uint8_t thermistor,
+				Centimetres openAlt, Centimetres closeAlt
+		);
 		HAB_Actuator(const char* namePtr, uint8_t act_en, uint8_t act_push, uint8_t act_pull,
-				uint8_t act_pos, uint8_t heat_en, uint8_t thermistor, double openAlt, double closeAlt
+				uint8_t act_pos, uint8_t heat_en, uint8_t thermistor, Centimetres openAlt, Centimetres closeAlt
 		);
 		
 		
@@ -101,52 +156,72 @@ class HAB_Actuator {
 		//--------------------------------------------------------------------------------\
 		//Getters-------------------------------------------------------------------------|
 			char* getName();
-			double getOpenAlt();
-			double getCloseAlt();
+			Centimetres getOpenAlt();
+			Centimetres getCloseAlt();
 			uint16_t getPosition();			
 			bool isMoveEnabled();
 			bool isHeatEnabled();				
 			bool isClosed();
 			bool isFullyOpen();
-			float getTemperature();			
+			CentiCelsius getTemperature();
 			bool getHasOpened();
-			bool isInInterval(float altitude);
+			bool isInInterval(Centimetres altitude);
 			bool isOpening();
 			bool isLocked();
+			MotionStatus getMotionStatus();
+			uint32_t getTravelTime();
+			bool isTravelDone(unsigned long maxPushTime);
+			uint16_t getOpenLimit();
+			uint16_t getClosedLimit();
+			HAB_Thermal* getThermal();
+			uint8_t getHeaterDuty();
+			uint32_t getHeaterEnergy();
 		
 		
 		//--------------------------------------------------------------------------------\
 		//Setters-------------------------------------------------------------------------|
 			//void setMoveEnabled(boolean moveEnabled); //Is this needed in the new setup?
-			void setOpenAltitude(double openAlt);
-			void setCloseAltitude(double closeAlt);
+			void setOpenAltitude(Centimetres openAlt);
+			void setCloseAltitude(Centimetres closeAlt);
 			void setHasOpened(bool hasOpened);
 			void setLock(bool locked);
+			void setLimits(uint16_t openLimit, uint16_t closedLimit);
+			void setCalibrating(bool calibrating);
 		
 		
 		//--------------------------------------------------------------------------------\
 		//Miscellaneous-------------------------------------------------------------------|
 			//Actuator
-			void extend();
-			void retract();
+			bool extend();
+			bool retract();
 			void halt();
+			void updateMotion();
 			void overrideActuatorHalt();
 			void overrideActuatorOpen(); //The overrides don't actually modify the outputs, it just modifies the booleans for you to read and make decisions from. Perhaps change this later.
 			void overrideActuatorClose();
 			void overrideActuatorRelease();
 			bool isActuatorOverridden();
 			bool isActuatorOverrideOpen();
+			ActuatorStatus getActuatorStatus();
 			
 			//Heater
 			void stopHeating();
-			void startHeating();
+			bool startHeating();
 			void overrideHeaterEnable();
 			void overrideHeaterDisable();
 			void overrideHeaterRelease();
 			bool isHeaterOverridden();
 			bool isHeaterOverrideEnabled();
+			HeaterStatus getHeaterStatus();
+			void updateHeating(CentiCelsius temperature, CentiCelsius ambient, bool haveAmbient, Centimetres altitude,
+				CentimetresPerSecond climbRate, CentiCelsius target
+			);
 			
 			void deactivateAll();
+			
+		private:
+			void setHeater(bool on);
+			bool isHeatingNeeded(float temperature, float ambient, float target, Centimetres altitude, CentimetresPerSecond climbRate);
 };
 
 #endif
\ No newline at end of file
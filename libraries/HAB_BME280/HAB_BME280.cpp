@@ -0,0 +1,296 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to run the BME280 in forced mode over I2C. A conversion is
+*				started and collected later in a single burst read, so the loop never waits on it,
+*				and the readings are compensated in fixed point as in the datasheet.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_BME280.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_BME280::HAB_BME280(uint8_t address){
+		this->address = address;
+		memset(&calib, 0, sizeof(calib));
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isMeasuring																|
+		|	Purpose: 	Returns true while a conversion has been started but not collected.	|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::isMeasuring(){
+				return measuring;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSampleTime															|
+		|	Purpose: 	Returns the millis() the last collected conversion was started at.		|
+		|	Arguments:	void																	|
+		|	Returns:	unsigned long															|
+		\*-------------------------------------------------------------------------------------*/
+			unsigned long HAB_BME280::getSampleTime(){
+				return sampleTime;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getConversionTime														|
+		|	Purpose: 	Returns the worst case conversion time (ms) of the current settings.	|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_BME280::getConversionTime(){
+				return conversionTime;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTemperature															|
+		|	Purpose: 	Returns the last temperature, in hundredths of a degree C.				|
+		|	Arguments:	void																	|
+		|	Returns:	int32_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			int32_t HAB_BME280::getTemperature(){
+				return temperature;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPressure																|
+		|	Purpose: 	Returns the last pressure, in Pa as Q24.8 (divide by 256).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_BME280::getPressure(){
+				return pressure;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHumidity																|
+		|	Purpose: 	Returns the last relative humidity, in percent as Q22.10				|
+		|				(divide by 1024).														|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_BME280::getHumidity(){
+				return humidity;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setSampling																|
+		|	Purpose: 	Sets the oversampling of each reading (BME_OS_x) and the IIR filter		|
+		|				(BME_FILTER_x). Temperature can't be skipped, the others need it.		|
+		|	Arguments:	uint8_t, uint8_t, uint8_t, uint8_t										|
+		|	Returns:	bool (false if out of range, measuring, or not written)					|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::setSampling(uint8_t osrsT, uint8_t osrsP, uint8_t osrsH, uint8_t filter){
+				if(osrsT == BME_OS_SKIP || osrsT > BME_OS_16 || osrsP > BME_OS_16 || osrsH > BME_OS_16 || filter > BME_FILTER_16 || measuring){
+					return false;
+				}
+				this->osrsT = osrsT;
+				this->osrsP = osrsP;
+				this->osrsH = osrsH;
+				this->filter = filter;
+
+				//Worst case from the datasheet (appendix B), in us
+				uint8_t countT = 1 << (osrsT - 1);
+				uint8_t countP = (osrsP ? 1 << (osrsP - 1) : 0);
+				uint8_t countH = (osrsH ? 1 << (osrsH - 1) : 0);
+				uint32_t time = 1250 + 2300 * (uint32_t)countT;
+				if(countP){ time += 2300 * (uint32_t)countP + 575; }
+				if(countH){ time += 2300 * (uint32_t)countH + 575; }
+				conversionTime = (time + 999) / 1000;
+
+				//Config is only written in sleep mode, ctrl_hum only takes effect after ctrl_meas
+				return writeRegister(BME_REG_CTRL_HUM, osrsH)
+					&& writeRegister(BME_REG_CONFIG, filter << 2)
+					&& writeRegister(BME_REG_CTRL_MEAS, (osrsT << 5) | (osrsP << 2));
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		begin																	|
+		|	Purpose: 	Checks the chip, resets it, reads its calibration and writes the		|
+		|				settings. Blocks for a few ms, so only call it from setup.				|
+		|	Arguments:	void																	|
+		|	Returns:	bool (false if the sensor isn't there)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::begin(){
+				Wire.begin();
+				measuring = false;
+
+				uint8_t chipID = 0;
+				if(!readRegisters(BME_REG_CHIP_ID, &chipID, 1) || chipID != BME_CHIP_ID){ return false; }
+
+				//Soft reset, then waits for the calibration to be copied from NVM
+				writeRegister(BME_REG_RESET, 0xB6);
+				delay(2);
+				uint8_t status = 1;
+				for(uint8_t i = 0; i != 10 && (status & 0x01); i++){
+					if(!readRegisters(BME_REG_STATUS, &status, 1)){ return false; }
+					delay(1);
+				}
+
+				//Calibration, little endian
+				uint8_t buffer[26];
+				if(!readRegisters(BME_REG_CALIB_TP, buffer, 26)){ return false; }
+				calib.T1 = (uint16_t)(buffer[1] << 8 | buffer[0]);
+				calib.T2 = (int16_t)(buffer[3] << 8 | buffer[2]);
+				calib.T3 = (int16_t)(buffer[5] << 8 | buffer[4]);
+				calib.P1 = (uint16_t)(buffer[7] << 8 | buffer[6]);
+				calib.P2 = (int16_t)(buffer[9] << 8 | buffer[8]);
+				calib.P3 = (int16_t)(buffer[11] << 8 | buffer[10]);
+				calib.P4 = (int16_t)(buffer[13] << 8 | buffer[12]);
+				calib.P5 = (int16_t)(buffer[15] << 8 | buffer[14]);
+				calib.P6 = (int16_t)(buffer[17] << 8 | buffer[16]);
+				calib.P7 = (int16_t)(buffer[19] << 8 | buffer[18]);
+				calib.P8 = (int16_t)(buffer[21] << 8 | buffer[20]);
+				calib.P9 = (int16_t)(buffer[23] << 8 | buffer[22]);
+				calib.H1 = buffer[25];
+
+				//Humidity calibration, H4 and H5 share a nibble
+				if(!readRegisters(BME_REG_CALIB_H, buffer, 7)){ return false; }
+				calib.H2 = (int16_t)(buffer[1] << 8 | buffer[0]);
+				calib.H3 = buffer[2];
+				calib.H4 = (int16_t)((int8_t)buffer[3] * 16 | (buffer[4] & 0x0F));
+				calib.H5 = (int16_t)((int8_t)buffer[5] * 16 | (buffer[4] >> 4));
+				calib.H6 = (int8_t)buffer[6];
+
+				return setSampling(osrsT, osrsP, osrsH, filter);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		start																	|
+		|	Purpose: 	Starts a forced conversion and returns right away. The sensor goes		|
+		|				back to sleep once it is done.											|
+		|	Arguments:	void																	|
+		|	Returns:	bool (false if one is already running or it could not be written)		|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::start(){
+				if(measuring){ return false; }
+				if(!writeRegister(BME_REG_CTRL_MEAS, (osrsT << 5) | (osrsP << 2) | 0x01)){ return false; }
+				measuring = true;
+				startTime = millis();
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		poll																	|
+		|	Purpose: 	Once the conversion time has passed, reads all three results in one	|
+		|				transaction and compensates them.										|
+		|	Arguments:	void																	|
+		|	Returns:	bool (true if new readings were collected)								|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::poll(){
+				if(!measuring || (millis() - startTime) < conversionTime){ return false; }
+				measuring = false;
+
+				uint8_t data[8];
+				if(!readRegisters(BME_REG_DATA, data, 8)){ return false; }
+
+				int32_t adcP = ((uint32_t)data[0] << 12) | ((uint32_t)data[1] << 4) | (data[2] >> 4);
+				int32_t adcT = ((uint32_t)data[3] << 12) | ((uint32_t)data[4] << 4) | (data[5] >> 4);
+				int32_t adcH = ((uint32_t)data[6] << 8) | data[7];
+				compensate(adcT, adcP, adcH);
+				sampleTime = startTime;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		writeRegister															|
+		|	Purpose: 	Writes one register.													|
+		|	Arguments:	uint8_t, uint8_t														|
+		|	Returns:	bool (false if not acknowledged)										|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::writeRegister(uint8_t reg, uint8_t value){
+				Wire.beginTransmission(address);
+				Wire.write(reg);
+				Wire.write(value);
+				return (Wire.endTransmission() == 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		readRegisters															|
+		|	Purpose: 	Reads consecutive registers in one transaction.							|
+		|	Arguments:	uint8_t, uint8_t*, uint8_t												|
+		|	Returns:	bool (false if not all were read)										|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_BME280::readRegisters(uint8_t reg, uint8_t* buffer, uint8_t len){
+				Wire.beginTransmission(address);
+				Wire.write(reg);
+				if(Wire.endTransmission() != 0){ return false; }
+				if(Wire.requestFrom(address, len) != len){ return false; }
+				for(uint8_t i = 0; i != len; i++){
+					buffer[i] = Wire.read();
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		compensate																|
+		|	Purpose: 	Converts the raw readings with the datasheet's integer formulas. A		|
+		|				skipped reading (0x80000 / 0x8000) keeps its last value.				|
+		|	Arguments:	int32_t, int32_t, int32_t												|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_BME280::compensate(int32_t adcT, int32_t adcP, int32_t adcH){
+				//Temperature, t_fine is shared with the others
+				int32_t var1 = ((((adcT >> 3) - ((int32_t)calib.T1 << 1))) * ((int32_t)calib.T2)) >> 11;
+				int32_t var2 = (((((adcT >> 4) - ((int32_t)calib.T1)) * ((adcT >> 4) - ((int32_t)calib.T1))) >> 12) * ((int32_t)calib.T3)) >> 14;
+				int32_t tFine = var1 + var2;
+				temperature = (tFine * 5 + 128) >> 8;
+
+				//Pressure (64 bit, Q24.8)
+				if(adcP != 0x80000){
+					int64_t pVar1 = ((int64_t)tFine) - 128000;
+					int64_t pVar2 = pVar1 * pVar1 * (int64_t)calib.P6;
+					pVar2 = pVar2 + ((pVar1 * (int64_t)calib.P5) << 17);
+					pVar2 = pVar2 + (((int64_t)calib.P4) << 35);
+					pVar1 = ((pVar1 * pVar1 * (int64_t)calib.P3) >> 8) + ((pVar1 * (int64_t)calib.P2) << 12);
+					pVar1 = (((((int64_t)1) << 47) + pVar1)) * ((int64_t)calib.P1) >> 33;
+					if(pVar1 != 0){
+						int64_t p = 1048576 - adcP;
+						p = (((p << 31) - pVar2) * 3125) / pVar1;
+						pVar1 = (((int64_t)calib.P9) * (p >> 13) * (p >> 13)) >> 25;
+						pVar2 = (((int64_t)calib.P8) * p) >> 19;
+						pressure = (uint32_t)(((p + pVar1 + pVar2) >> 8) + (((int64_t)calib.P7) << 4));
+					}
+				}
+
+				//Humidity (Q22.10)
+				if(adcH != 0x8000){
+					int32_t h = tFine - ((int32_t)76800);
+					h = (((((adcH << 14) - (((int32_t)calib.H4) << 20) - (((int32_t)calib.H5) * h)) + ((int32_t)16384)) >> 15)
+						* (((((((h * ((int32_t)calib.H6)) >> 10) * (((h * ((int32_t)calib.H3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) * ((int32_t)calib.H2) + 8192) >> 14));
+					h = (h - (((((h >> 15) * (h >> 15)) >> 7) * ((int32_t)calib.H1)) >> 4));
+					h = (h < 0 ? 0 : h);
+					h = (h > 419430400 ? 419430400 : h);
+					humidity = (uint32_t)(h >> 12);
+				}
+			}
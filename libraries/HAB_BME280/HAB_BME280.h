@@ -0,0 +1,141 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to run the BME280 in forced mode over I2C. A conversion is
+*				started and collected later in a single burst read, so the loop never waits on it,
+*				and the readings are compensated in fixed point as in the datasheet.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_BME280_h
+#define HAB_BME280_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <Wire.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Oversampling settings (osrs_x)
+	#define BME_OS_SKIP 0
+	#define BME_OS_1 1
+	#define BME_OS_2 2
+	#define BME_OS_4 3
+	#define BME_OS_8 4
+	#define BME_OS_16 5
+
+	//IIR filter coefficients
+	#define BME_FILTER_OFF 0
+	#define BME_FILTER_2 1
+	#define BME_FILTER_4 2
+	#define BME_FILTER_8 3
+	#define BME_FILTER_16 4
+
+
+class HAB_BME280 {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef BME_DEFAULT_ADDRESS
+			#define BME_DEFAULT_ADDRESS 0x77
+		#endif
+
+		//Registers
+		#define BME_REG_CALIB_TP 0x88 //26 bytes, temperature and pressure (and H1 at 0xA1)
+		#define BME_REG_CHIP_ID 0xD0
+		#define BME_REG_RESET 0xE0
+		#define BME_REG_CALIB_H 0xE1 //7 bytes
+		#define BME_REG_CTRL_HUM 0xF2
+		#define BME_REG_STATUS 0xF3
+		#define BME_REG_CTRL_MEAS 0xF4
+		#define BME_REG_CONFIG 0xF5
+		#define BME_REG_DATA 0xF7 //8 bytes, pressure, temperature, humidity
+		#define BME_CHIP_ID 0x60
+
+		//Calibration from the sensor's NVM
+		struct bmeCalibration {
+			uint16_t T1; int16_t T2; int16_t T3;
+			uint16_t P1; int16_t P2; int16_t P3; int16_t P4; int16_t P5; int16_t P6; int16_t P7; int16_t P8; int16_t P9;
+			uint8_t H1; int16_t H2; uint8_t H3; int16_t H4; int16_t H5; int8_t H6;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		uint8_t address;
+		bmeCalibration calib;
+
+		//Settings
+		uint8_t osrsT = BME_OS_1;
+		uint8_t osrsP = BME_OS_1;
+		uint8_t osrsH = BME_OS_1;
+		uint8_t filter = BME_FILTER_OFF;
+		uint8_t conversionTime = 0; //ms, worst case for the settings
+
+		//Conversion
+		bool measuring = false;
+		unsigned long startTime = 0;
+		unsigned long sampleTime = 0;
+
+		//Last compensated readings
+		int32_t temperature = 0; //Hundredths of a degree C
+		uint32_t pressure = 0; //Pa, Q24.8
+		uint32_t humidity = 0; //Percent, Q22.10
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_BME280(uint8_t address = BME_DEFAULT_ADDRESS);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool isMeasuring();
+			unsigned long getSampleTime();
+			uint8_t getConversionTime();
+			int32_t getTemperature();
+			uint32_t getPressure();
+			uint32_t getHumidity();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			bool setSampling(uint8_t osrsT, uint8_t osrsP, uint8_t osrsH, uint8_t filter);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool begin();
+			bool start();
+			bool poll();
+
+		private:
+			bool writeRegister(uint8_t reg, uint8_t value);
+			bool readRegisters(uint8_t reg, uint8_t* buffer, uint8_t len);
+			void compensate(int32_t adcT, int32_t adcP, int32_t adcH);
+};
+
+#endif
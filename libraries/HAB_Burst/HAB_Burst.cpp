@@ -0,0 +1,232 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to record environmental data at a high rate while a pod is
+*				open, buffering it in memory and writing whole blocks to a science file per pod.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Burst.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Burst::HAB_Burst(){
+		strcpy(fileName, "");
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isActive																|
+		|	Purpose: 	Returns true while a burst is being recorded.							|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Burst::isActive(){
+				return active;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isSampleDue																|
+		|	Purpose: 	Returns true if a burst is running and the next sample should be		|
+		|				taken. The sample time is kept to the millisecond, so a late loop		|
+		|				only spaces the samples out, it does not shift their times.				|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Burst::isSampleDue(){
+				return active && (millis() - lastSample) >= interval;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getInterval																|
+		|	Purpose: 	Returns the time between samples (ms).									|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Burst::getInterval(){
+				return interval;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSampleCount															|
+		|	Purpose: 	Returns the number of samples kept in the current (or last) burst.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Burst::getSampleCount(){
+				return sampleCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDroppedCount															|
+		|	Purpose: 	Returns the number of samples lost because the SD card fell behind.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Burst::getDroppedCount(){
+				return droppedCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getFileName																|
+		|	Purpose: 	Returns the name of the current (or last) science file.					|
+		|	Arguments:	void																	|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Burst::getFileName(){
+				return fileName;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setRate																	|
+		|	Purpose: 	Sets the sampling rate, 20 to 50 Hz. Takes effect on the next burst.	|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool (false if out of range)											|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Burst::setRate(uint8_t hertz){
+				if(hertz < 20 || hertz > 50 || active){ return false; }
+				interval = 1000 / hertz;
+				return true;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		start																	|
+		|	Purpose: 	Starts a burst for a pod, appending to <pod name>.SCI (DOS 8.3).		|
+		|	Arguments:	char*																	|
+		|	Returns:	bool (false if one is already running or the file can't be written)		|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Burst::start(const char* podName){
+				if(active){ return false; }
+
+				strncpy(fileName, podName, 8);
+				fileName[8] = '\0';
+				strcat(fileName, ".SCI");
+
+				//Header, so each burst in the file can be told apart
+				burstHeader header;
+				memset(&header, 0, sizeof(header));
+				memcpy(header.magic, "SCI1", 4);
+				strncpy(header.pod, podName, sizeof(header.pod) - 1);
+				header.interval = interval;
+				header.startTime = millis();
+				if(!writeBlock(&header, sizeof(header))){
+					HAB_Logging::printLog("Could not open ");
+					HAB_Logging::printLogln(fileName, "");
+					return false;
+				}
+
+				fillBlock = 0;
+				fillCount = 0;
+				fullCount = 0;
+				sampleCount = 0;
+				droppedCount = 0;
+				lastSample = millis() - interval;
+				active = true;
+
+				HAB_Logging::printLog("Started science burst to ");
+				HAB_Logging::printLogln(fileName, "");
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		stop																	|
+		|	Purpose: 	Stops the burst and writes everything still in memory.					|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Burst::stop(){
+				if(!active){ return; }
+				active = false;
+
+				//Full blocks first, then the part filled block
+				update();
+				if(fillCount > 0){
+					writeBlock(blocks[fillBlock], fillCount * sizeof(burstSample));
+					fillCount = 0;
+				}
+
+				char* stringPtr = HAB_Logging::getStringPtr();
+				sprintf(stringPtr, "Stopped science burst to %s: %lu samples, %lu dropped", fileName, (unsigned long)sampleCount, (unsigned long)droppedCount);
+				HAB_Logging::printLogln(stringPtr);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		add																		|
+		|	Purpose: 	Adds a sample to the block being filled. If every block is waiting		|
+		|				to be written, the sample is dropped.									|
+		|	Arguments:	burstSample																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Burst::add(const burstSample& sample){
+				if(!active){ return; }
+				lastSample = millis();
+
+				if(fullCount == BURST_BLOCKS){
+					droppedCount++;
+					return;
+				}
+
+				blocks[fillBlock][fillCount++] = sample;
+				sampleCount++;
+
+				//Block full, moves to the next one
+				if(fillCount == BURST_BLOCK_SAMPLES){
+					fullCount++;
+					fillBlock = (fillBlock + 1) % BURST_BLOCKS;
+					fillCount = 0;
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Writes the full blocks to the science file, oldest first. Should be		|
+		|				called once per loop.													|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Burst::update(){
+				while(fullCount > 0){
+					uint8_t oldest = (fillBlock + BURST_BLOCKS - fullCount) % BURST_BLOCKS;
+					if(!writeBlock(blocks[oldest], sizeof(blocks[oldest]))){ return; }
+					fullCount--;
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		writeBlock																|
+		|	Purpose: 	Appends data to the science file.										|
+		|	Arguments:	void*, uint16_t															|
+		|	Returns:	bool (false if it could not be written)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Burst::writeBlock(const void* data, uint16_t len){
+				File scienceFile = SD.open(fileName, FILE_WRITE);
+				if(!scienceFile){ return false; }
+				size_t written = scienceFile.write((const uint8_t*)data, len);
+				scienceFile.close();
+				return (written == len);
+			}
@@ -0,0 +1,133 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to record environmental data at a high rate while a pod is
+*				open, buffering it in memory and writing whole blocks to a science file per pod.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Burst_h
+#define HAB_Burst_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <SPI.h>
+	#include <SD.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef BURST_PODS
+		#define BURST_PODS 4
+	#endif
+
+	//One sample, 20 bytes
+	struct burstSample {
+		uint32_t time; //millis() when it was taken
+		int16_t temperature; //Hundredths of a degree C
+		uint16_t humidity; //Hundredths of a percent
+		uint32_t pressure; //Pa
+		int16_t podTemperature[BURST_PODS]; //Hundredths of a degree C
+	};
+
+	//Written at the start of each burst, same size as a sample. Starts with "SCI1", which as
+	//a sample time would be over 9 days.
+	struct burstHeader {
+		char magic[4];
+		char pod[10];
+		uint16_t interval; //ms between samples
+		uint32_t startTime; //millis()
+	};
+
+
+class HAB_Burst {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef BURST_BLOCK_SAMPLES
+			#define BURST_BLOCK_SAMPLES 12 //240 bytes a block
+		#endif
+		#ifndef BURST_BLOCKS
+			#define BURST_BLOCKS 2 //One fills while the other is written
+		#endif
+		#ifndef BURST_DEFAULT_INTERVAL
+			#define BURST_DEFAULT_INTERVAL 40 //25 Hz
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//Ring of blocks
+		burstSample blocks[BURST_BLOCKS][BURST_BLOCK_SAMPLES];
+		uint8_t fillBlock = 0; //Block being filled
+		uint8_t fillCount = 0; //Samples in it
+		uint8_t fullCount = 0; //Blocks waiting to be written, the oldest is fillBlock - fullCount
+
+		//Science file, <pod name>.SCI
+		char fileName[13];
+		bool active = false;
+		uint16_t interval = BURST_DEFAULT_INTERVAL;
+		unsigned long lastSample = 0;
+
+		//Counters for the current burst
+		uint32_t sampleCount = 0;
+		uint32_t droppedCount = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Burst();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool isActive();
+			bool isSampleDue();
+			uint16_t getInterval();
+			uint32_t getSampleCount();
+			uint32_t getDroppedCount();
+			char* getFileName();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			bool setRate(uint8_t hertz);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool start(const char* podName);
+			void stop();
+			void add(const burstSample& sample);
+			void update();
+
+		private:
+			bool writeBlock(const void* data, uint16_t len);
+};
+
+#endif
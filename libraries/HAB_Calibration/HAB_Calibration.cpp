@@ -0,0 +1,291 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure where each pod's actuator actually stops when open
+*				and closed, and how long it takes to get there. The results are kept in EEPROM
+*				and set as the pods' limits on every boot.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Calibration.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Calibration::HAB_Calibration(HAB_Actuator* actuators, uint8_t count){
+		this->actuators = actuators;
+		this->count = count;
+
+		//Empty table until one is loaded
+		memset(&table, 0, sizeof(table));
+		memcpy(table.magic, "CAL", 3);
+		table.version = CAL_VERSION;
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isRunning																|
+		|	Purpose: 	Returns true while a pod is being calibrated.							|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::isRunning(){
+				return running;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPod																	|
+		|	Purpose: 	Returns the index of the pod being calibrated.							|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Calibration::getPod(){
+				return pod;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isCalibrated															|
+		|	Purpose: 	Returns true if the pod has measurements in the table.					|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::isCalibrated(uint8_t pod){
+				return pod < CAL_PODS && table.pods[pod].closedStop != 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCalibration															|
+		|	Purpose: 	Copies out a pod's measurements. False if it has none.					|
+		|	Arguments:	uint8_t, podCalibration&												|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::getCalibration(uint8_t pod, podCalibration& calibration){
+				if(!isCalibrated(pod)){ return false; }
+				calibration = table.pods[pod];
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLastPod																|
+		|	Purpose: 	Returns the index of the last pod to finish calibrating.				|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Calibration::getLastPod(){
+				return lastPod;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLastSucceeded														|
+		|	Purpose: 	Returns true if the last pod to finish was calibrated and saved.		|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::getLastSucceeded(){
+				return lastSucceeded;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		load																	|
+		|	Purpose: 	Reads the table from EEPROM and sets the limits of each calibrated		|
+		|				pod. False if there is no valid table, the pods then keep the			|
+		|				default limits.															|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::load(){
+				EEPROM.get(CAL_EEPROM_ADDRESS, table);
+				if(memcmp(table.magic, "CAL", 3) != 0 || table.version != CAL_VERSION || table.crc != checksum()){
+					memset(&table, 0, sizeof(table));
+					memcpy(table.magic, "CAL", 3);
+					table.version = CAL_VERSION;
+					return false;
+				}
+
+				for(uint8_t i = 0; i != count; i++){
+					apply(i);
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		start																	|
+		|	Purpose: 	Starts calibrating a pod, or every unlocked pod in turn if given the	|
+		|				pod count. False if already running or the pod is locked.				|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::start(uint8_t pod){
+				if(running || pod > count){ return false; }
+				all = (pod == count);
+				this->pod = (all ? 0 : pod);
+				running = startPod();
+				return running;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		cancel																	|
+		|	Purpose: 	Halts the pod being calibrated and stops, keeping the old table.		|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Calibration::cancel(){
+				if(!running){ return; }
+				actuators[pod].halt();
+				actuators[pod].setCalibrating(false);
+				actuators[pod].setHasOpened(hadOpened);
+				running = false;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Follows the pod's travel. Each time the actuator comes to a stop it		|
+		|				records it and starts the next travel: closed, open, then closed		|
+		|				again. Each travel starts once the power arbiter allows it. Returns		|
+		|				true when a pod has finished (see getLastPod).							|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::update(){
+				if(!running){ return false; }
+				HAB_Actuator* actuator = actuators + pod;
+				if(!actuator->isMoveEnabled()){
+					if(!(step == CAL_OPEN ? actuator->retract() : actuator->extend())){ return false; }
+					stepStart = millis();
+				}
+				actuator->updateMotion();
+
+				//Still travelling
+				if(actuator->getMotionStatus() != MOTION_STALLED){
+					if((millis() - stepStart) < CAL_TIMEOUT){ return false; }
+					actuator->halt();
+					HAB_Logging::printLog("Calibration travel timed out on ");
+					HAB_Logging::printLogln(actuator->getName(), "");
+					finishPod(false);
+					return true;
+				}
+
+				//At a stop
+				uint16_t position = actuator->getPosition();
+				uint16_t time = actuator->getTravelTime() / 100;
+				actuator->halt();
+				switch(step){
+					case CAL_SEAT:
+						step = CAL_OPEN;
+						break;
+					case CAL_OPEN:
+						result.openStop = position;
+						result.openTime = time;
+						step = CAL_CLOSE;
+						break;
+					case CAL_CLOSE:
+						result.closedStop = position;
+						result.closeTime = time;
+						finishPod(result.closedStop >= result.openStop + CAL_MIN_SPAN);
+						return true;
+				}
+				return false;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		startPod																|
+		|	Purpose: 	Starts the current pod, skipping locked pods when doing them all.		|
+		|				False if there is none to start.										|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Calibration::startPod(){
+				while(pod < count && actuators[pod].isLocked()){
+					if(!all){ return false; }
+					pod++;
+				}
+				if(pod >= count){ return false; }
+
+				HAB_Actuator* actuator = actuators + pod;
+				hadOpened = actuator->getHasOpened();
+				actuator->setCalibrating(true);
+				memset(&result, 0, sizeof(result));
+				step = CAL_SEAT;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		finishPod																|
+		|	Purpose: 	Saves and applies the pod's measurements if they are believable,		|
+		|				then moves on to the next pod when doing them all.						|
+		|	Arguments:	bool																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Calibration::finishPod(bool succeeded){
+				HAB_Actuator* actuator = actuators + pod;
+				actuator->setCalibrating(false);
+				actuator->setHasOpened(hadOpened);
+				lastPod = pod;
+				lastSucceeded = succeeded && pod < CAL_PODS;
+				if(lastSucceeded){
+					table.pods[pod] = result;
+					save();
+					apply(pod);
+				}
+
+				pod++;
+				running = all && startPod();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		apply																	|
+		|	Purpose: 	Sets a calibrated pod's limits just inside its stops.					|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Calibration::apply(uint8_t pod){
+				if(!isCalibrated(pod)){ return; }
+				actuators[pod].setLimits(table.pods[pod].openStop + CAL_MARGIN, table.pods[pod].closedStop - CAL_MARGIN);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		save																	|
+		|	Purpose: 	Writes the table to EEPROM. EEPROM.put only rewrites the bytes that		|
+		|				changed, so recalibrating one pod wears only its entry and the CRC.		|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Calibration::save(){
+				table.crc = checksum();
+				EEPROM.put(CAL_EEPROM_ADDRESS, table);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		checksum																|
+		|	Purpose: 	Returns the CRC-16 of the table up to its crc field.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Calibration::checksum(){
+				const uint8_t* bytes = (const uint8_t*)&table;
+				uint16_t crc = 0xFFFF;
+				for(uint8_t i = 0; i != sizeof(table) - sizeof(table.crc); i++){
+					crc = _crc16_update(crc, bytes[i]);
+				}
+				return crc;
+			}
@@ -0,0 +1,146 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure where each pod's actuator actually stops when open
+*				and closed, and how long it takes to get there. The results are kept in EEPROM
+*				and set as the pods' limits on every boot.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Calibration_h
+#define HAB_Calibration_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <EEPROM.h>
+	#include <util/crc16.h>
+	#include <HAB_Actuator.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef CAL_PODS
+		#define CAL_PODS 4
+	#endif
+
+	//One pod's measurements, all zero if it has not been calibrated
+	struct podCalibration {
+		uint16_t openStop; //Position the actuator stops at when open
+		uint16_t closedStop; //Position the actuator stops at when closed
+		uint16_t openTime; //Tenths of a second from closed to open
+		uint16_t closeTime; //Tenths of a second from open to closed
+	};
+
+
+class HAB_Calibration {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef CAL_EEPROM_ADDRESS
+			#define CAL_EEPROM_ADDRESS 0
+		#endif
+		#ifndef CAL_VERSION
+			#define CAL_VERSION 1 //Change if podCalibration changes, so an old table is not read
+		#endif
+		#ifndef CAL_MARGIN
+			#define CAL_MARGIN 6 //ADC counts inside each stop the limit is set, a little over the noise
+		#endif
+		#ifndef CAL_MIN_SPAN
+			#define CAL_MIN_SPAN 300 //ADC counts the stops must be apart to be believed
+		#endif
+		#ifndef CAL_TIMEOUT
+			#define CAL_TIMEOUT 120000 //ms a single travel may take
+		#endif
+
+		//As kept in EEPROM
+		struct calibrationTable {
+			char magic[3]; //"CAL"
+			uint8_t version;
+			podCalibration pods[CAL_PODS];
+			uint16_t crc; //Of everything before it
+		};
+
+		//Steps of a pod's calibration: closes it first, so the open travel is timed from the closed stop
+		enum CalibrationStep : uint8_t {
+			CAL_SEAT,
+			CAL_OPEN,
+			CAL_CLOSE
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		HAB_Actuator* actuators;
+		uint8_t count;
+		calibrationTable table;
+
+		//Calibration in progress
+		bool running = false;
+		bool all = false; //Every pod in turn, rather than one
+		uint8_t pod = 0;
+		CalibrationStep step = CAL_SEAT;
+		unsigned long stepStart = 0;
+		podCalibration result;
+		bool hadOpened = false; //Opening it here does not count as the pod's opening
+
+		//Last pod to finish
+		uint8_t lastPod = 0;
+		bool lastSucceeded = false;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Calibration(HAB_Actuator* actuators, uint8_t count);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool isRunning();
+			uint8_t getPod();
+			bool isCalibrated(uint8_t pod);
+			bool getCalibration(uint8_t pod, podCalibration& calibration);
+			uint8_t getLastPod();
+			bool getLastSucceeded();
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool load();
+			bool start(uint8_t pod);
+			void cancel();
+			bool update();
+
+		private:
+			bool startPod();
+			void finishPod(bool succeeded);
+			void apply(uint8_t pod);
+			void save();
+			uint16_t checksum();
+};
+
+#endif
@@ -36,6 +36,9 @@
 			HAB_Logging::printLogln("Failed to find SD card.");
 		}
 		
+		//Asks the power arbiter before each capture
+		powerLoad = HAB_Power::addLoad(POWER_CAMERA, "Camera");
+		
 		//Gets a reference to the logging stringPtr
 		stringPtr = HAB_Logging::getStringPtr();
 	}
@@ -96,30 +99,105 @@
 			bool HAB_Camera::getBufferStatus(){
 				return(strcmp(fileName, "") != 0 && bytesLeft > 0);
 			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLastImageName														|
+		|	Purpose: 	Returns the name of the last image fully written to the SD card.		|
+		|	Arguments:	void																	|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Camera::getLastImageName(){
+				return lastImageName;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLastImageSize														|
+		|	Purpose: 	Returns the size in bytes of the last image written to the SD card.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Camera::getLastImageSize(){
+				return lastImageSize;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isLastImageThumbnail													|
+		|	Purpose: 	Returns true if the last image written was a thumbnail.					|
+		|	Arguments:	void																	|
+		|	Returns:	boolean																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Camera::isLastImageThumbnail(){
+				return lastImageThumbnail;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getWrittenCount															|
+		|	Purpose: 	Returns the number of images written, used to notice new images.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Camera::getWrittenCount(){
+				return writtenCount;
+			}
 
             
 	//--------------------------------------------------------------------------------\
 	//Setters-------------------------------------------------------------------------|
 	
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setThumbnailsEnabled													|
+		|	Purpose: 	If enabled, a 160x120 thumbnail is captured after each image.			|
+		|	Arguments:	boolean																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Camera::setThumbnailsEnabled(bool thumbnailsEnabled){
+				this->thumbnailsEnabled = thumbnailsEnabled;
+			}
 
 	//--------------------------------------------------------------------------------\
 	//Miscellaneous-------------------------------------------------------------------|	
 		
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		requestPower															|
+		|	Purpose: 	Asks the power arbiter to capture. Granted power is held until the		|
+		|				image is written, so a deferred capture can stay queued until then.		|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Camera::requestPower(){
+				return HAB_Power::acquire(powerLoad);
+			}
+			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		captureImage															|
 		|	Purpose: 	Capture an image with the camera.										|
 		|	Arguments:	image size (integer 0 to 2)												|
-		|	Returns:	void																	|
+		|	Returns:	bool																	|
 		\*-------------------------------------------------------------------------------------*/
-			void HAB_Camera::captureImage(const char* fileName, uint8_t size){	
-				//Ensure there is a camera
-				if(!getReadyStatus()){ HAB_Logging::printLogln("No camera or SD card found."); return; }				
-				if(strcmp(this->fileName, "") != 0){ HAB_Logging::printLogln("Cannot capture image: must write or unbuffer last capture."); return; }
-
+			bool HAB_Camera::captureImage(const char* fileName, uint8_t size){	
+				if(!requestPower()){ HAB_Logging::printLogln("Cannot capture image: deferred for power."); return false; }
+				
 				//Modify the image name here
 				strcpy(stringPtr, itoa(imgCount++, stringPtr, 10));
 				strcat(stringPtr, "_"); strcat(stringPtr, fileName);
 				
+				isThumbnail = false;
+				if(capture(stringPtr, size)){ return true; }
+				HAB_Power::release(powerLoad);
+				return false;
+			}
+			
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		capture																	|
+		|	Purpose: 	Captures an image to be written under the given name.					|
+		|	Arguments:	char*, image size (integer 0 to 2)										|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Camera::capture(const char* fileName, uint8_t size){	
+				//Ensure there is a camera
+				if(!getReadyStatus()){ HAB_Logging::printLogln("No camera or SD card found."); return false; }				
+				if(strcmp(this->fileName, "") != 0){ HAB_Logging::printLogln("Cannot capture image: must write or unbuffer last capture."); return false; }
+				
 				//Set image size
 				switch(size){
 					//Large
@@ -133,29 +211,31 @@
 						cam.setImageSize(VC0706_160x120); break;
 					default:
 						HAB_Logging::printLogln("Invalid image size, no image was captured.");
-						return; //Returns, does not take a picture
+						return false; //Returns, does not take a picture
 				}
 
 				//Capture the image
-				cam.setImageSize(VC0706_320x240);
 				if (cam.takePicture()){
 					//Sets the filename which will be used during the SD write
-					strcpy(this->fileName, stringPtr);
+					strcpy(this->fileName, fileName);
 						
 					//Gets the frame length
-					bytesLeft = cam.frameLength();		
+					bytesLeft = cam.frameLength();
+					frameSize = bytesLeft;
 
 					//Outputs a message
 					HAB_Logging::printLog("Captured image '");
-					HAB_Logging::printLog(stringPtr, "");
+					HAB_Logging::printLog(this->fileName, "");
 					HAB_Logging::printLog("' successfully! (", "");
-					HAB_Logging::printLog(itoa(bytesLeft, stringPtr, 10), "");			
-					HAB_Logging::printLogln(" bytes)", "");						
+					HAB_Logging::printLog(ultoa(bytesLeft, stringPtr, 10), "");			
+					HAB_Logging::printLogln(" bytes)", "");
+					return true;
 				}
 				else{
 					HAB_Logging::printLog("Failed to capture image '");	
-					HAB_Logging::printLog(stringPtr, "");
+					HAB_Logging::printLog(fileName, "");
 					HAB_Logging::printLogln("'.", "");
+					return false;
 				}
 			}
 
@@ -176,7 +256,7 @@
 					if(imgFile){
 						for(int i = 0; i != WRITES_PER_LOOP; i++){							
 							//Reads in the next 32 or remaining bytes
-							bytesToRead = min(32, bytesLeft);
+							bytesToRead = min((uint32_t)32, bytesLeft);
 							buffer = cam.readPicture(bytesToRead);
 							bytesLeft -= bytesToRead;
 							
@@ -188,6 +268,10 @@
 								HAB_Logging::printLog("Finished writing image '");
 								HAB_Logging::printLog(fileName, "");
 								HAB_Logging::printLogln("' to SD!", "");
+								strcpy(lastImageName, fileName);
+								lastImageSize = frameSize;
+								lastImageThumbnail = isThumbnail;
+								writtenCount++;
 								strcpy(fileName, "");
 								break;
 							}							
@@ -196,6 +280,21 @@
 					
 					//Close the file
 					imgFile.close();
+					
+					//Once written, unfreezes the frame so the next capture is a new picture
+					if(strcmp(fileName, "") == 0){
+						cam.resumeVideo();
+						
+						//Captures a thumbnail beside a full image, named after it
+						if(thumbnailsEnabled && !lastImageThumbnail){
+							strcpy(stringPtr, "T"); strcat(stringPtr, lastImageName);
+							isThumbnail = true;
+							capture(stringPtr, 2);
+						}
+						
+						//Done with the power once nothing is left to write
+						if(strcmp(fileName, "") == 0){ HAB_Power::release(powerLoad); }
+					}
 				}
 			}
 
@@ -214,6 +313,7 @@
 				if(cam.reset()){
 					strcpy(fileName, "");
 					bytesLeft = 0;
+					HAB_Power::release(powerLoad);
 					HAB_Logging::printLogln("Successfully emptied the camera buffer.");
 				}
 				else{
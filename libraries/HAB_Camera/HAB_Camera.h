@@ -20,6 +20,7 @@
 	#include <SPI.h>
 	#include <SD.h>
 	#include <Adafruit_VC0706.h>
+	#include <HAB_Power.h>
 	#ifndef HAB_Logging_h
         #include <HAB_Logging.h>
     #endif
@@ -56,11 +57,25 @@ class HAB_Camera {
 		
 		//Image
 		char fileName[50] = "";
-		uint16_t bytesLeft;
+		uint32_t bytesLeft;
+		uint32_t frameSize = 0;
 		uint8_t *buffer;
 		uint8_t bytesToRead;
 		uint16_t imgCount = 0;
 		
+		//Thumbnails
+		bool thumbnailsEnabled = false;
+		bool isThumbnail = false;
+		
+		//Last image written to the SD card
+		char lastImageName[50] = "";
+		uint32_t lastImageSize = 0;
+		bool lastImageThumbnail = false;
+		uint16_t writtenCount = 0;
+		
+		//Power arbiter load, held from a capture until it (and its thumbnail) is written
+		uint8_t powerLoad = POWER_NO_LOAD;
+		
 		//Holds a reference to the logging stringPtr
 		char* stringPtr;
      
@@ -84,17 +99,26 @@ class HAB_Camera {
 			char* getInfo(char* stringPtr);	
 			bool getReadyStatus();
 			bool getBufferStatus();
+			char* getLastImageName();
+			uint32_t getLastImageSize();
+			bool isLastImageThumbnail();
+			uint16_t getWrittenCount();
 		
 		
 		//--------------------------------------------------------------------------------\
 		//Setters-------------------------------------------------------------------------|
+			void setThumbnailsEnabled(bool thumbnailsEnabled);
 		
 		
 		//--------------------------------------------------------------------------------\
 		//Miscellaneous-------------------------------------------------------------------|
-			void captureImage(const char* fileName, uint8_t size);
+			bool requestPower();
+			bool captureImage(const char* fileName, uint8_t size);
 			void writeImage();
 			void emptyImageBuffer();
+			
+		private:
+			bool capture(const char* fileName, uint8_t size);
 };
 
 #endif
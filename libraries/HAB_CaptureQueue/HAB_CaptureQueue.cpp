@@ -0,0 +1,359 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to queue and schedule camera captures from several triggers.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_CaptureQueue.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Rough frame sizes for each image size, used before the write rate is known
+	static const uint32_t expectedFrameSize[] = { 48000, 16000, 5000 };
+
+	static const char* sourceNames[] = { "time-lapse", "altitude", "command", "pod" };
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_CaptureQueue::HAB_CaptureQueue(HAB_Camera* cam){
+		this->cam = cam;
+		memset(queuedCount, 0, sizeof(queuedCount));
+		memset(droppedCount, 0, sizeof(droppedCount));
+		memset(mergedCount, 0, sizeof(mergedCount));
+		lastWrittenCount = cam->getWrittenCount();
+
+		//Gets a reference to the logging stringPtr
+		stringPtr = HAB_Logging::getStringPtr();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getJobCount																|
+		|	Purpose: 	Returns the number of queued captures.									|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_CaptureQueue::getJobCount(){
+				return jobCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDroppedCount															|
+		|	Purpose: 	Returns the number of captures from a source that were dropped.			|
+		|	Arguments:	CaptureSource															|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_CaptureQueue::getDroppedCount(CaptureSource source){
+				return droppedCount[source];
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMergedCount															|
+		|	Purpose: 	Returns the number of captures from a source merged into a queued one.	|
+		|	Arguments:	CaptureSource															|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_CaptureQueue::getMergedCount(CaptureSource source){
+				return mergedCount[source];
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStorageRemaining														|
+		|	Purpose: 	Returns the bytes left in the image storage budget.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_CaptureQueue::getStorageRemaining(){
+				return (storageUsed >= storageBudget ? 0 : storageBudget - storageUsed);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getWriteRate															|
+		|	Purpose: 	Returns the measured image write rate in bytes per second (0 if not		|
+		|				yet measured).															|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_CaptureQueue::getWriteRate(){
+				return writeRate;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMinimumSize															|
+		|	Purpose: 	Returns the largest image size the budget allows (0 large, 2 small).	|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_CaptureQueue::getMinimumSize(){
+				uint32_t remaining = getStorageRemaining();
+				if(remaining < storageBudget / 10){ return 2; }
+				if(remaining < storageBudget / 4) { return 1; }
+				return 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimelapseInterval													|
+		|	Purpose: 	Returns the time-lapse interval after adapting it to the storage		|
+		|				budget and write rate.													|
+		|	Arguments:	void																	|
+		|	Returns:	unsigned long															|
+		\*-------------------------------------------------------------------------------------*/
+			unsigned long HAB_CaptureQueue::getTimelapseInterval(){
+				if(timelapseInterval == 0){ return 0; }
+
+				//Slows down as the budget runs out, past half of it
+				uint32_t remaining = getStorageRemaining();
+				uint32_t scale = 1;
+				if(remaining < storageBudget / 2){
+					scale = (remaining == 0 ? CAPTURE_MAX_INTERVAL_SCALE : (storageBudget / 2) / remaining);
+					if(scale > CAPTURE_MAX_INTERVAL_SCALE){ scale = CAPTURE_MAX_INTERVAL_SCALE; }
+				}
+				unsigned long interval = timelapseInterval * scale;
+
+				//Keeps the camera writing at most a quarter of the time
+				if(writeRate > 0){
+					unsigned long writeTime = (expectedFrameSize[getMinimumSize()] * 1000UL) / writeRate;
+					if(interval < writeTime * 4){ interval = writeTime * 4; }
+				}
+				return interval;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setTimelapseInterval													|
+		|	Purpose: 	Sets the base time-lapse interval in milliseconds, 0 to disable.		|
+		|	Arguments:	unsigned long															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_CaptureQueue::setTimelapseInterval(unsigned long interval){
+				timelapseInterval = interval;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setStorageBudget														|
+		|	Purpose: 	Sets the bytes of the card that images may use.							|
+		|	Arguments:	uint32_t																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_CaptureQueue::setStorageBudget(uint32_t bytes){
+				storageBudget = bytes;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		add																		|
+		|	Purpose: 	Queues a capture. If the queue is full the least important capture is	|
+		|				dropped (and logged). Returns false if this capture was the one dropped.|
+		|	Arguments:	char*, CaptureSource, image size (integer 0 to 2)						|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_CaptureQueue::add(const char* name, CaptureSource source, uint8_t size){
+				captureJob job;
+				strncpy(job.name, name, CAPTURE_NAME_LENGTH - 1);
+				job.name[CAPTURE_NAME_LENGTH - 1] = '\0';
+				job.source = source;
+				job.priority = source;
+				job.size = max(size, getMinimumSize());
+				job.queuedAt = millis();
+
+				//Out of storage, only pod captures are still taken
+				if(getStorageRemaining() == 0 && source != CAPTURE_POD){
+					droppedCount[source]++;
+					logJob("Dropped", &job);
+					HAB_Logging::printLogln("(image storage budget used up)", "");
+					return false;
+				}
+
+				//A newer time-lapse capture replaces one still waiting
+				if(source == CAPTURE_TIMELAPSE){
+					for(uint8_t i = 0; i != jobCount; i++){
+						if(jobs[i].source == CAPTURE_TIMELAPSE){
+							mergedCount[source]++;
+							logJob("Merged", &jobs[i]);
+							HAB_Logging::printLogln("(replaced by a newer one)", "");
+							jobs[i] = job;
+							return true;
+						}
+					}
+				}
+
+				//If full, drops the least important capture
+				if(jobCount == CAPTURE_QUEUE_SIZE){
+					int8_t lowest = findLowestJob();
+					if(jobs[lowest].priority >= job.priority){
+						droppedCount[source]++;
+						logJob("Dropped", &job);
+						HAB_Logging::printLogln("(capture queue full)", "");
+						return false;
+					}
+					droppedCount[jobs[lowest].source]++;
+					logJob("Dropped", &jobs[lowest]);
+					HAB_Logging::printLogln("(capture queue full)", "");
+					removeJob(lowest);
+				}
+
+				jobs[jobCount++] = job;
+				queuedCount[source]++;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Checks the time-lapse and altitude triggers, tracks the storage used	|
+		|				and starts the best queued capture once the camera is free and powered.	|
+		|	Arguments:	Centimetres																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_CaptureQueue::update(Centimetres altitude){
+				unsigned long now = millis();
+
+				//Tracks images finishing their write
+				if(cam->getWrittenCount() != lastWrittenCount){
+					lastWrittenCount = cam->getWrittenCount();
+					storageUsed += cam->getLastImageSize();
+
+					//Measures the write rate of captures started here (not thumbnails)
+					if(writing && !cam->isLastImageThumbnail()){
+						writing = false;
+						unsigned long elapsed = now - writeStart;
+						if(elapsed > 0){
+							uint32_t rate = (cam->getLastImageSize() * 1000UL) / elapsed;
+							writeRate = (writeRate == 0 ? rate : (writeRate * 3 + rate) / 4);
+						}
+					}
+				}
+
+				//Time-lapse
+				unsigned long interval = getTimelapseInterval();
+				if(interval != 0 && (now - lastTimelapse) >= interval){
+					lastTimelapse = now;
+					add("TL.jpg", CAPTURE_TIMELAPSE, 0);
+				}
+
+				//Altitude milestones, several crossed at once count as one capture
+				if(altitude >= nextMilestone){
+					char name[CAPTURE_NAME_LENGTH];
+					sprintf(name, "A%u.jpg", (unsigned int)(nextMilestone.value() / 100000)); //Km
+					while(altitude >= nextMilestone + fromMetres(CAPTURE_ALTITUDE_STEP)){
+						nextMilestone += fromMetres(CAPTURE_ALTITUDE_STEP);
+						mergedCount[CAPTURE_ALTITUDE]++;
+
+						//Logged under the name it would have had
+						captureJob merged;
+						sprintf(merged.name, "A%u.jpg", (unsigned int)(nextMilestone.value() / 100000));
+						merged.source = CAPTURE_ALTITUDE;
+						logJob("Merged", &merged);
+						HAB_Logging::printLog("(into ", "");
+						HAB_Logging::printLog(name, "");
+						HAB_Logging::printLogln(")", "");
+					}
+					nextMilestone += fromMetres(CAPTURE_ALTITUDE_STEP);
+					add(name, CAPTURE_ALTITUDE, 0);
+				}
+
+				//Starts the best capture once the camera is free and the power arbiter allows it, until then it stays queued
+				if(jobCount > 0 && !cam->getBufferStatus() && cam->requestPower()){
+					int8_t best = findBestJob();
+					captureJob job = jobs[best];
+					removeJob(best);
+
+					if(cam->captureImage(job.name, job.size)){
+						writing = true;
+						writeStart = now;
+					}
+					else{
+						droppedCount[job.source]++;
+						logJob("Failed", &job);
+						HAB_Logging::printLogln("(camera error)", "");
+					}
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		findLowestJob															|
+		|	Purpose: 	Returns the index of the least important job (lowest priority, then		|
+		|				oldest).																|
+		|	Arguments:	void																	|
+		|	Returns:	int8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_CaptureQueue::findLowestJob(){
+				int8_t lowest = 0;
+				for(uint8_t i = 1; i < jobCount; i++){
+					if(jobs[i].priority < jobs[lowest].priority ||
+						(jobs[i].priority == jobs[lowest].priority && (long)(jobs[i].queuedAt - jobs[lowest].queuedAt) < 0)){
+						lowest = i;
+					}
+				}
+				return lowest;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		findBestJob																|
+		|	Purpose: 	Returns the index of the job to run next (highest priority, then		|
+		|				oldest).																|
+		|	Arguments:	void																	|
+		|	Returns:	int8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_CaptureQueue::findBestJob(){
+				int8_t best = 0;
+				for(uint8_t i = 1; i < jobCount; i++){
+					if(jobs[i].priority > jobs[best].priority ||
+						(jobs[i].priority == jobs[best].priority && (long)(jobs[i].queuedAt - jobs[best].queuedAt) < 0)){
+						best = i;
+					}
+				}
+				return best;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		removeJob																|
+		|	Purpose: 	Removes a job by moving the last job into its place.					|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_CaptureQueue::removeJob(uint8_t index){
+				jobs[index] = jobs[--jobCount];
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		logJob																	|
+		|	Purpose: 	Logs an event about a job (no newline).									|
+		|	Arguments:	char*, captureJob*														|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_CaptureQueue::logJob(const char* event, const captureJob* job){
+				HAB_Logging::printLog(event);
+				HAB_Logging::printLog(" ", "");
+				HAB_Logging::printLog(sourceNames[job->source], "");
+				HAB_Logging::printLog(" capture '", "");
+				HAB_Logging::printLog(job->name, "");
+				HAB_Logging::printLog("' ", "");
+			}
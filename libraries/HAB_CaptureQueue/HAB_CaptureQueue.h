@@ -0,0 +1,155 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to queue and schedule camera captures from several triggers.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_CaptureQueue_h
+#define HAB_CaptureQueue_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <HAB_Camera.h>
+	#include <HAB_Fixed.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Where a capture came from, also its default priority (higher is more important)
+	enum CaptureSource : uint8_t {
+		CAPTURE_TIMELAPSE = 0,
+		CAPTURE_ALTITUDE = 1,
+		CAPTURE_COMMAND = 2,
+		CAPTURE_POD = 3
+	};
+	#define CAPTURE_SOURCE_COUNT 4
+
+
+class HAB_CaptureQueue {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef CAPTURE_QUEUE_SIZE
+			#define CAPTURE_QUEUE_SIZE 6
+		#endif
+		#ifndef CAPTURE_NAME_LENGTH
+			#define CAPTURE_NAME_LENGTH 13 //DOS 8.3 format
+		#endif
+		#ifndef CAPTURE_TIMELAPSE_INTERVAL
+			#define CAPTURE_TIMELAPSE_INTERVAL 120000 //0 disables the time-lapse
+		#endif
+		#ifndef CAPTURE_ALTITUDE_STEP
+			#define CAPTURE_ALTITUDE_STEP 2000 //An image every 2Km of new altitude
+		#endif
+		#ifndef CAPTURE_STORAGE_BUDGET
+			#define CAPTURE_STORAGE_BUDGET 1000000000UL //Bytes of the card set aside for images
+		#endif
+		#ifndef CAPTURE_MAX_INTERVAL_SCALE
+			#define CAPTURE_MAX_INTERVAL_SCALE 8 //Most the time-lapse is slowed down by a low budget
+		#endif
+
+		struct captureJob {
+			char name[CAPTURE_NAME_LENGTH];
+			CaptureSource source;
+			uint8_t priority;
+			uint8_t size;
+			unsigned long queuedAt;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//Camera the jobs are run on
+		HAB_Camera* cam;
+
+		//Queued jobs, unordered (the best job is searched for when dispatching)
+		captureJob jobs[CAPTURE_QUEUE_SIZE];
+		uint8_t jobCount = 0;
+
+		//Time-lapse
+		unsigned long timelapseInterval = CAPTURE_TIMELAPSE_INTERVAL;
+		unsigned long lastTimelapse = 0;
+
+		//Altitude milestones, the next altitude that triggers a capture
+		Centimetres nextMilestone = fromMetres(CAPTURE_ALTITUDE_STEP);
+
+		//Storage budget
+		uint32_t storageBudget = CAPTURE_STORAGE_BUDGET;
+		uint32_t storageUsed = 0;
+		uint16_t lastWrittenCount = 0;
+
+		//Write bandwidth (bytes per second), measured from capture to the end of the SD write
+		unsigned long writeStart = 0;
+		bool writing = false;
+		uint32_t writeRate = 0;
+
+		//Counters, per source
+		uint16_t queuedCount[CAPTURE_SOURCE_COUNT];
+		uint16_t droppedCount[CAPTURE_SOURCE_COUNT];
+		uint16_t mergedCount[CAPTURE_SOURCE_COUNT];
+
+		//Holds a reference to the logging stringPtr
+		char* stringPtr;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_CaptureQueue(HAB_Camera* cam);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getJobCount();
+			uint16_t getDroppedCount(CaptureSource source);
+			uint16_t getMergedCount(CaptureSource source);
+			uint32_t getStorageRemaining();
+			uint32_t getWriteRate();
+			uint8_t getMinimumSize();
+			unsigned long getTimelapseInterval();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			void setTimelapseInterval(unsigned long interval);
+			void setStorageBudget(uint32_t bytes);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool add(const char* name, CaptureSource source, uint8_t size);
+			void update(Centimetres altitude);
+
+		private:
+			int8_t findLowestJob();
+			int8_t findBestJob();
+			void removeJob(uint8_t index);
+			void logJob(const char* event, const captureJob* job);
+};
+
+#endif
@@ -0,0 +1,341 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to stream images stored on the SD card to the ground stations.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Downlink.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Downlink::HAB_Downlink(EthernetUDP* conn){
+		this->conn = conn;
+		memset(pending, 0, sizeof(pending));
+
+		//Gets a reference to the logging stringPtr
+		stringPtr = HAB_Logging::getStringPtr();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isBusy																	|
+		|	Purpose: 	Returns true if an image is being sent or waiting on the ground.		|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::isBusy(){
+				return (state != IDLE);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getImageId																|
+		|	Purpose: 	Returns the id of the current (or last) image.							|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Downlink::getImageId(){
+				return imageId;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPendingCount															|
+		|	Purpose: 	Returns the number of chunks still to be sent.							|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Downlink::getPendingCount(){
+				return pendingCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getChunksSent															|
+		|	Purpose: 	Returns the total number of chunks sent.								|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Downlink::getChunksSent(){
+				return chunksSent;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getChunksResent															|
+		|	Purpose: 	Returns the number of chunks sent again after a NACK.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Downlink::getChunksResent(){
+				return chunksResent;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addDestination															|
+		|	Purpose: 	Adds an address the image chunks are sent to.							|
+		|	Arguments:	IPAddress, uint16_t														|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::addDestination(IPAddress ip, uint16_t port){
+				if(destCount >= DOWNLINK_MAX_DESTINATIONS){ return false; }
+				destIP[destCount] = ip;
+				destPort[destCount] = port;
+				destCount++;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setRate																	|
+		|	Purpose: 	Sets the bandwidth cap in bytes per second.								|
+		|	Arguments:	uint16_t																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Downlink::setRate(uint16_t bytesPerSecond){
+				rate = bytesPerSecond;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		startImage																|
+		|	Purpose: 	Starts sending an image stored on the SD card. Any image in progress	|
+		|				is dropped.																|
+		|	Arguments:	char*																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::startImage(const char* fileName){
+				//Gets the size of the image
+				File imgFile = SD.open(fileName, FILE_READ);
+				if(!imgFile){
+					HAB_Logging::printLog("Cannot downlink image '");
+					HAB_Logging::printLog(fileName, "");
+					HAB_Logging::printLogln("': file not found.", "");
+					return false;
+				}
+				uint32_t size = imgFile.size();
+				imgFile.close();
+
+				//Ensures it fits in the chunk bitmap
+				uint32_t count = (size + DOWNLINK_CHUNK_SIZE - 1) / DOWNLINK_CHUNK_SIZE;
+				if(count == 0 || count > DOWNLINK_MAX_CHUNKS){
+					HAB_Logging::printLog("Cannot downlink image '");
+					HAB_Logging::printLog(fileName, "");
+					HAB_Logging::printLogln("': invalid size.", "");
+					return false;
+				}
+
+				//Sets up the new image, every chunk starts pending
+				strncpy(this->fileName, fileName, sizeof(this->fileName) - 1);
+				this->fileName[sizeof(this->fileName) - 1] = '\0';
+				imageId++;
+				imageSize = size;
+				chunkCount = count;
+				memset(pending, 0, sizeof(pending));
+				pendingCount = 0;
+				for(uint16_t i = 0; i != chunkCount; i++){ markPending(i); }
+				cursor = 0;
+				endAttempts = 0;
+				state = SENDING;
+
+				HAB_Logging::printLog("Started downlink of image '");
+				HAB_Logging::printLog(this->fileName, "");
+				HAB_Logging::printLog("' (", "");
+				HAB_Logging::printLog(itoa(chunkCount, stringPtr, 10), "");
+				HAB_Logging::printLogln(" chunks)", "");
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		handleNack																|
+		|	Purpose: 	Marks a range of chunks the ground is missing to be sent again.			|
+		|	Arguments:	uint16_t, uint16_t, uint16_t											|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::handleNack(uint16_t imageId, uint16_t firstChunk, uint16_t lastChunk){
+				//Only the current image can be resumed
+				if(state == IDLE || imageId != this->imageId || firstChunk > lastChunk || lastChunk >= chunkCount){
+					return false;
+				}
+
+				for(uint16_t i = firstChunk; i <= lastChunk; i++){
+					if(!(pending[i >> 3] & (1 << (i & 7)))){
+						markPending(i);
+						chunksResent++;
+					}
+				}
+
+				//Sends from the lowest missing chunk
+				if(firstChunk < cursor){ cursor = firstChunk; }
+				endAttempts = 0;
+				state = SENDING;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		handleAck																|
+		|	Purpose: 	Completes the current image once the ground has all of it.				|
+		|	Arguments:	uint16_t																|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::handleAck(uint16_t imageId){
+				if(state == IDLE || imageId != this->imageId){ return false; }
+
+				state = IDLE;
+				HAB_Logging::printLog("Downlink of image '");
+				HAB_Logging::printLog(fileName, "");
+				HAB_Logging::printLogln("' complete!", "");
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		cancel																	|
+		|	Purpose: 	Stops sending the current image.										|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Downlink::cancel(){
+				if(state == IDLE){ return; }
+
+				state = IDLE;
+				HAB_Logging::printLog("Downlink of image '");
+				HAB_Logging::printLog(fileName, "");
+				HAB_Logging::printLogln("' cancelled.", "");
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Sends pending chunks as the bandwidth cap allows. Should be called		|
+		|				every loop while there is a connection.									|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Downlink::update(){
+				//Refills the token bucket, a chunk costs its size once per destination
+				unsigned long now = millis();
+				uint32_t cost = (uint32_t)DOWNLINK_CHUNK_SIZE * destCount * 1000;
+				uint32_t burst = max((uint32_t)DOWNLINK_BURST * 1000, cost);
+				tokens += min(now - lastRefill, 60000UL) * rate;
+				if(tokens > burst){ tokens = burst; }
+				lastRefill = now;
+
+				if(state == SENDING){
+					//Sends the next pending chunks, lowest first
+					for(uint8_t sent = 0; sent != DOWNLINK_CHUNKS_PER_UPDATE && pendingCount > 0 && tokens >= cost; sent++){
+						while(!(pending[cursor >> 3] & (1 << (cursor & 7)))){
+							cursor = (cursor + 1) % chunkCount;
+						}
+
+						if(!sendChunk(cursor)){ return; }
+						pending[cursor >> 3] &= ~(1 << (cursor & 7));
+						pendingCount--;
+						tokens -= cost;
+						chunksSent++;
+					}
+
+					//Once all chunks are sent, asks the ground what it is missing
+					if(pendingCount == 0){
+						state = AWAITING_ACK;
+						sendEnd();
+					}
+				}
+				else if(state == AWAITING_ACK && (now - lastEndSent) > DOWNLINK_END_RETRY){
+					//Gives up after a few attempts, the image can be requested again later
+					if(endAttempts >= DOWNLINK_END_ATTEMPTS){
+						state = IDLE;
+						HAB_Logging::printLog("Downlink of image '");
+						HAB_Logging::printLog(fileName, "");
+						HAB_Logging::printLogln("' was not acknowledged.", "");
+					}
+					else{
+						sendEnd();
+					}
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		markPending																|
+		|	Purpose: 	Sets the bit of a chunk so it will be sent.								|
+		|	Arguments:	uint16_t																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Downlink::markPending(uint16_t chunk){
+				pending[chunk >> 3] |= (1 << (chunk & 7));
+				pendingCount++;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sendChunk																|
+		|	Purpose: 	Sends a chunk of the image to every destination.						|
+		|				Format: [IMAGE]<id>,<chunk>,<count>,<binary data>						|
+		|	Arguments:	uint16_t																|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Downlink::sendChunk(uint16_t chunk){
+				File imgFile = SD.open(fileName, FILE_READ);
+				if(!imgFile){
+					HAB_Logging::printLogln("Downlink failed to open image.");
+					state = IDLE;
+					return false;
+				}
+
+				uint32_t offset = (uint32_t)chunk * DOWNLINK_CHUNK_SIZE;
+				uint16_t length = min((uint32_t)DOWNLINK_CHUNK_SIZE, imageSize - offset);
+				sprintf(stringPtr, "[IMAGE]%u,%u,%u,", imageId, chunk, chunkCount);
+
+				//Streams the chunk from the card straight into the packet, the card's block cache makes rereads cheap
+				uint8_t buffer[32];
+				for(uint8_t d = 0; d != destCount; d++){
+					imgFile.seek(offset);
+					conn->beginPacket(destIP[d], destPort[d]);
+					conn->write(stringPtr);
+					for(uint16_t left = length; left > 0;){
+						int bytesRead = imgFile.read(buffer, min((uint16_t)sizeof(buffer), left));
+						if(bytesRead <= 0){ break; }
+						conn->write(buffer, bytesRead);
+						left -= bytesRead;
+					}
+					conn->endPacket();
+				}
+
+				imgFile.close();
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sendEnd																	|
+		|	Purpose: 	Tells the ground the image has been sent.								|
+		|				Format: [IMGEND]<id>,<count>,<size>,<name>								|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Downlink::sendEnd(){
+				sprintf(stringPtr, "[IMGEND]%u,%u,%lu,%s", imageId, chunkCount, (unsigned long)imageSize, fileName);
+				for(uint8_t d = 0; d != destCount; d++){
+					conn->beginPacket(destIP[d], destPort[d]);
+					conn->write(stringPtr);
+					conn->endPacket();
+				}
+				lastEndSent = millis();
+				endAttempts++;
+			}
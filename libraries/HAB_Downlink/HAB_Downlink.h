@@ -0,0 +1,145 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to stream images stored on the SD card to the ground stations.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Downlink_h
+#define HAB_Downlink_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <SPI.h>
+	#include <SD.h>
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+class HAB_Downlink {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef DOWNLINK_CHUNK_SIZE
+			#define DOWNLINK_CHUNK_SIZE 256 //Header is at most 25 bytes, so a chunk fits in a 300 byte packet
+		#endif
+		#ifndef DOWNLINK_MAX_CHUNKS
+			#define DOWNLINK_MAX_CHUNKS 512 //128KB at 256 bytes per chunk, a 640x480 frame is usually under 64KB
+		#endif
+		#ifndef DOWNLINK_RATE
+			#define DOWNLINK_RATE 2048 //Bytes per second, leaves the rest of the link to telemetry
+		#endif
+		#ifndef DOWNLINK_BURST
+			#define DOWNLINK_BURST 512 //Most bytes that can be sent at once after being idle
+		#endif
+		#ifndef DOWNLINK_CHUNKS_PER_UPDATE
+			#define DOWNLINK_CHUNKS_PER_UPDATE 2 //Bounds the time spent per loop
+		#endif
+		#ifndef DOWNLINK_MAX_DESTINATIONS
+			#define DOWNLINK_MAX_DESTINATIONS 2
+		#endif
+		#ifndef DOWNLINK_END_RETRY
+			#define DOWNLINK_END_RETRY 3000 //Time to wait for an ACK or NACK before resending the end marker
+		#endif
+		#ifndef DOWNLINK_END_ATTEMPTS
+			#define DOWNLINK_END_ATTEMPTS 5
+		#endif
+
+		//Downlink states
+		enum DownlinkState : uint8_t { IDLE, SENDING, AWAITING_ACK };
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//UDP connection and destinations
+		EthernetUDP* conn;
+		IPAddress destIP[DOWNLINK_MAX_DESTINATIONS];
+		uint16_t destPort[DOWNLINK_MAX_DESTINATIONS];
+		uint8_t destCount = 0;
+
+		//Image being sent
+		char fileName[20] = "";
+		uint16_t imageId = 0;
+		uint32_t imageSize = 0;
+		uint16_t chunkCount = 0;
+		DownlinkState state = IDLE;
+
+		//One bit per chunk, set if the chunk still has to be sent
+		uint8_t pending[DOWNLINK_MAX_CHUNKS / 8];
+		uint16_t pendingCount = 0;
+		uint16_t cursor = 0;
+
+		//Rate control (token bucket, in thousandths of a byte so short loops still refill)
+		uint16_t rate = DOWNLINK_RATE;
+		uint32_t tokens = 0;
+		unsigned long lastRefill = 0;
+
+		//End marker retries
+		unsigned long lastEndSent = 0;
+		uint8_t endAttempts = 0;
+
+		//Statistics
+		uint32_t chunksSent = 0;
+		uint32_t chunksResent = 0;
+
+		//Holds a reference to the logging stringPtr
+		char* stringPtr;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Downlink(EthernetUDP* conn);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool isBusy();
+			uint16_t getImageId();
+			uint16_t getPendingCount();
+			uint32_t getChunksSent();
+			uint32_t getChunksResent();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			bool addDestination(IPAddress ip, uint16_t port);
+			void setRate(uint16_t bytesPerSecond);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool startImage(const char* fileName);
+			bool handleNack(uint16_t imageId, uint16_t firstChunk, uint16_t lastChunk);
+			bool handleAck(uint16_t imageId);
+			void cancel();
+			void update();
+
+		private:
+			void markPending(uint16_t chunk);
+			bool sendChunk(uint16_t chunk);
+			void sendEnd();
+};
+
+#endif
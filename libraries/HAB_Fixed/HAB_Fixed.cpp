@@ -0,0 +1,50 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library holds the fixed point types used for the readings and control, so the
+*				AVR (which has no FPU) only compares and adds integers. Each unit is its own type,
+*				and floats are only converted to and from at the edges (sensors, logs, commands).
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Fixed.h"
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Formatting----------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		formatFixed																|
+		|	Purpose: 	Formats a fixed point number, e.g. 12345 with 2 decimals is "123.45".	|
+		|	Arguments:	char* (at least 13 characters), int32_t, uint8_t						|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* formatFixed(char* buffer, int32_t value, uint8_t decimals){
+				uint32_t magnitude = (value < 0 ? -(uint32_t)value : value);
+				uint32_t scale = 1;
+				for(uint8_t i = 0; i != decimals; i++){ scale *= 10; }
+
+				char* pos = buffer;
+				if(value < 0){ *pos++ = '-'; }
+				ultoa(magnitude / scale, pos, 10);
+				if(decimals > 0){
+					pos += strlen(pos);
+					*pos++ = '.';
+					uint32_t fraction = magnitude % scale;
+					for(uint32_t digit = scale / 10; digit != 0; digit /= 10){
+						*pos++ = '0' + (fraction / digit) % 10;
+					}
+					*pos = '\0';
+				}
+				return buffer;
+			}
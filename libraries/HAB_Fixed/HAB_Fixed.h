@@ -0,0 +1,118 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library holds the fixed point types used for the readings and control, so the
+*				AVR (which has no FPU) only compares and adds integers. Each unit is its own type,
+*				and floats are only converted to and from at the edges (sensors, logs, commands).
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Fixed_h
+#define HAB_Fixed_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Units, each with the number of decimals the integer holds
+	struct CentimetreUnit { static const uint8_t decimals = 2; };
+	struct CentimetrePerSecondUnit { static const uint8_t decimals = 2; };
+	struct MicroDegreeUnit { static const uint8_t decimals = 6; };
+	struct CentiCelsiusUnit { static const uint8_t decimals = 2; };
+	struct PascalUnit { static const uint8_t decimals = 0; };
+	struct CentiPercentUnit { static const uint8_t decimals = 2; };
+
+
+//--------------------------------------------------------------------------\
+//								    Class					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		HAB_Fixed																|
+	|	Purpose: 	An integer tagged with its unit. Values of different units can't be		|
+	|				mixed, and a plain number has to be wrapped explicitly. Packed, so it	|
+	|				can sit in the packed HAB_Structs records.								|
+	\*-------------------------------------------------------------------------------------*/
+	template <typename T, typename Unit>
+	class __attribute__((packed)) HAB_Fixed {
+		T raw;
+
+		public:
+		constexpr HAB_Fixed() : raw(0) {}
+		explicit constexpr HAB_Fixed(T raw) : raw(raw) {}
+
+		//The integer, scaled by 10^Unit::decimals
+		constexpr T value() const { return raw; }
+
+		//Arithmetic within the unit
+		constexpr HAB_Fixed operator+(HAB_Fixed other) const { return HAB_Fixed((T)(raw + other.raw)); }
+		constexpr HAB_Fixed operator-(HAB_Fixed other) const { return HAB_Fixed((T)(raw - other.raw)); }
+		constexpr HAB_Fixed operator-() const { return HAB_Fixed((T)(-raw)); }
+		HAB_Fixed& operator+=(HAB_Fixed other){ raw += other.raw; return *this; }
+		HAB_Fixed& operator-=(HAB_Fixed other){ raw -= other.raw; return *this; }
+
+		//Comparisons
+		constexpr bool operator==(HAB_Fixed other) const { return raw == other.raw; }
+		constexpr bool operator!=(HAB_Fixed other) const { return raw != other.raw; }
+		constexpr bool operator<(HAB_Fixed other) const { return raw < other.raw; }
+		constexpr bool operator<=(HAB_Fixed other) const { return raw <= other.raw; }
+		constexpr bool operator>(HAB_Fixed other) const { return raw > other.raw; }
+		constexpr bool operator>=(HAB_Fixed other) const { return raw >= other.raw; }
+	};
+
+	typedef HAB_Fixed<int32_t, CentimetreUnit> Centimetres;
+	typedef HAB_Fixed<int32_t, CentimetrePerSecondUnit> CentimetresPerSecond;
+	typedef HAB_Fixed<int32_t, MicroDegreeUnit> MicroDegrees;
+	typedef HAB_Fixed<int16_t, CentiCelsiusUnit> CentiCelsius;
+	typedef HAB_Fixed<int32_t, PascalUnit> Pascals;
+	typedef HAB_Fixed<uint16_t, CentiPercentUnit> CentiPercent;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Conversions---------------------------------------------------------------------|
+		//Rounded to the nearest step. With constant arguments these are done by the compiler,
+		//e.g. fromMetres(STOP_ALTITUDE) costs nothing at run time.
+		constexpr int32_t roundFixed(double value){ return (int32_t)(value < 0 ? value - 0.5 : value + 0.5); }
+		constexpr Centimetres fromMetres(double metres){ return Centimetres(roundFixed(metres * 100)); }
+		constexpr CentimetresPerSecond fromMetresPerSecond(double speed){ return CentimetresPerSecond(roundFixed(speed * 100)); }
+		constexpr MicroDegrees fromDegrees(double degrees){ return MicroDegrees(roundFixed(degrees * 1000000)); }
+		constexpr CentiCelsius fromCelsius(double celsius){ return CentiCelsius((int16_t)roundFixed(celsius * 100)); }
+		constexpr Pascals fromPascals(double pascals){ return Pascals(roundFixed(pascals)); }
+
+		//Back to float, for the statistics and anything else that needs it
+		template <typename T, typename Unit>
+		float toFloat(HAB_Fixed<T, Unit> value){
+			float result = value.value();
+			for(uint8_t i = 0; i != Unit::decimals; i++){ result /= 10; }
+			return result;
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Formatting----------------------------------------------------------------------|
+		char* formatFixed(char* buffer, int32_t value, uint8_t decimals);
+
+		//With all of the unit's decimals, e.g. Centimetres(2051230) is "20512.30"
+		template <typename T, typename Unit>
+		char* formatFixed(char* buffer, HAB_Fixed<T, Unit> value){
+			return formatFixed(buffer, value.value(), Unit::decimals);
+		}
+
+#endif
@@ -13,6 +13,21 @@
 	#include "HAB_GPS.h"
 	
 	
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Sets the dynamic model to 'airborne <1G'
+	static const uint8_t setdm6[] PROGMEM = {
+		0xB5, 0x62, 0x06, 0x24, 0x24, 0x00, 0xFF, 0xFF, 0x06,
+		0x03, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00,
+		0x05, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0x64, 0x00, 0x2C,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDC
+	};
+
+	
 //--------------------------------------------------------------------------\
 //								  Constructor					   			|
 //--------------------------------------------------------------------------/
@@ -85,6 +100,26 @@
 			TinyGPSPlus* HAB_GPS::getReadings(){
 				return &gpsData;
 			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getAltitude, getSpeed, getLatitude, getLongitude						|
+		|	Purpose: 	Return the most recent readings in fixed point, taken from the raw		|
+		|				values the receiver sent rather than through floats.					|
+		|	Arguments:	void																	|
+		|	Returns:	Centimetres, CentimetresPerSecond, MicroDegrees							|
+		\*-------------------------------------------------------------------------------------*/
+			Centimetres HAB_GPS::getAltitude(){
+				return Centimetres(gpsData.altitude.value());
+			}
+			CentimetresPerSecond HAB_GPS::getSpeed(){
+				return CentimetresPerSecond(gpsData.speed.value() * 463L / 900); //Hundredths of a knot, 1852/3600
+			}
+			MicroDegrees HAB_GPS::getLatitude(){
+				return toMicroDegrees(gpsData.location.rawLat());
+			}
+			MicroDegrees HAB_GPS::getLongitude(){
+				return toMicroDegrees(gpsData.location.rawLng());
+			}
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		getLockStatus															|
@@ -123,6 +158,16 @@
 				return true;
 			}
 		
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isModePending															|
+		|	Purpose: 	Returns true while the dynamic model is still being set.				|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_GPS::isModePending(){
+				return (modeStep != GPS_MODE_DONE);
+			}
+
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		isModeSet																|
 		|	Purpose: 	Returns true if the 'airborne <1G' mode is set.							|
@@ -143,14 +188,17 @@
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		feedReceiver															|
 		|	Purpose: 	Feed the GPS object with data from the receiver.						|
-		|				Update readings when valid.												|
+		|				Update readings when valid, and move on setting the dynamic model.		|
 		|	Arguments:	void																	|
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_GPS::feedReceiver(){	
 				while(Serial1.available()){
-					gpsData.encode(Serial1.read());
+					uint8_t b = Serial1.read();
+					if(modeStep == GPS_MODE_ACK){ matchAck(b); }
+					gpsData.encode(b);
 				}
+				if(modeStep != GPS_MODE_DONE){ updateMode(); }
 			}
 				
 		/*-------------------------------------------------------------------------------------*\
@@ -187,42 +235,16 @@
 			
 		/*-------------------------------------------------------------------------------------*\
 		| 	Name: 		setDynamicModel															|
-		|	Purpose: 	The following functions are used to set the dynamic model to the		|
-		|				'airborne <1G' mode. This allows operation up to 50Km.					|
+		|	Purpose: 	Starts setting the dynamic model to the 'airborne <1G' mode, which		|
+		|				allows operation up to 50Km. It is sent, and its ACK watched for, by	|
+		|				feedReceiver, so nothing waits on it. See isModePending.				|
 		|	Arguments:	void																	|
 		|	Returns:	void																	|
 		\*-------------------------------------------------------------------------------------*/
 			void HAB_GPS::setGPS_DynamicModel6(){
-				int tries = 0;
-				uint8_t setdm6[] = {
-					0xB5, 0x62, 0x06, 0x24, 0x24, 0x00, 0xFF, 0xFF, 0x06,
-					0x03, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00,
-					0x05, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0x64, 0x00, 0x2C,
-					0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-					0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDC
-				};
-				
-				while(!modeSet && tries++ < 3){
-					HAB_GPS::sendUBX(setdm6, sizeof(setdm6)/sizeof(uint8_t));
-					modeSet = HAB_GPS::getUBX_ACK(setdm6);
-				}
-			}
-		
-			void HAB_GPS::sendUBX(uint8_t *MSG, uint8_t len){
-				Serial1.flush();
-				Serial1.write(0xFF);
-				delay(500);
-				for(int i=0; i<len; i++){
-					Serial1.write(MSG[i]);
-				}
-			}
-		
-			bool HAB_GPS::getUBX_ACK(uint8_t *MSG){
-				uint8_t b;
-				uint8_t ackByteID = 0;
-				uint8_t ackPacket[10];
-				unsigned long startTime = millis();
-			 
+				modeSet = false;
+				modeTries = 0;
+
 				//Construct the expected ACK packet
 				ackPacket[0] = 0xB5; // header
 				ackPacket[1] = 0x62; // header
@@ -230,40 +252,94 @@
 				ackPacket[3] = 0x01; // id
 				ackPacket[4] = 0x02; // length
 				ackPacket[5] = 0x00;
-				ackPacket[6] = MSG[2]; // ACK class
-				ackPacket[7] = MSG[3]; // ACK id
+				ackPacket[6] = pgm_read_byte(&setdm6[2]); // ACK class
+				ackPacket[7] = pgm_read_byte(&setdm6[3]); // ACK id
 				ackPacket[8] = 0; // CK_A
 				ackPacket[9] = 0; // CK_B
-			 
+
 				//Calculate the checksums
 				for(uint8_t ubxi=2; ubxi<8; ubxi++){
 					ackPacket[8] = ackPacket[8] + ackPacket[ubxi];
 					ackPacket[9] = ackPacket[9] + ackPacket[8];
 				}
-			 
-				while(1){		 
-					//Test for success
-					if(ackByteID > 9){
-						// All packets in order!
-						return true;
+
+				wakeReceiver();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		wakeReceiver															|
+		|	Purpose: 	Sends the byte that wakes the receiver, the message follows once it		|
+		|				has had GPS_WAKE_TIME to wake.											|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_GPS::wakeReceiver(){
+				Serial1.flush();
+				Serial1.write(0xFF);
+				modeStep = GPS_MODE_WAKING;
+				modeTime = millis();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		updateMode																|
+		|	Purpose: 	Moves setting the dynamic model on: sends the message once the			|
+		|				receiver is awake, and tries again (up to GPS_MODE_TRIES) if no ACK		|
+		|				came within GPS_ACK_TIMEOUT.											|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_GPS::updateMode(){
+				unsigned long elapsed = millis() - modeTime;
+				if(modeStep == GPS_MODE_WAKING && elapsed >= GPS_WAKE_TIME){
+					for(uint8_t i = 0; i != sizeof(setdm6); i++){
+						Serial1.write(pgm_read_byte(&setdm6[i]));
 					}
-			 
-					//Timeout if no valid response in 3 seconds
-					if(millis() - startTime > 3000){
-						return false;
+					ackByteID = 0;
+					modeStep = GPS_MODE_ACK;
+					modeTime = millis();
+				}
+				else if(modeStep == GPS_MODE_ACK){
+					//All packets in order!
+					if(ackByteID > 9){
+						modeSet = true;
+						modeStep = GPS_MODE_DONE;
+						HAB_Logging::printLogln("GPS dynamic model set");
 					}
-			 
-					//Make sure data is available to read
-					if(Serial1.available()){
-						b = Serial1.read();
-			 
-						//Check that bytes arrive in sequence as per expected ACK packet
-						if(b == ackPacket[ackByteID]){
-							ackByteID++;
+					else if(elapsed > GPS_ACK_TIMEOUT){
+						if(++modeTries < GPS_MODE_TRIES){
+							wakeReceiver();
 						}
 						else{
-							ackByteID = 0; // Reset and look again, invalid order
+							modeStep = GPS_MODE_DONE;
+							HAB_Logging::printLogln("GPS dynamic model not acknowledged");
 						}
 					}
 				}
-			}
\ No newline at end of file
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		matchAck																|
+		|	Purpose: 	Checks that the ACK's bytes arrive in sequence, among the NMEA.			|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_GPS::matchAck(uint8_t b){
+				if(ackByteID > 9){ return; }
+				if(b == ackPacket[ackByteID]){
+					ackByteID++;
+				}
+				else{
+					ackByteID = (b == ackPacket[0] ? 1 : 0); // Reset and look again, invalid order
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		toMicroDegrees															|
+		|	Purpose: 	Converts TinyGPS's whole degrees and billionths to micro-degrees.		|
+		|	Arguments:	RawDegrees																|
+		|	Returns:	MicroDegrees															|
+		\*-------------------------------------------------------------------------------------*/
+			MicroDegrees HAB_GPS::toMicroDegrees(const RawDegrees& raw){
+				int32_t value = (int32_t)raw.deg * 1000000L + (int32_t)((raw.billionths + 500) / 1000);
+				return MicroDegrees(raw.negative ? -value : value);
+			}
@@ -19,6 +19,7 @@
 	#include <SoftwareSerial.h>
 	#include <SPI.h>
 	#include <TinyGPS++.h>
+	#include <HAB_Fixed.h>
 	#include <HAB_Logging.h>
 	
 
@@ -36,6 +37,19 @@ class HAB_GPS {
 		#ifndef GPS_BAUD
 			#define GPS_BAUD 9600
 		#endif
+
+		//Setting the dynamic model
+		#ifndef GPS_WAKE_TIME
+			#define GPS_WAKE_TIME 500 //ms after the wake byte before the message
+		#endif
+		#ifndef GPS_ACK_TIMEOUT
+			#define GPS_ACK_TIMEOUT 3000 //ms
+		#endif
+		#ifndef GPS_MODE_TRIES
+			#define GPS_MODE_TRIES 3
+		#endif
+
+		enum GPSModeStep : uint8_t { GPS_MODE_WAKING, GPS_MODE_ACK, GPS_MODE_DONE };
 	
 
 	//--------------------------------------------------------------------------\
@@ -51,6 +65,13 @@ class HAB_GPS {
 		
 		//Set to true if the proper GPS mode is set
 		bool modeSet = false;
+
+		//Setting it, without waiting in the loop
+		GPSModeStep modeStep = GPS_MODE_DONE;
+		uint8_t modeTries = 0;
+		unsigned long modeTime = 0;
+		uint8_t ackPacket[10];
+		uint8_t ackByteID = 0;
      
 	
 	//--------------------------------------------------------------------------\
@@ -73,8 +94,13 @@ class HAB_GPS {
 			char* getTime(char* stringPtr);
 			bool getLockStatus();		
 			TinyGPSPlus* getReadings();
+			Centimetres getAltitude();
+			CentimetresPerSecond getSpeed();
+			MicroDegrees getLatitude();
+			MicroDegrees getLongitude();
 			bool isAscending(); //This isn't used
 			bool isModeSet();
+			bool isModePending();
 		
 		//--------------------------------------------------------------------------------\
 		//Setters-------------------------------------------------------------------------|
@@ -85,8 +111,12 @@ class HAB_GPS {
 			void feedReceiver();
 			void printInfo();
 			void setGPS_DynamicModel6();
-			void sendUBX(uint8_t *MSG, uint8_t len);
-			bool getUBX_ACK(uint8_t *MSG);
+
+		private:
+			void wakeReceiver();
+			void updateMode();
+			void matchAck(uint8_t b);
+			static MicroDegrees toMicroDegrees(const RawDegrees& raw);
 };
 
 #endif
@@ -0,0 +1,342 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep every telemetry record on the SD card, with a sparse
+*				time index in memory. Records missed while the link was down are sent later, and
+*				any time range can be asked for.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_History.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_History::HAB_History(EthernetUDP* conn){
+		this->conn = conn;
+
+		//Finds an unused file name, so a reset mid-flight does not mix two up-times in one file
+		for(uint8_t i = 0; i != 100; i++){
+			sprintf(fileName, "HIST%02u.BIN", i);
+			if(!SD.exists(fileName)){
+				status = true;
+				break;
+			}
+		}
+		if(!status){
+			HAB_Logging::printLogln("No free history file name!");
+		}
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStatus																|
+		|	Purpose: 	Returns true if records are being written to the SD card.				|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_History::getStatus(){
+				return status;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getRecordCount															|
+		|	Purpose: 	Returns the number of records on the SD card.							|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_History::getRecordCount(){
+				return recordCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getBackfillCount														|
+		|	Purpose: 	Returns the number of records from link outages not yet sent.			|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_History::getBackfillCount(){
+				uint32_t count = 0;
+				for(uint8_t i = 0; i != gapCount; i++){
+					count += gaps[i].end - gaps[i].start;
+				}
+				return count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSentCount															|
+		|	Purpose: 	Returns the number of records sent from the SD card.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_History::getSentCount(){
+				return sentCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isQueryActive															|
+		|	Purpose: 	Returns true if a GET_HISTORY range is being sent.						|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_History::isQueryActive(){
+				return queryActive;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addDestination															|
+		|	Purpose: 	Adds a destination that records are sent to.							|
+		|	Arguments:	IPAddress, uint16_t														|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_History::addDestination(IPAddress ip, uint16_t port){
+				if(destCount < HISTORY_MAX_DESTINATIONS){
+					destIP[destCount] = ip;
+					destPort[destCount] = port;
+					destCount++;
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setConnected															|
+		|	Purpose: 	Tells the history whether the link is up. The records written while it	|
+		|				was down are queued for backfill once it comes back.					|
+		|	Arguments:	bool																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_History::setConnected(bool connected){
+				if(connected == this->connected){ return; }
+				this->connected = connected;
+
+				//Link lost, remembers where the outage started
+				if(!connected){
+					gapStart = recordCount;
+					return;
+				}
+
+				//Link back, queues the outage (if full, merges it into the last one)
+				if(recordCount == gapStart){ return; }
+				if(gapCount == HISTORY_MAX_GAPS){
+					gaps[gapCount - 1].end = recordCount;
+				}
+				else{
+					gaps[gapCount].start = gapStart;
+					gaps[gapCount].end = recordCount;
+					gapCount++;
+				}
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		append																	|
+		|	Purpose: 	Writes a record to the end of the file, and to the index every			|
+		|				indexStride records. When the index fills, every other entry is			|
+		|				dropped and the stride doubles.											|
+		|	Arguments:	historyRecord															|
+		|	Returns:	bool (false if it could not be written)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_History::append(const historyRecord& record){
+				if(!status){ return false; }
+
+				File historyFile = SD.open(fileName, FILE_WRITE);
+				if(!historyFile){ return false; }
+				size_t written = historyFile.write((const uint8_t*)&record, sizeof(historyRecord));
+				historyFile.close();
+				if(written != sizeof(historyRecord)){
+					//Part of a record would shift every record after it, so writing stops
+					if(written != 0){
+						status = false;
+						HAB_Logging::printLogln("History file damaged, stopped writing!");
+					}
+					return false;
+				}
+
+				//Index
+				if(recordCount % indexStride == 0){
+					if(indexCount == HISTORY_INDEX_SIZE){
+						for(uint8_t i = 0; i != HISTORY_INDEX_SIZE / 2; i++){
+							indexTime[i] = indexTime[i * 2];
+						}
+						indexCount = HISTORY_INDEX_SIZE / 2;
+						indexStride *= 2;
+					}
+					if(recordCount % indexStride == 0){
+						indexTime[indexCount++] = (record.time > 65535UL ? 65535 : record.time);
+					}
+				}
+				recordCount++;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		startQuery																|
+		|	Purpose: 	Starts sending every stride'th record between two up-times (s). It		|
+		|				replaces any range still being sent.									|
+		|	Arguments:	uint32_t, uint32_t, uint16_t											|
+		|	Returns:	bool (false if there are no records in the range)						|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_History::startQuery(uint32_t startTime, uint32_t endTime, uint16_t stride){
+				if(endTime < startTime || stride == 0){ return false; }
+
+				queryNext = findRecord(startTime);
+				queryEndTime = endTime;
+				queryStride = stride;
+				queryActive = (queryNext < recordCount);
+				return queryActive;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		cancelQuery																|
+		|	Purpose: 	Stops sending the range asked for.										|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_History::cancelQuery(){
+				queryActive = false;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Sends the next record of the query, else of the oldest outage, at		|
+		|				most HISTORY_RATE a second. Should only be called while connected,		|
+		|				after the live telemetry.												|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_History::update(){
+				if(destCount == 0 || (millis() - lastSend) < (1000 / HISTORY_RATE)){ return; }
+				historyRecord record;
+
+				//Range asked for first
+				if(queryActive){
+					if(queryNext >= recordCount || !readRecord(queryNext, record) || record.time > queryEndTime){
+						queryActive = false;
+						HAB_Logging::printLogln("History range sent!");
+						return;
+					}
+					sendRecord(record);
+					queryNext += queryStride;
+				}
+				//Then the outages, oldest first
+				else if(gapCount > 0){
+					if(readRecord(gaps[0].start, record)){ sendRecord(record); }
+					gaps[0].start++;
+					if(gaps[0].start >= gaps[0].end){
+						for(uint8_t i = 1; i != gapCount; i++){ gaps[i - 1] = gaps[i]; }
+						gapCount--;
+					}
+				}
+				else{
+					return;
+				}
+				lastSend = millis();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		readRecord																|
+		|	Purpose: 	Reads a record from the SD card by its number.							|
+		|	Arguments:	uint32_t, historyRecord													|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_History::readRecord(uint32_t number, historyRecord& record){
+				File historyFile = SD.open(fileName, FILE_READ);
+				if(!historyFile){ return false; }
+
+				bool found = historyFile.seek(number * sizeof(historyRecord))
+					&& historyFile.read(&record, sizeof(historyRecord)) == sizeof(historyRecord);
+				historyFile.close();
+				return found;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		findRecord																|
+		|	Purpose: 	Returns the first record at or after a time. The index narrows it to	|
+		|				one stride, which is then binary searched on the card.					|
+		|	Arguments:	uint32_t																|
+		|	Returns:	uint32_t (recordCount if there is none)									|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_History::findRecord(uint32_t time){
+				if(indexCount == 0){ return recordCount; }
+
+				//Last index entry at or before the time
+				uint16_t key = (time > 65535UL ? 65535 : time);
+				uint8_t low = 0;
+				uint8_t high = indexCount;
+				while(high - low > 1){
+					uint8_t mid = (low + high) / 2;
+					if(indexTime[mid] <= key){ low = mid; }
+					else{ high = mid; }
+				}
+
+				//First record in that stride with time >= the one asked for
+				uint32_t first = (uint32_t)low * indexStride;
+				uint32_t last = first + indexStride;
+				if(last > recordCount){ last = recordCount; }
+				historyRecord record;
+				while(first < last){
+					uint32_t mid = first + (last - first) / 2;
+					if(!readRecord(mid, record)){ return recordCount; }
+					if(record.time < time){ first = mid + 1; }
+					else{ last = mid; }
+				}
+				return first;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sendRecord																|
+		|	Purpose: 	Sends a record as text to each destination: [HIST]time,altitude(m),		|
+		|				latitude,longitude,speed,temperature,pressure,humidity, then each		|
+		|				pod as position/temperature/actuator override/heater override.			|
+		|	Arguments:	historyRecord															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_History::sendRecord(const historyRecord& record){
+				char packet[HISTORY_PACKET_SIZE];
+				char field[16];
+
+				sprintf(packet, "[HIST]%lu,", (unsigned long)record.time);
+				strcat(packet, formatFixed(field, record.altitude, 2)); strcat(packet, ",");
+				strcat(packet, formatFixed(field, record.latitude, 6)); strcat(packet, ",");
+				strcat(packet, formatFixed(field, record.longitude, 6)); strcat(packet, ",");
+				strcat(packet, formatFixed(field, record.speed, 2)); strcat(packet, ",");
+				strcat(packet, formatFixed(field, record.temperature, 2)); strcat(packet, ",");
+				strcat(packet, ultoa(record.pressure, field, 10)); strcat(packet, ",");
+				strcat(packet, formatFixed(field, record.humidity, 2));
+				for(uint8_t i = 0; i != HISTORY_PODS; i++){
+					strcat(packet, ",");
+					strcat(packet, utoa(record.podPosition[i], field, 10)); strcat(packet, "/");
+					strcat(packet, formatFixed(field, record.podTemperature[i], 2)); strcat(packet, "/");
+					strcat(packet, utoa((record.podStatus >> (i * 4)) & 0x3, field, 10)); strcat(packet, "/");
+					strcat(packet, utoa((record.podStatus >> (i * 4 + 2)) & 0x3, field, 10));
+				}
+
+				for(uint8_t i = 0; i != destCount; i++){
+					conn->beginPacket(destIP[i], destPort[i]);
+					conn->write((const uint8_t*)packet, strlen(packet));
+					conn->endPacket();
+				}
+				sentCount++;
+			}
@@ -0,0 +1,162 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep every telemetry record on the SD card, with a sparse
+*				time index in memory. Records missed while the link was down are sent later, and
+*				any time range can be asked for.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_History_h
+#define HAB_History_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <SPI.h>
+	#include <SD.h>
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+	#include <HAB_Fixed.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef HISTORY_PODS
+		#define HISTORY_PODS 4
+	#endif
+
+	//One telemetry record, in fixed point so it is small and needs no float formatting
+	struct historyRecord {
+		uint32_t time; //Up-time (s)
+		int32_t altitude; //cm
+		int32_t latitude; //Micro-degrees
+		int32_t longitude; //Micro-degrees
+		int16_t speed; //cm/s
+		int16_t temperature; //Hundredths of a degree C
+		uint32_t pressure; //Pa
+		uint16_t humidity; //Hundredths of a percent
+		uint16_t podPosition[HISTORY_PODS];
+		int16_t podTemperature[HISTORY_PODS]; //Hundredths of a degree C
+		uint16_t podStatus; //4 bits per pod: actuator override (0-2), then heater override (0-2)
+	};
+
+
+class HAB_History {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef HISTORY_INDEX_SIZE
+			#define HISTORY_INDEX_SIZE 64 //Index entries, the spacing doubles each time it fills
+		#endif
+		#ifndef HISTORY_RATE
+			#define HISTORY_RATE 4 //Records per second sent from the card, live telemetry goes first
+		#endif
+		#ifndef HISTORY_MAX_GAPS
+			#define HISTORY_MAX_GAPS 4 //Link outages waiting to be backfilled
+		#endif
+		#ifndef HISTORY_MAX_DESTINATIONS
+			#define HISTORY_MAX_DESTINATIONS 2
+		#endif
+		#ifndef HISTORY_PACKET_SIZE
+			#define HISTORY_PACKET_SIZE 160 //A record is about 140 characters as text
+		#endif
+
+		//Records [start, end) not yet sent
+		struct historyRange {
+			uint32_t start;
+			uint32_t end;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//File on the SD card, a new one each boot since the up-time starts over
+		char fileName[13];
+		uint32_t recordCount = 0;
+		bool status = false;
+
+		//Sparse index, entry i is the time of record i * indexStride
+		uint16_t indexTime[HISTORY_INDEX_SIZE];
+		uint8_t indexCount = 0;
+		uint32_t indexStride = 1;
+
+		//Backfill of link outages
+		bool connected = false;
+		uint32_t gapStart = 0;
+		historyRange gaps[HISTORY_MAX_GAPS];
+		uint8_t gapCount = 0;
+
+		//Range asked for by GET_HISTORY
+		bool queryActive = false;
+		uint32_t queryNext = 0;
+		uint32_t queryEndTime = 0;
+		uint16_t queryStride = 1;
+
+		//Where the records are sent
+		EthernetUDP* conn;
+		IPAddress destIP[HISTORY_MAX_DESTINATIONS];
+		uint16_t destPort[HISTORY_MAX_DESTINATIONS];
+		uint8_t destCount = 0;
+		unsigned long lastSend = 0;
+		uint32_t sentCount = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_History(EthernetUDP* conn);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool getStatus();
+			uint32_t getRecordCount();
+			uint32_t getBackfillCount();
+			uint32_t getSentCount();
+			bool isQueryActive();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			void addDestination(IPAddress ip, uint16_t port);
+			void setConnected(bool connected);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool append(const historyRecord& record);
+			bool startQuery(uint32_t startTime, uint32_t endTime, uint16_t stride);
+			void cancelQuery();
+			void update();
+
+		private:
+			bool readRecord(uint32_t number, historyRecord& record);
+			uint32_t findRecord(uint32_t time);
+			void sendRecord(const historyRecord& record);
+};
+
+#endif
@@ -0,0 +1,257 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to predict where the payload will land. The wind in each
+*				altitude band is learnt from the GPS track, and once descending the fall to the
+*				ground is stepped through the bands, giving a landing point and its error.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Landing.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Metres in a microdegree of latitude, and of longitude at the equator
+	#define METRES_PER_MICRODEGREE 0.111319
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Landing::HAB_Landing(){
+		memset(bands, 0, sizeof(bands));
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		hasPrediction															|
+		|	Purpose: 	Returns true once a landing point has been predicted, from the first	|
+		|				update while descending. The last one is kept after landing.			|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Landing::hasPrediction(){
+				return predicted;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLatitude																|
+		|	Purpose: 	Returns the predicted landing latitude.									|
+		|	Arguments:	void																	|
+		|	Returns:	MicroDegrees															|
+		\*-------------------------------------------------------------------------------------*/
+			MicroDegrees HAB_Landing::getLatitude(){
+				return latitude;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLongitude															|
+		|	Purpose: 	Returns the predicted landing longitude.								|
+		|	Arguments:	void																	|
+		|	Returns:	MicroDegrees															|
+		\*-------------------------------------------------------------------------------------*/
+			MicroDegrees HAB_Landing::getLongitude(){
+				return longitude;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimeToLanding														|
+		|	Purpose: 	Returns the predicted time left to landing (s).							|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Landing::getTimeToLanding(){
+				return timeToLanding;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getErrorEast															|
+		|	Purpose: 	Returns the error ellipse's east-west axis, 1 sigma (m).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Landing::getErrorEast(){
+				return errorEast;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getErrorNorth															|
+		|	Purpose: 	Returns the error ellipse's north-south axis, 1 sigma (m).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Landing::getErrorNorth(){
+				return errorNorth;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getBandCount															|
+		|	Purpose: 	Returns the number of altitude bands with wind samples.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Landing::getBandCount(){
+				uint8_t count = 0;
+				for(uint8_t i = 0; i != LANDING_BANDS; i++){
+					if(bands[i].count != 0){ count++; }
+				}
+				return count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDescentRate															|
+		|	Purpose: 	Returns the descent rate the drag model has at sea level (m/s).			|
+		|	Arguments:	void																	|
+		|	Returns:	float																	|
+		\*-------------------------------------------------------------------------------------*/
+			float HAB_Landing::getDescentRate(){
+				return descentRate;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getBand																	|
+		|	Purpose: 	Returns the band an altitude (m) is in.									|
+		|	Arguments:	float																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Landing::getBand(float altitude){
+				if(altitude <= 0){ return 0; }
+				return (uint8_t)min(altitude / LANDING_BAND_HEIGHT, (float)(LANDING_BANDS - 1));
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Takes a GPS fix. The drift since the last one is a wind sample for the	|
+		|				band between them, going up or down. While descending the measured		|
+		|				rate fits the drag model, and the landing point is predicted again.		|
+		|				A repeated fix is ignored.												|
+		|	Arguments:	Centimetres, CentimetresPerSecond, MicroDegrees (latitude),				|
+		|				MicroDegrees (longitude), Centimetres (ground), bool					|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Landing::update(Centimetres altitude, CentimetresPerSecond climbRate, MicroDegrees latitude, MicroDegrees longitude,
+				Centimetres ground, bool descending){
+				if(lastFixTime != 0 && latitude == lastLatitude && longitude == lastLongitude && altitude == lastAltitude){ return; }
+
+				float metres = toFloat(altitude);
+				float metresPerLongitude = METRES_PER_MICRODEGREE * cos(toFloat(latitude) * DEG_TO_RAD);
+				unsigned long gap = millis() - lastFixTime;
+
+				//Wind sample--------------------------------------------------|
+					if(lastFixTime != 0 && gap >= LANDING_MIN_GAP && gap <= LANDING_MAX_GAP){
+						float seconds = gap / 1000.0;
+						float east = (longitude - lastLongitude).value() * metresPerLongitude / seconds;
+						float north = (latitude - lastLatitude).value() * METRES_PER_MICRODEGREE / seconds;
+						addWind(getBand((metres + toFloat(lastAltitude)) / 2), east, north);
+					}
+					lastLatitude = latitude;
+					lastLongitude = longitude;
+					lastAltitude = altitude;
+					lastFixTime = max(millis(), 1UL);
+
+				//Prediction---------------------------------------------------|
+					if(!descending){ return; }
+
+					//The measured rate back to sea level, as the drag model has it
+					float rate = -toFloat(climbRate);
+					if(rate > 0.5 && metres > toFloat(ground) + LANDING_BAND_HEIGHT){
+						descentRate += (rate * exp(-metres / (2 * LANDING_SCALE_HEIGHT)) - descentRate) / 8;
+					}
+					predict(metres, toFloat(ground), latitude, longitude);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addWind																	|
+		|	Purpose: 	Adds a wind sample (m/s) to a band. The mean and variance average the	|
+		|				first LANDING_BAND_SAMPLES, then fade the older ones.					|
+		|	Arguments:	uint8_t, float (east), float (north)									|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Landing::addWind(uint8_t band, float east, float north){
+				windBand* wind = bands + band;
+				if(wind->count != LANDING_BAND_SAMPLES){ wind->count++; }
+
+				float weight = 1.0 / wind->count;
+				float deltaEast = east - wind->east;
+				float deltaNorth = north - wind->north;
+				wind->east += weight * deltaEast;
+				wind->north += weight * deltaNorth;
+				wind->eastVariance = (1 - weight) * (wind->eastVariance + weight * deltaEast * deltaEast);
+				wind->northVariance = (1 - weight) * (wind->northVariance + weight * deltaNorth * deltaNorth);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		predict																	|
+		|	Purpose: 	Steps the fall from an altitude (m) to the ground through each band,	|
+		|				drifting with its wind for the time the drag model takes to cross it.	|
+		|				A band without samples takes the wind of the one above it. The error of	|
+		|				each band's mean and the descent rate's error give the error ellipse.	|
+		|				At most LANDING_BANDS steps.											|
+		|	Arguments:	float, float (ground), MicroDegrees (latitude), MicroDegrees			|
+		|				(longitude)																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Landing::predict(float altitude, float ground, MicroDegrees latitude, MicroDegrees longitude){
+				float east = 0, north = 0;
+				float eastVariance = 0, northVariance = 0;
+				float time = 0;
+				windBand* known = NULL;
+
+				uint8_t bottomBand = getBand(ground);
+				for(int8_t band = getBand(altitude); band >= bottomBand; band--){
+					float top = (band == LANDING_BANDS - 1 ? altitude : min(altitude, (float)(band + 1) * LANDING_BAND_HEIGHT));
+					float bottom = max(ground, (float)band * LANDING_BAND_HEIGHT);
+					if(top <= bottom){ continue; }
+
+					//Time to cross it, at the speed in its middle
+					float crossing = (top - bottom) / (descentRate * exp((top + bottom) / (4 * LANDING_SCALE_HEIGHT)));
+					time += crossing;
+
+					//Its wind, else the one above it, else none with a wide spread
+					if(bands[band].count != 0){ known = bands + band; }
+					if(known != NULL){
+						east += known->east * crossing;
+						north += known->north * crossing;
+						eastVariance += crossing * crossing * (known->eastVariance / known->count + LANDING_WIND_ERROR * LANDING_WIND_ERROR);
+						northVariance += crossing * crossing * (known->northVariance / known->count + LANDING_WIND_ERROR * LANDING_WIND_ERROR);
+					}
+					else{
+						eastVariance += crossing * crossing * LANDING_UNKNOWN_WIND * LANDING_UNKNOWN_WIND;
+						northVariance += crossing * crossing * LANDING_UNKNOWN_WIND * LANDING_UNKNOWN_WIND;
+					}
+				}
+
+				//The descent rate scales the whole drift
+				eastVariance += (LANDING_RATE_ERROR * east) * (LANDING_RATE_ERROR * east);
+				northVariance += (LANDING_RATE_ERROR * north) * (LANDING_RATE_ERROR * north);
+
+				this->latitude = MicroDegrees(latitude.value() + (int32_t)(north / METRES_PER_MICRODEGREE));
+				this->longitude = MicroDegrees(longitude.value() + (int32_t)(east / (METRES_PER_MICRODEGREE * cos(toFloat(latitude) * DEG_TO_RAD))));
+				timeToLanding = (uint16_t)min(time, 65535.0f);
+				errorEast = (uint16_t)min(sqrt(eastVariance), 65535.0);
+				errorNorth = (uint16_t)min(sqrt(northVariance), 65535.0);
+				predicted = true;
+			}
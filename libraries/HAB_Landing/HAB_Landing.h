@@ -0,0 +1,139 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to predict where the payload will land. The wind in each
+*				altitude band is learnt from the GPS track, and once descending the fall to the
+*				ground is stepped through the bands, giving a landing point and its error.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Landing_h
+#define HAB_Landing_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <HAB_Fixed.h>
+
+
+class HAB_Landing {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		//Altitude bands, the top one holds everything above it
+		#ifndef LANDING_BANDS
+			#define LANDING_BANDS 32
+		#endif
+		#ifndef LANDING_BAND_HEIGHT
+			#define LANDING_BAND_HEIGHT 1000 //m
+		#endif
+		#ifndef LANDING_BAND_SAMPLES
+			#define LANDING_BAND_SAMPLES 30 //Samples a band averages over, after which older ones fade
+		#endif
+
+		//Wind samples, from fixes this far apart (ms)
+		#ifndef LANDING_MIN_GAP
+			#define LANDING_MIN_GAP 500
+		#endif
+		#ifndef LANDING_MAX_GAP
+			#define LANDING_MAX_GAP 10000
+		#endif
+
+		//Descent, the drag model's speed grows with the thinner air as exp(altitude / 2 scale height)
+		#ifndef LANDING_DESCENT_RATE
+			#define LANDING_DESCENT_RATE 5.0 //m/s at sea level, until it is measured
+		#endif
+		#ifndef LANDING_SCALE_HEIGHT
+			#define LANDING_SCALE_HEIGHT 7000.0 //m
+		#endif
+
+		//Error, added to each band's measured spread
+		#ifndef LANDING_WIND_ERROR
+			#define LANDING_WIND_ERROR 1.5 //m/s, the wind has changed since the band was crossed
+		#endif
+		#ifndef LANDING_UNKNOWN_WIND
+			#define LANDING_UNKNOWN_WIND 10.0 //m/s, above the highest band with samples
+		#endif
+		#ifndef LANDING_RATE_ERROR
+			#define LANDING_RATE_ERROR 0.15 //Fraction of the drift, from the descent rate
+		#endif
+
+		//Wind of a band (m/s), its mean and variance each way, weighted to the latest samples
+		struct windBand {
+			uint8_t count;
+			float east;
+			float north;
+			float eastVariance;
+			float northVariance;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		windBand bands[LANDING_BANDS];
+
+		//Last fix, for the next wind sample
+		MicroDegrees lastLatitude;
+		MicroDegrees lastLongitude;
+		Centimetres lastAltitude;
+		unsigned long lastFixTime = 0;
+
+		//Sea level descent rate (m/s), fitted from the measured descent
+		float descentRate = LANDING_DESCENT_RATE;
+
+		//Last prediction
+		bool predicted = false;
+		MicroDegrees latitude;
+		MicroDegrees longitude;
+		uint16_t timeToLanding = 0; //s
+		uint16_t errorEast = 0; //m, 1 sigma
+		uint16_t errorNorth = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Landing();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			bool hasPrediction();
+			MicroDegrees getLatitude();
+			MicroDegrees getLongitude();
+			uint16_t getTimeToLanding();
+			uint16_t getErrorEast();
+			uint16_t getErrorNorth();
+			uint8_t getBandCount();
+			float getDescentRate();
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			void update(Centimetres altitude, CentimetresPerSecond climbRate, MicroDegrees latitude, MicroDegrees longitude,
+				Centimetres ground, bool descending);
+
+		private:
+			void addWind(uint8_t band, float east, float north);
+			void predict(float altitude, float ground, MicroDegrees latitude, MicroDegrees longitude);
+			static uint8_t getBand(float altitude);
+};
+
+#endif
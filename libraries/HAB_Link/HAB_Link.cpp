@@ -0,0 +1,176 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure the quality of the link to the ground (round trip
+*				time, jitter and loss) with timestamped pings, and picks a telemetry rate to match.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Link.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Link::HAB_Link(EthernetUDP* conn, IPAddress ip, uint16_t port){
+		this->conn = conn;
+		this->ip = ip;
+		this->port = port;
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getRtt																	|
+		|	Purpose: 	Returns the smoothed round trip time in milliseconds.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Link::getRtt(){
+				return rtt;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getJitter																|
+		|	Purpose: 	Returns the smoothed change in round trip time in milliseconds.			|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Link::getJitter(){
+				return jitter;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoss																	|
+		|	Purpose: 	Returns the percent of the last 32 pings that were not answered. Pings	|
+		|				still within the pong timeout are not counted yet.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Link::getLoss(){
+				const uint8_t pending = LINK_PONG_TIMEOUT / LINK_PING_INTERVAL;
+				if(sentCount <= pending){ return 0; }
+
+				uint8_t lost = 0;
+				for(uint8_t i = pending; i != sentCount; i++){
+					if(!(receivedMask & (1UL << i))){ lost++; }
+				}
+				return (lost * 100U) / (sentCount - pending);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getInterval																|
+		|	Purpose: 	Returns the telemetry interval the link can carry, in milliseconds.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Link::getInterval(){
+				return interval;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		handlePong																|
+		|	Purpose: 	Records the answer to a ping. The ground echoes the sequence number		|
+		|				and the time it was sent, so nothing is stored per ping.				|
+		|	Arguments:	uint16_t, unsigned long													|
+		|	Returns:	bool (false if it was not a ping in the window, or a repeat)			|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Link::handlePong(uint16_t seq, unsigned long sentTime){
+				uint16_t age = nextSeq - 1 - seq;
+				unsigned long now = millis();
+				if(age >= sentCount || (receivedMask & (1UL << age)) || (now - sentTime) > 60000UL){ return false; }
+
+				receivedMask |= (1UL << age);
+				lastPong = now;
+
+				//Smooths like TCP: RTT by 1/8, jitter by 1/16
+				uint16_t sample = now - sentTime;
+				if(!hasRtt){
+					rtt = sample;
+					jitter = sample / 2;
+					hasRtt = true;
+				}
+				else{
+					rtt = (int32_t)rtt + ((int32_t)sample - (int32_t)rtt) / 8;
+					uint16_t change = (sample > lastRtt ? sample - lastRtt : lastRtt - sample);
+					jitter = (int32_t)jitter + ((int32_t)change - (int32_t)jitter) / 16;
+				}
+				lastRtt = sample;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Sends a ping when due, as "[PING]<seq>,<millis>", and adjusts the		|
+		|				telemetry rate. Should be called once per loop while connected.			|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Link::update(){
+				unsigned long now = millis();
+				if((now - lastPing) < LINK_PING_INTERVAL){ return; }
+				lastPing = now;
+
+				//Adjusts the rate from the pings so far, before the window moves
+				adjustRate();
+
+				//Moves the window
+				receivedMask <<= 1;
+				if(sentCount < 32){ sentCount++; }
+
+				//Sends the ping straight away, queueing it would add to the round trip time
+				char ping[24];
+				sprintf(ping, "[PING]%u,%lu", nextSeq++, now);
+				conn->beginPacket(ip, port);
+				conn->write((const uint8_t*)ping, strlen(ping));
+				conn->endPacket();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		adjustRate																|
+		|	Purpose: 	Raises the telemetry rate a step at a time while the link is healthy,	|
+		|				halves it when it degrades, and drops to the survival rate when the		|
+		|				pongs stop. Until the first pong it stays at the starting rate.			|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Link::adjustRate(){
+				uint8_t loss = getLoss();
+
+				//Never answered, a groundstation that doesn't answer pings keeps the starting rate
+				if(!hasRtt){
+					interval = LINK_START_INTERVAL;
+				}
+				//The answers stopped, only the survival rate
+				else if((millis() - lastPong) > LINK_SURVIVAL_TIMEOUT){
+					interval = LINK_SURVIVAL_INTERVAL;
+				}
+				//Degraded, halves the rate
+				else if(loss > LINK_LOSS_HIGH || rtt > LINK_RTT_HIGH){
+					interval = (interval > LINK_SURVIVAL_INTERVAL / 2 ? LINK_SURVIVAL_INTERVAL : interval * 2);
+				}
+				//Healthy, adds a step to the rate (in mHz)
+				else if(loss < LINK_LOSS_LOW && rtt < LINK_RTT_LOW){
+					uint32_t rate = 1000000UL / interval + LINK_RATE_STEP;
+					interval = 1000000UL / rate;
+					if(interval < LINK_MIN_INTERVAL){ interval = LINK_MIN_INTERVAL; }
+				}
+			}
@@ -0,0 +1,122 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure the quality of the link to the ground (round trip
+*				time, jitter and loss) with timestamped pings, and picks a telemetry rate to match.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Link_h
+#define HAB_Link_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+
+
+class HAB_Link {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef LINK_PING_INTERVAL
+			#define LINK_PING_INTERVAL 500 //ms
+		#endif
+		#ifndef LINK_PONG_TIMEOUT
+			#define LINK_PONG_TIMEOUT 2000 //A ping is only counted as lost after this long (ms)
+		#endif
+		#ifndef LINK_SURVIVAL_TIMEOUT
+			#define LINK_SURVIVAL_TIMEOUT 3000 //No pongs for this long drops to the survival rate (ms)
+		#endif
+		#ifndef LINK_MIN_INTERVAL
+			#define LINK_MIN_INTERVAL 100 //10 Hz
+		#endif
+		#ifndef LINK_START_INTERVAL
+			#define LINK_START_INTERVAL 1000 //1 Hz
+		#endif
+		#ifndef LINK_SURVIVAL_INTERVAL
+			#define LINK_SURVIVAL_INTERVAL 5000 //0.2 Hz
+		#endif
+		#ifndef LINK_RATE_STEP
+			#define LINK_RATE_STEP 500 //Rate added each healthy ping (mHz)
+		#endif
+		#ifndef LINK_LOSS_LOW
+			#define LINK_LOSS_LOW 3 //Percent, below this (and RTT_LOW) the rate is raised
+		#endif
+		#ifndef LINK_LOSS_HIGH
+			#define LINK_LOSS_HIGH 10 //Percent, above this (or RTT_HIGH) the rate is halved
+		#endif
+		#ifndef LINK_RTT_LOW
+			#define LINK_RTT_LOW 300 //ms
+		#endif
+		#ifndef LINK_RTT_HIGH
+			#define LINK_RTT_HIGH 1000 //ms
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//Where the pings go. Both groundstations share the radio link, so one is enough.
+		EthernetUDP* conn;
+		IPAddress ip;
+		uint16_t port;
+
+		//Pings
+		uint16_t nextSeq = 0;
+		uint8_t sentCount = 0; //Pings in the window, up to 32
+		uint32_t receivedMask = 0; //Bit n is set if ping nextSeq-1-n was answered
+		unsigned long lastPing = 0;
+		unsigned long lastPong = 0;
+
+		//Round trip time and jitter (ms), smoothed
+		bool hasRtt = false;
+		uint16_t rtt = 0;
+		uint16_t lastRtt = 0;
+		uint16_t jitter = 0;
+
+		//Telemetry interval picked for the link (ms)
+		uint16_t interval = LINK_START_INTERVAL;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Link(EthernetUDP* conn, IPAddress ip, uint16_t port);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint16_t getRtt();
+			uint16_t getJitter();
+			uint8_t getLoss();
+			uint16_t getInterval();
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool handlePong(uint16_t seq, unsigned long sentTime);
+			void update();
+
+		private:
+			void adjustRate();
+};
+
+#endif
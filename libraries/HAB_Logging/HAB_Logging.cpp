@@ -237,6 +237,9 @@
 				   dataFile.print(",");
                    dataFile.print(i);
                    dataFile.print("_heat_status");
+				   dataFile.print(",");
+                   dataFile.print(i);
+                   dataFile.print("_motion");
                 }
 
                 dataFile.println();
@@ -260,6 +263,7 @@
 		void HAB_Logging::writeToExcel(BMEReadings bmeReadings, GPSReadings gpsReadings, actuatorReadings* actReadingsArray, int arrLength) {
         
             File dataFile = SD.open("datalog.txt", FILE_WRITE);
+            char number[16];
         
             if(dataFile) {               
                 //Time (H:M:S), Altitude, Speed, Longitude, Latitude, Temperature, Pressure, Humidity
@@ -267,24 +271,39 @@
                 //dataFile.print(gpsReadings.minute);    		dataFile.print(":"); 
                 //dataFile.print(gpsReadings.second);    		dataFile.print(",");
                 dataFile.print(HAB_Logging::getTimeFormatted());	dataFile.print(",");
-                dataFile.print(gpsReadings.altitude);       		dataFile.print(",");
-                dataFile.print(gpsReadings.speed);          		dataFile.print(",");
-                dataFile.print(gpsReadings.longitude);      		dataFile.print(",");
-                dataFile.print(gpsReadings.latitude);       		dataFile.print(",");
-                dataFile.print(bmeReadings.temperature);    		dataFile.print(",");
-                dataFile.print(bmeReadings.pressure);       		dataFile.print(",");
-                dataFile.print(bmeReadings.humidity);
+                dataFile.print(formatFixed(number, gpsReadings.altitude));       	dataFile.print(",");
+                dataFile.print(formatFixed(number, gpsReadings.speed));          	dataFile.print(",");
+                dataFile.print(formatFixed(number, gpsReadings.longitude));      	dataFile.print(",");
+                dataFile.print(formatFixed(number, gpsReadings.latitude));       	dataFile.print(",");
+                dataFile.print(formatFixed(number, bmeReadings.temperature));    	dataFile.print(",");
+                dataFile.print(formatFixed(number, bmeReadings.pressure));       	dataFile.print(",");
+                dataFile.print(formatFixed(number, bmeReadings.humidity));
 
                 //Actuator statuses
                 for(int i = 0; i != arrLength; i++){
 				   dataFile.print(",");
                    dataFile.print(actReadingsArray[i].position);
 				   dataFile.print(",");
-				   dataFile.print(actReadingsArray[i].temperature);
+				   dataFile.print(formatFixed(number, actReadingsArray[i].temperature));
+				   dataFile.print(",");
+                   switch(actReadingsArray[i].actuatorStatus){
+                       case ACT_OVR_OPEN:  dataFile.print(F("OVR_OPEN")); break;
+                       case ACT_OVR_CLOSE: dataFile.print(F("OVR_CLOSE")); break;
+                       default:            dataFile.print(F("AUTO")); break;
+                   }
 				   dataFile.print(",");
-                   dataFile.print(actReadingsArray[i].actuatorStatusPtr);
+                   switch(actReadingsArray[i].heaterStatus){
+                       case HEAT_OVR_ENABLED:  dataFile.print(F("OVR_ENABLED")); break;
+                       case HEAT_OVR_DISABLED: dataFile.print(F("OVR_DISABLED")); break;
+                       default:                dataFile.print(F("AUTO")); break;
+                   }
 				   dataFile.print(",");
-                   dataFile.print(actReadingsArray[i].heaterStatusPtr);
+                   switch(actReadingsArray[i].motionStatus){
+                       case MOTION_MOVING:  dataFile.print(F("MOVING")); break;
+                       case MOTION_SLOW:    dataFile.print(F("SLOW")); break;
+                       case MOTION_STALLED: dataFile.print(F("STALLED")); break;
+                       default:             dataFile.print(F("IDLE")); break;
+                   }
 				}
 
                 //Print New Line
@@ -0,0 +1,190 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to follow an actuator's travel from its position readings. It
+*				estimates the speed, ends the travel once the position has settled at the limit,
+*				and flags actuators that stall or move slowly (usually cold).
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Motion.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Motion::HAB_Motion(){
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStatus																|
+		|	Purpose: 	Returns MOTION_MOVING during a travel, else how the last one ended.	|
+		|	Arguments:	void																	|
+		|	Returns:	MotionStatus															|
+		\*-------------------------------------------------------------------------------------*/
+			MotionStatus HAB_Motion::getStatus(){
+				return status;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isSampleDue																|
+		|	Purpose: 	Returns true if moving and the next position reading should be taken.	|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Motion::isSampleDue(){
+				return moving && (millis() - lastSample) >= MOTION_SAMPLE_INTERVAL;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isStalled																|
+		|	Purpose: 	Returns true if the actuator has been still short of its limit for		|
+		|				MOTION_STALL_TIME. Stays set until the next start or clear.				|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Motion::isStalled(){
+				return status == MOTION_STALLED;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isDone																	|
+		|	Purpose: 	Returns true once the travel can end: the limit has been reached and	|
+		|				the position has settled, or it has been pushed past the limit for		|
+		|				the given time (ms) without settling.									|
+		|	Arguments:	unsigned long															|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Motion::isDone(unsigned long maxPushTime){
+				if(!moving || limitTime == 0){ return false; }
+				unsigned long now = millis();
+				return (stillSince != 0 && (now - stillSince) >= MOTION_SETTLED_TIME) || (now - limitTime) >= maxPushTime;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getVelocity																|
+		|	Purpose: 	Returns the filtered speed of the position (ADC counts/s, negative		|
+		|				while opening).															|
+		|	Arguments:	void																	|
+		|	Returns:	int16_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			int16_t HAB_Motion::getVelocity(){
+				return velocity;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTravelTime															|
+		|	Purpose: 	Returns the time the last travel took to reach the limit, or to stop	|
+		|				if it stalled (ms). 0 if it was halted before either.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Motion::getTravelTime(){
+				return travelTime;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		start																	|
+		|	Purpose: 	Starts following a travel from the given position.						|
+		|	Arguments:	uint16_t																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Motion::start(uint16_t position){
+				unsigned long now = millis();
+				moving = true;
+				status = MOTION_MOVING;
+				startTime = now;
+				lastSample = now;
+				stillSince = 0;
+				limitTime = 0;
+				startPosition = position;
+				lastPosition = position;
+				velocity = 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Adds a position reading, and whether it is at the limit the actuator	|
+		|				is travelling to. The speed is smoothed over about four readings,		|
+		|				which is enough to see through a count or two of ADC noise.				|
+		|	Arguments:	uint16_t, bool															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Motion::update(uint16_t position, bool atLimit){
+				if(!moving){ return; }
+				unsigned long now = millis();
+				unsigned long elapsed = now - lastSample;
+				if(elapsed == 0){ return; }
+
+				//Speed since the last reading, then the filtered speed
+				int32_t instant = ((int32_t)position - lastPosition) * 1000 / (int32_t)elapsed;
+				instant = constrain(instant, -INT16_MAX, INT16_MAX);
+				velocity += (int16_t)((instant - velocity) / 4);
+				lastSample = now;
+				lastPosition = position;
+
+				//Times how long it has been still for
+				bool still = (now - startTime) >= MOTION_START_TIME && abs(velocity) < MOTION_SETTLED_SPEED;
+				if(!still){ stillSince = 0; }
+				else if(stillSince == 0){ stillSince = now; }
+
+				//The travel time is to the first reading at the limit, the rest is pushing it home
+				if(atLimit && limitTime == 0){
+					limitTime = now;
+					travelTime = now - startTime;
+				}
+
+				//Still short of the limit for too long, the travel time is then to where it stopped
+				if(limitTime == 0 && stillSince != 0 && (now - stillSince) >= MOTION_STALL_TIME && status != MOTION_STALLED){
+					status = MOTION_STALLED;
+					travelTime = stillSince - startTime;
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		stop																	|
+		|	Purpose: 	Ends the travel. If it reached the limit, flags it slow when it			|
+		|				averaged under MOTION_SLOW_SPEED.										|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Motion::stop(){
+				if(!moving){ return; }
+				moving = false;
+
+				if(status == MOTION_STALLED){ return; }
+				if(limitTime == 0){ travelTime = 0; status = MOTION_IDLE; return; }
+
+				uint32_t distance = abs((int32_t)lastPosition - startPosition);
+				status = (travelTime != 0 && distance * 1000 / travelTime < MOTION_SLOW_SPEED ? MOTION_SLOW : MOTION_IDLE);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		clear																	|
+		|	Purpose: 	Clears a stalled or slow flag, e.g. when the ground commands a retry.	|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Motion::clear(){
+				if(!moving){ status = MOTION_IDLE; }
+			}
@@ -0,0 +1,102 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to follow an actuator's travel from its position readings. It
+*				estimates the speed, ends the travel once the position has settled at the limit,
+*				and flags actuators that stall or move slowly (usually cold).
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Motion_h
+#define HAB_Motion_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <HAB_Structs.h>
+
+
+class HAB_Motion {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef MOTION_SAMPLE_INTERVAL
+			#define MOTION_SAMPLE_INTERVAL 200 //ms between position readings
+		#endif
+		#ifndef MOTION_SETTLED_SPEED
+			#define MOTION_SETTLED_SPEED 15 //ADC counts/s, below this the position is still (a moving actuator is 50 or more)
+		#endif
+		#ifndef MOTION_SETTLED_TIME
+			#define MOTION_SETTLED_TIME 600 //ms still at the limit before the travel ends
+		#endif
+		#ifndef MOTION_START_TIME
+			#define MOTION_START_TIME 1000 //ms before a still actuator can count as stalled
+		#endif
+		#ifndef MOTION_STALL_TIME
+			#define MOTION_STALL_TIME 2000 //ms still short of the limit before it has stalled
+		#endif
+		#ifndef MOTION_SLOW_SPEED
+			#define MOTION_SLOW_SPEED 30 //ADC counts/s, a travel averaging less is flagged slow
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		MotionStatus status = MOTION_IDLE;
+
+		//Current travel
+		bool moving = false;
+		unsigned long startTime = 0;
+		unsigned long lastSample = 0;
+		unsigned long stillSince = 0; //0 while moving
+		unsigned long limitTime = 0; //0 until the limit is reached
+		uint16_t startPosition = 0;
+		uint16_t lastPosition = 0;
+		int16_t velocity = 0; //ADC counts/s, filtered
+
+		//Time from the start to the limit (or to where it stalled) of the last travel (ms)
+		uint32_t travelTime = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Motion();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			MotionStatus getStatus();
+			bool isSampleDue();
+			bool isStalled();
+			bool isDone(unsigned long maxPushTime);
+			int16_t getVelocity();
+			uint32_t getTravelTime();
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			void start(uint16_t position);
+			void update(uint16_t position, bool atLimit);
+			void stop();
+			void clear();
+};
+
+#endif
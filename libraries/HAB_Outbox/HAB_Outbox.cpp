@@ -0,0 +1,427 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to queue outgoing messages and send them in batches,
+*				by priority and within a rate limit for each destination.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Outbox.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Marks where the telemetry goes in a send order
+	#define TELEMETRY_ENTRY 0xFF
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Outbox::HAB_Outbox(EthernetUDP* conn){
+		this->conn = conn;
+		for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){ slots[i].used = false; }
+		for(uint8_t i = 0; i != OUTBOX_MAX_DESTINATIONS; i++){ dests[i].active = false; }
+		memset(droppedCount, 0, sizeof(droppedCount));
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getQueuedCount															|
+		|	Purpose: 	Returns the number of events waiting to be sent.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Outbox::getQueuedCount(){
+				uint8_t count = 0;
+				for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){
+					if(slots[i].used){ count++; }
+				}
+				return count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDroppedCount															|
+		|	Purpose: 	Returns the number of events of a priority dropped because the queue	|
+		|				was full.																|
+		|	Arguments:	MessagePriority															|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Outbox::getDroppedCount(MessagePriority priority){
+				return droppedCount[priority];
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCoalescedCount														|
+		|	Purpose: 	Returns the number of events merged into an identical queued event.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Outbox::getCoalescedCount(){
+				return coalescedCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSupersededCount														|
+		|	Purpose: 	Returns the number of telemetry packets replaced before being sent.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Outbox::getSupersededCount(){
+				return supersededCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDatagramsSent														|
+		|	Purpose: 	Returns the number of datagrams sent to a destination.					|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Outbox::getDatagramsSent(uint8_t dest){
+				return (dest < destCount ? dests[dest].datagramsSent : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		hasTelemetry															|
+		|	Purpose: 	Returns true if a destination has telemetry waiting to be sent.			|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Outbox::hasTelemetry(uint8_t dest){
+				return (dest < destCount && dests[dest].active && dests[dest].telemetry != NULL);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addDestination															|
+		|	Purpose: 	Adds a destination. Events are only sent to destinations that want		|
+		|				them, telemetry is set for each destination.							|
+		|	Arguments:	IPAddress, uint16_t, bool												|
+		|	Returns:	int8_t (index of the destination, -1 if full)							|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_Outbox::addDestination(IPAddress ip, uint16_t port, bool events){
+				//Reuses a removed destination first
+				uint8_t index = 0;
+				while(index < destCount && dests[index].active){ index++; }
+				if(index >= OUTBOX_MAX_DESTINATIONS){ return -1; }
+				if(index == destCount){ destCount++; }
+
+				outboxDestination* dest = &dests[index];
+				dest->active = true;
+				dest->ip = ip;
+				dest->port = port;
+				dest->events = events;
+				dest->tokens = OUTBOX_BURST * 1000U;
+				dest->lastRefill = millis();
+				dest->telemetry = NULL;
+				dest->telemetryLen = 0;
+				dest->datagramsSent = 0;
+				return index;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		removeDestination														|
+		|	Purpose: 	Stops sending to a destination. Its index may be reused.				|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::removeDestination(uint8_t dest){
+				if(dest >= destCount){ return; }
+				dests[dest].active = false;
+				dests[dest].events = false;
+				dests[dest].telemetry = NULL;
+				dests[dest].telemetryLen = 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setTelemetry															|
+		|	Purpose: 	Sets the telemetry to send to a destination. Only the latest is kept,	|
+		|				the text must stay valid until it is sent or replaced. NULL clears it.	|
+		|	Arguments:	uint8_t, char*															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::setTelemetry(uint8_t dest, const char* telemetry){
+				if(dest >= destCount || !dests[dest].active){ return; }
+				if(dests[dest].telemetry != NULL){ supersededCount++; }
+				dests[dest].telemetry = telemetry;
+				dests[dest].telemetryLen = (telemetry != NULL ? strlen(telemetry) : 0);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		queue																	|
+		|	Purpose: 	Queues an event for the destinations that want events. An identical		|
+		|				queued event is not queued twice. If there is no slot or room for its	|
+		|				text, less important events are dropped to make it.						|
+		|	Arguments:	char*, MessagePriority													|
+		|	Returns:	bool (false if this event was dropped)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Outbox::queue(const char* msg, MessagePriority priority){
+				//Stamped with the time it happened
+				char prefix[24];
+				strcpy(prefix, "[EVENT]");
+				strcat(prefix, HAB_Logging::getTimestamp());
+				uint8_t prefixLen = strlen(prefix);
+				uint16_t msgLen = strlen(msg);
+				uint8_t len = (prefixLen + msgLen > OUTBOX_EVENT_SIZE ? OUTBOX_EVENT_SIZE : prefixLen + msgLen);
+
+				//Merges into an identical event that is still waiting, the whole message is compared
+				for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){
+					if(slots[i].used && slots[i].priority == priority && slots[i].len - slots[i].msgOffset == msgLen
+						&& memcmp(text + slots[i].start + slots[i].msgOffset, msg, msgLen) == 0){
+						coalescedCount++;
+						return true;
+					}
+				}
+
+				//Makes room, dropping the least important events while they are less important than this one
+				int8_t index = -1;
+				while(true){
+					for(uint8_t i = 0; i != OUTBOX_SLOTS && index == -1; i++){
+						if(!slots[i].used){ index = i; }
+					}
+					if(index != -1 && textUsed + len <= OUTBOX_TEXT_SIZE){ break; }
+
+					int8_t lowest = findLowestSlot();
+					if(lowest == -1 || slots[lowest].priority >= priority){
+						droppedCount[priority]++;
+						return false;
+					}
+					droppedCount[slots[lowest].priority]++;
+					freeSlot(lowest);
+				}
+
+				outboxSlot* slot = &slots[index];
+				slot->start = textUsed;
+				slot->len = len;
+				slot->msgOffset = prefixLen;
+				memcpy(text + textUsed, prefix, prefixLen);
+				memcpy(text + textUsed + prefixLen, msg, len - prefixLen);
+				textUsed += len;
+				slot->priority = priority;
+				slot->seq = nextSeq++;
+				slot->used = true;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		flush																	|
+		|	Purpose: 	Sends at most one datagram to each destination that is within its		|
+		|				rate limit. Should be called once per loop.								|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::flush(){
+				uint8_t order[OUTBOX_SLOTS + 1];
+				bool eventsReady = true;
+				bool eventsWaiting = (getQueuedCount() > 0);
+				uint16_t telemetryLen = 0;
+
+				//Refills every destination. Event destinations are refilled together so
+				//they stay in step, events are only sent once all of them are ready.
+				for(uint8_t d = 0; d != destCount; d++){
+					if(!dests[d].active){ continue; }
+					bool ready = refill(&dests[d]);
+					if(dests[d].events){
+						eventsReady = eventsReady && ready;
+						if(dests[d].telemetryLen > telemetryLen){ telemetryLen = dests[d].telemetryLen; }
+					}
+				}
+
+				//Events (and their telemetry) in a single datagram to each event destination
+				if(eventsReady && (eventsWaiting || telemetryLen > 0)){
+					uint8_t count = select(order, telemetryLen);
+					for(uint8_t d = 0; d != destCount; d++){
+						if(dests[d].events){ send(&dests[d], order, count); }
+					}
+					for(uint8_t i = 0; i != count; i++){
+						if(order[i] != TELEMETRY_ENTRY){ freeSlot(order[i]); }
+					}
+				}
+
+				//Telemetry alone to the other destinations
+				order[0] = TELEMETRY_ENTRY;
+				for(uint8_t d = 0; d != destCount; d++){
+					if(dests[d].active && !dests[d].events && dests[d].telemetry != NULL && dests[d].tokens >= 1000){
+						send(&dests[d], order, 1);
+					}
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		flushAll																|
+		|	Purpose: 	Sends everything queued, ignoring the rate limits. Used before the		|
+		|				program stops.															|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::flushAll(){
+				for(uint8_t attempt = 0; attempt != OUTBOX_SLOTS + 1 && getQueuedCount() > 0; attempt++){
+					for(uint8_t d = 0; d != destCount; d++){
+						dests[d].tokens = 1000;
+						dests[d].lastRefill = millis();
+					}
+					flush();
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		refill																	|
+		|	Purpose: 	Refills the datagram allowance of a destination.						|
+		|	Arguments:	outboxDestination*														|
+		|	Returns:	bool (true if a datagram can be sent)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Outbox::refill(outboxDestination* dest){
+				unsigned long now = millis();
+				uint32_t tokens = dest->tokens + (uint32_t)(now - dest->lastRefill) * OUTBOX_RATE;
+				dest->tokens = (tokens > OUTBOX_BURST * 1000UL ? OUTBOX_BURST * 1000U : tokens);
+				dest->lastRefill = now;
+				return (dest->tokens >= 1000);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		select																	|
+		|	Purpose: 	Picks what goes in the next datagram: by priority (alarms, acks,		|
+		|				telemetry, info), oldest first, as long as it fits.						|
+		|	Arguments:	uint8_t*, uint16_t														|
+		|	Returns:	uint8_t (number of entries in the order)								|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Outbox::select(uint8_t* order, uint16_t telemetryLen){
+				bool tried[OUTBOX_SLOTS];
+				uint8_t count = 0;
+				uint16_t size = 0;
+				memset(tried, 0, sizeof(tried));
+
+				for(int8_t level = MSG_ALARM; level >= MSG_INFO; level--){
+					//Telemetry has its own level, it is always sent if it is alone
+					if(level == MSG_TELEMETRY){
+						if(telemetryLen > 0 && (count == 0 || size + telemetryLen + 1 <= OUTBOX_PACKET_MAX_SIZE)){
+							order[count++] = TELEMETRY_ENTRY;
+							size += telemetryLen + 1;
+						}
+						continue;
+					}
+
+					//Events of this level, oldest first
+					while(true){
+						int8_t oldest = -1;
+						for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){
+							if(slots[i].used && !tried[i] && slots[i].priority == level
+								&& (oldest == -1 || (int16_t)(slots[i].seq - slots[oldest].seq) < 0)){
+								oldest = i;
+							}
+						}
+						if(oldest == -1){ break; }
+
+						tried[oldest] = true;
+						if(size + slots[oldest].len + 1 <= OUTBOX_PACKET_MAX_SIZE){
+							order[count++] = oldest;
+							size += slots[oldest].len + 1;
+						}
+					}
+				}
+				return count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		send																	|
+		|	Purpose: 	Sends the entries in order as one datagram, one entry per line. Its		|
+		|				telemetry waits for the next one if select() left it out.				|
+		|	Arguments:	outboxDestination*, uint8_t*, uint8_t									|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::send(outboxDestination* dest, const uint8_t* order, uint8_t count){
+				bool empty = true;
+				bool telemetrySent = false;
+
+				for(uint8_t i = 0; i != count; i++){
+					const char* text;
+					uint16_t len;
+					if(order[i] == TELEMETRY_ENTRY){
+						if(dest->telemetry == NULL){ continue; }
+						text = dest->telemetry;
+						len = dest->telemetryLen;
+						telemetrySent = true;
+					}
+					else{
+						text = this->text + slots[order[i]].start;
+						len = slots[order[i]].len;
+					}
+
+					if(empty){
+						conn->beginPacket(dest->ip, dest->port);
+						empty = false;
+					}
+					conn->write(text, len);
+					if(text[len - 1] != '\n'){ conn->write('\n'); }
+				}
+				if(empty){ return; }
+
+				conn->endPacket();
+				if(telemetrySent){
+					dest->telemetry = NULL;
+					dest->telemetryLen = 0;
+				}
+				dest->tokens -= 1000;
+				dest->datagramsSent++;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		findLowestSlot															|
+		|	Purpose: 	Returns the least important event (lowest priority, then oldest).		|
+		|	Arguments:	void																	|
+		|	Returns:	int8_t (-1 if none are queued)											|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_Outbox::findLowestSlot(){
+				int8_t lowest = -1;
+				for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){
+					if(!slots[i].used){ continue; }
+					if(lowest == -1 || slots[i].priority < slots[lowest].priority ||
+						(slots[i].priority == slots[lowest].priority && (int16_t)(slots[i].seq - slots[lowest].seq) < 0)){
+						lowest = i;
+					}
+				}
+				return lowest;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		freeSlot																|
+		|	Purpose: 	Frees an event and closes the gap its text leaves, so the free text is	|
+		|				always at the end.														|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Outbox::freeSlot(uint8_t index){
+				uint16_t start = slots[index].start;
+				uint8_t len = slots[index].len;
+				memmove(text + start, text + start + len, textUsed - start - len);
+				textUsed -= len;
+				for(uint8_t i = 0; i != OUTBOX_SLOTS; i++){
+					if(slots[i].used && slots[i].start > start){ slots[i].start -= len; }
+				}
+				slots[index].used = false;
+			}
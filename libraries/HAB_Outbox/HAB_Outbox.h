@@ -0,0 +1,160 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to queue outgoing messages and send them in batches,
+*				by priority and within a rate limit for each destination.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Outbox_h
+#define HAB_Outbox_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Message priorities, higher is sent first
+	enum MessagePriority : uint8_t {
+		MSG_INFO = 0,
+		MSG_TELEMETRY = 1,
+		MSG_ACK = 2,
+		MSG_ALARM = 3
+	};
+	#define MSG_PRIORITY_COUNT 4
+
+
+class HAB_Outbox {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef OUTBOX_SLOTS
+			#define OUTBOX_SLOTS 8
+		#endif
+		#ifndef OUTBOX_TEXT_SIZE
+			#define OUTBOX_TEXT_SIZE 512 //Every queued event's text together, each takes only its own length
+		#endif
+		#ifndef OUTBOX_EVENT_SIZE
+			#define OUTBOX_EVENT_SIZE 160 //Longest event with its tag and timestamp, longer ones are cut
+		#endif
+		#ifndef OUTBOX_MAX_DESTINATIONS
+			#define OUTBOX_MAX_DESTINATIONS 6
+		#endif
+		#ifndef OUTBOX_PACKET_MAX_SIZE
+			#define OUTBOX_PACKET_MAX_SIZE 300 //Same as UDP_TX_PACKET_MAX_SIZE in the definitions
+		#endif
+		#ifndef OUTBOX_RATE
+			#define OUTBOX_RATE 12 //Datagrams per second to each destination, telemetry can go up to 10 Hz
+		#endif
+		#ifndef OUTBOX_BURST
+			#define OUTBOX_BURST 4 //Most datagrams sent in a row after being idle
+		#endif
+
+		struct outboxSlot {
+			MessagePriority priority;
+			bool used;
+			uint16_t start; //Where its text is in the text buffer
+			uint8_t len;
+			uint8_t msgOffset; //Start of the message, after the [EVENT] tag and timestamp
+			uint16_t seq;
+		};
+
+		struct outboxDestination {
+			bool active;
+			IPAddress ip;
+			uint16_t port;
+			bool events;
+			uint16_t tokens; //Thousandths of a datagram
+			unsigned long lastRefill;
+			const char* telemetry;
+			uint16_t telemetryLen;
+			uint32_t datagramsSent;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//UDP connection
+		EthernetUDP* conn;
+
+		//Queued events, their text packed together in the order they were queued
+		outboxSlot slots[OUTBOX_SLOTS];
+		char text[OUTBOX_TEXT_SIZE];
+		uint16_t textUsed = 0;
+		uint16_t nextSeq = 0;
+
+		//Destinations
+		outboxDestination dests[OUTBOX_MAX_DESTINATIONS];
+		uint8_t destCount = 0;
+
+		//Counters
+		uint16_t droppedCount[MSG_PRIORITY_COUNT];
+		uint16_t coalescedCount = 0;
+		uint16_t supersededCount = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Outbox(EthernetUDP* conn);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getQueuedCount();
+			uint16_t getDroppedCount(MessagePriority priority);
+			uint16_t getCoalescedCount();
+			uint16_t getSupersededCount();
+			uint32_t getDatagramsSent(uint8_t dest);
+			bool hasTelemetry(uint8_t dest);
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			int8_t addDestination(IPAddress ip, uint16_t port, bool events);
+			void removeDestination(uint8_t dest);
+			void setTelemetry(uint8_t dest, const char* telemetry);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool queue(const char* msg, MessagePriority priority);
+			void flush();
+			void flushAll();
+
+		private:
+			bool refill(outboxDestination* dest);
+			uint8_t select(uint8_t* order, uint16_t telemetryLen);
+			void send(outboxDestination* dest, const uint8_t* order, uint8_t count);
+			int8_t findLowestSlot();
+			void freeSlot(uint8_t index);
+};
+
+#endif
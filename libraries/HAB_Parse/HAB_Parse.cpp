@@ -0,0 +1,177 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to parse packets in place, without copying them.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Parse.h"
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		begin																	|
+	|	Purpose: 	Returns a cursor over the first len bytes of a packet.					|
+	|	Arguments:	char*, uint16_t															|
+	|	Returns:	HAB_Cursor																|
+	\*-------------------------------------------------------------------------------------*/
+		HAB_Cursor HAB_Parse::begin(char* packet, uint16_t len){
+			HAB_Cursor cursor = { packet, packet + len };
+			return cursor;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		next																	|
+	|	Purpose: 	Gets the next token and null terminates it in place. Like strtok,		|
+	|				empty fields are skipped, and a null character ends the packet.			|
+	|	Arguments:	HAB_Cursor, char, HAB_Token												|
+	|	Returns:	bool (false if there are no tokens left)								|
+	\*-------------------------------------------------------------------------------------*/
+		bool HAB_Parse::next(HAB_Cursor& cursor, char delimiter, HAB_Token& token){
+			char* pos = cursor.pos;
+
+			//Skips leading delimiters
+			while(pos < cursor.end && *pos == delimiter){ pos++; }
+			if(pos >= cursor.end || *pos == '\0'){
+				cursor.pos = cursor.end;
+				token.ptr = cursor.end;
+				token.len = 0;
+				return false;
+			}
+
+			//Finds the end of the token
+			token.ptr = pos;
+			while(pos < cursor.end && *pos != delimiter && *pos != '\0'){ pos++; }
+			token.len = pos - token.ptr;
+
+			//Terminates it and moves past the delimiter (a null ends the packet)
+			if(pos < cursor.end){
+				cursor.end = (*pos == '\0' ? pos : cursor.end);
+				*pos = '\0';
+				pos++;
+			}
+			cursor.pos = (pos > cursor.end ? cursor.end : pos);
+			return true;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		skip																	|
+	|	Purpose: 	Skips over a number of tokens.											|
+	|	Arguments:	HAB_Cursor, char, uint8_t												|
+	|	Returns:	bool (false if the packet ran out first)								|
+	\*-------------------------------------------------------------------------------------*/
+		bool HAB_Parse::skip(HAB_Cursor& cursor, char delimiter, uint8_t count){
+			HAB_Token token;
+			while(count--){
+				if(!next(cursor, delimiter, token)){ return false; }
+			}
+			return true;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		split																	|
+	|	Purpose: 	Splits a null terminated string in place. Missing arguments are set to	|
+	|				an empty string so they can always be compared.							|
+	|	Arguments:	char*, char, char**, uint8_t											|
+	|	Returns:	uint8_t (number of arguments found)										|
+	\*-------------------------------------------------------------------------------------*/
+		uint8_t HAB_Parse::split(char* text, char delimiter, char** args, uint8_t maxArgs){
+			HAB_Cursor cursor = begin(text, strlen(text));
+			HAB_Token token;
+			uint8_t count = 0;
+
+			while(count < maxArgs && next(cursor, delimiter, token)){
+				args[count++] = token.ptr;
+			}
+			for(uint8_t i = count; i < maxArgs; i++){
+				args[i] = (char*)"";
+			}
+			return count;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		equals																	|
+	|	Purpose: 	Returns true if the token matches the text exactly.						|
+	|	Arguments:	HAB_Token, char*														|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		bool HAB_Parse::equals(const HAB_Token& token, const char* text){
+			return (strncmp(token.ptr, text, token.len) == 0 && text[token.len] == '\0');
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		toUpper																	|
+	|	Purpose: 	Converts the token to upper case in place. Stops at (and cuts the		|
+	|				token at) any non-printable character.									|
+	|	Arguments:	HAB_Token																|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		void HAB_Parse::toUpper(HAB_Token& token){
+			for(uint16_t i = 0; i != token.len; i++){
+				char c = token.ptr[i];
+				if(c < ' ' || c > '~'){
+					token.ptr[i] = '\0';
+					token.len = i;
+					return;
+				}
+				if(c >= 'a' && c <= 'z'){ token.ptr[i] = c - ('a' - 'A'); }
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		parseFixed																|
+	|	Purpose: 	Parses a decimal number as an integer scaled by 10^decimals, e.g.		|
+	|				"43.0123456" with 6 decimals is 43012345. Extra digits are dropped.		|
+	|				Much cheaper than atof on the AVR, which has no FPU.					|
+	|	Arguments:	HAB_Token, uint8_t, int32_t												|
+	|	Returns:	bool (false if not a number or out of range)							|
+	\*-------------------------------------------------------------------------------------*/
+		bool HAB_Parse::parseFixed(const HAB_Token& token, uint8_t decimals, int32_t& value){
+			const char* pos = token.ptr;
+			const char* end = token.ptr + token.len;
+			bool negative = false;
+			bool fraction = false;
+			bool digits = false;
+			uint32_t result = 0;
+
+			//Sign
+			if(pos < end && (*pos == '-' || *pos == '+')){
+				negative = (*pos == '-');
+				pos++;
+			}
+
+			for(; pos < end; pos++){
+				if(*pos == '.' && !fraction){
+					fraction = true;
+					continue;
+				}
+				if(*pos < '0' || *pos > '9'){ return false; }
+
+				//Digits past the precision are dropped
+				if(fraction){
+					if(decimals == 0){ continue; }
+					decimals--;
+				}
+				if(result > 214748363UL){ return false; }
+				result = result * 10 + (*pos - '0');
+				digits = true;
+			}
+			if(!digits){ return false; }
+
+			//Pads the missing decimals
+			while(decimals--){
+				if(result > 214748363UL){ return false; }
+				result *= 10;
+			}
+
+			value = (negative ? -(int32_t)result : (int32_t)result);
+			return true;
+		}
@@ -0,0 +1,56 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to parse packets in place, without copying them.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Parse_h
+#define HAB_Parse_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//A view of part of a packet. The text is also null terminated in place.
+	struct HAB_Token {
+		char* ptr;
+		uint16_t len;
+	};
+
+	//Position in a packet, never read past end
+	struct HAB_Cursor {
+		char* pos;
+		char* end;
+	};
+
+
+class HAB_Parse {
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		static HAB_Cursor begin(char* packet, uint16_t len);
+		static bool next(HAB_Cursor& cursor, char delimiter, HAB_Token& token);
+		static bool skip(HAB_Cursor& cursor, char delimiter, uint8_t count);
+		static uint8_t split(char* text, char delimiter, char** args, uint8_t maxArgs);
+		static bool equals(const HAB_Token& token, const char* text);
+		static void toUpper(HAB_Token& token);
+		static bool parseFixed(const HAB_Token& token, uint8_t decimals, int32_t& value);
+};
+
+#endif
@@ -0,0 +1,251 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to follow the mission phase, from on the pad to landed, from the
+*				altitude and climb rate. Each phase has its own sensor, logging, telemetry and camera
+*				rates, so the loop only does the work that matters at the time.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Phase.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	struct phaseRates {
+		uint16_t sampleInterval;	//Sensors and statistics
+		uint16_t readingsInterval;	//Datalog and history
+		uint16_t telemetryInterval;	//Fastest the groundstations are sent to, the link can slow it further
+		uint32_t timelapseInterval;	//Camera time-lapse
+		uint32_t beaconInterval;	//Recovery beacon
+	};
+
+	//In phase order. On the pad the ground crew still needs quick telemetry, landed only the beacon matters.
+	static const phaseRates rates[PHASE_COUNT] PROGMEM = {
+		{  1000,  5000,  1000,      0,     0 },	//PRELAUNCH
+		{   100,  1000,   100, 120000,     0 },	//ASCENT
+		{   100,  1000,   100,  60000,     0 },	//SAMPLING
+		{   500,  2000,  1000, 300000,     0 },	//FLOAT
+		{   200,  1000,   500, 120000,     0 },	//DESCENT
+		{ 10000, 60000, 30000,      0, 30000 }	//LANDED
+	};
+
+	//Time each phase's condition has to hold before it is entered (ms)
+	static const uint32_t confirmTimes[PHASE_COUNT] PROGMEM = {
+		0, PHASE_ASCENT_TIME, 0, PHASE_FLOAT_TIME, PHASE_DESCENT_TIME, PHASE_LANDED_TIME
+	};
+
+	static const char* const phaseNames[PHASE_COUNT] = { "PRELAUNCH", "ASCENT", "SAMPLING", "FLOAT", "DESCENT", "LANDED" };
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Phase::HAB_Phase(Centimetres landedCeiling){
+		this->landedCeiling = landedCeiling;
+		phaseStart = millis();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPhase																|
+		|	Purpose: 	Returns the current mission phase.										|
+		|	Arguments:	void																	|
+		|	Returns:	MissionPhase															|
+		\*-------------------------------------------------------------------------------------*/
+			MissionPhase HAB_Phase::getPhase(){
+				return phase;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPreviousPhase														|
+		|	Purpose: 	Returns the phase before the current one.								|
+		|	Arguments:	void																	|
+		|	Returns:	MissionPhase															|
+		\*-------------------------------------------------------------------------------------*/
+			MissionPhase HAB_Phase::getPreviousPhase(){
+				return previousPhase;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPhaseTime															|
+		|	Purpose: 	Returns how long the current phase has lasted (ms).						|
+		|	Arguments:	void																	|
+		|	Returns:	unsigned long															|
+		\*-------------------------------------------------------------------------------------*/
+			unsigned long HAB_Phase::getPhaseTime(){
+				return millis() - phaseStart;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPadAltitude															|
+		|	Purpose: 	Returns the pad altitude, followed until launch.						|
+		|	Arguments:	void																	|
+		|	Returns:	Centimetres																|
+		\*-------------------------------------------------------------------------------------*/
+			Centimetres HAB_Phase::getPadAltitude(){
+				return padAltitude;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getName																	|
+		|	Purpose: 	Returns the name of a phase, e.g. "ASCENT".								|
+		|	Arguments:	MissionPhase															|
+		|	Returns:	const char*																|
+		\*-------------------------------------------------------------------------------------*/
+			const char* HAB_Phase::getName(MissionPhase phase){
+				return (phase < PHASE_COUNT ? phaseNames[phase] : "?");
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSampleInterval														|
+		|	Purpose: 	Returns how often the sensors are sampled in this phase (ms).			|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Phase::getSampleInterval(){
+				return pgm_read_word(&rates[phase].sampleInterval);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getReadingsInterval														|
+		|	Purpose: 	Returns how often the readings are logged in this phase (ms).			|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Phase::getReadingsInterval(){
+				return pgm_read_word(&rates[phase].readingsInterval);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTelemetryInterval													|
+		|	Purpose: 	Returns the fastest telemetry to the groundstations in this phase (ms).	|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Phase::getTelemetryInterval(){
+				return pgm_read_word(&rates[phase].telemetryInterval);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimelapseInterval													|
+		|	Purpose: 	Returns the camera's time-lapse interval in this phase (ms, 0 is off).	|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Phase::getTimelapseInterval(){
+				return pgm_read_dword(&rates[phase].timelapseInterval);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getBeaconInterval														|
+		|	Purpose: 	Returns how often the recovery beacon is sent in this phase (ms, 0 is	|
+		|				off).																	|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Phase::getBeaconInterval(){
+				return pgm_read_dword(&rates[phase].beaconInterval);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Moves to the next phase once its condition has held for its confirm		|
+		|				time. Called with each new climb rate. Returns true on a change.		|
+		|	Arguments:	Centimetres, CentimetresPerSecond, bool (a pod is sampling)				|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Phase::update(Centimetres altitude, CentimetresPerSecond climbRate, bool sampling){
+				//Follows the pad altitude while sitting still on it
+				if(phase == PHASE_PRELAUNCH && climbRate.value() < PHASE_ASCENT_CLIMB && climbRate.value() > -PHASE_ASCENT_CLIMB){
+					padAltitude = altitude;
+				}
+
+				MissionPhase next = getNextPhase(altitude, climbRate, sampling);
+				if(next == phase){
+					candidate = phase;
+					return false;
+				}
+
+				unsigned long now = millis();
+				if(next != candidate){
+					candidate = next;
+					candidateSince = now;
+				}
+				if((now - candidateSince) < pgm_read_dword(&confirmTimes[next])){ return false; }
+				return set(next);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		set																		|
+		|	Purpose: 	Changes the phase straight away, e.g. by command. Returns true if it	|
+		|				was not already in it.													|
+		|	Arguments:	MissionPhase															|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Phase::set(MissionPhase phase){
+				if(phase == this->phase || phase >= PHASE_COUNT){ return false; }
+				HAB_Logging::printLog("Mission phase ");
+				HAB_Logging::printLog(getName(this->phase), "");
+				HAB_Logging::printLog(" to ", "");
+				HAB_Logging::printLogln(getName(phase), "");
+
+				previousPhase = this->phase;
+				this->phase = phase;
+				candidate = phase;
+				phaseStart = millis();
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getNextPhase															|
+		|	Purpose: 	Returns the phase the readings point to. Descent can follow any phase	|
+		|				in the air, and landed only descent. Landed is only left by command.	|
+		|	Arguments:	Centimetres, CentimetresPerSecond, bool									|
+		|	Returns:	MissionPhase															|
+		\*-------------------------------------------------------------------------------------*/
+			MissionPhase HAB_Phase::getNextPhase(Centimetres altitude, CentimetresPerSecond climbRate, bool sampling){
+				int32_t climb = climbRate.value();
+				bool still = (climb < PHASE_FLOAT_CLIMB && climb > -PHASE_FLOAT_CLIMB);
+				switch(phase){
+					case PHASE_PRELAUNCH:
+						if(climb > PHASE_ASCENT_CLIMB && altitude > padAltitude + fromMetres(PHASE_LAUNCH_HEIGHT)){ return PHASE_ASCENT; }
+						return PHASE_PRELAUNCH;
+					case PHASE_ASCENT:
+					case PHASE_SAMPLING:
+					case PHASE_FLOAT:
+						if(climb < PHASE_DESCENT_CLIMB){ return PHASE_DESCENT; }
+						if(sampling){ return PHASE_SAMPLING; }
+						if(phase == PHASE_SAMPLING){ return PHASE_ASCENT; }
+						if(still){ return PHASE_FLOAT; }
+						if(climb > PHASE_ASCENT_CLIMB){ return PHASE_ASCENT; }
+						return phase;
+					case PHASE_DESCENT:
+						if(still && altitude < landedCeiling){ return PHASE_LANDED; }
+						return PHASE_DESCENT;
+					default:
+						return phase;
+				}
+			}
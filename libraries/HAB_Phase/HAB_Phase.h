@@ -0,0 +1,134 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to follow the mission phase, from on the pad to landed, from the
+*				altitude and climb rate. Each phase has its own sensor, logging, telemetry and camera
+*				rates, so the loop only does the work that matters at the time.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Phase_h
+#define HAB_Phase_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <HAB_Fixed.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	enum MissionPhase : uint8_t {
+		PHASE_PRELAUNCH = 0,	//On the pad
+		PHASE_ASCENT = 1,		//Climbing between the pods' intervals
+		PHASE_SAMPLING = 2,		//Climbing within a pod's interval, or a science burst running
+		PHASE_FLOAT = 3,		//Neither climbing nor descending
+		PHASE_DESCENT = 4,		//Burst or cut down
+		PHASE_LANDED = 5		//Still on the ground, only the recovery beacon
+	};
+	#define PHASE_COUNT 6
+
+
+class HAB_Phase {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		//Climb rates (cm/s) that decide the phase
+		#ifndef PHASE_ASCENT_CLIMB
+			#define PHASE_ASCENT_CLIMB 100 //Faster than this is climbing
+		#endif
+		#ifndef PHASE_FLOAT_CLIMB
+			#define PHASE_FLOAT_CLIMB 50 //Slower than this either way is floating, or landed
+		#endif
+		#ifndef PHASE_DESCENT_CLIMB
+			#define PHASE_DESCENT_CLIMB -200 //Slower than this (negative) is descending
+		#endif
+		#ifndef PHASE_LAUNCH_HEIGHT
+			#define PHASE_LAUNCH_HEIGHT 50 //m above the pad that counts as launched
+		#endif
+
+		//Time (ms) each phase's condition has to hold before it is entered, so a gust is not a launch
+		#ifndef PHASE_ASCENT_TIME
+			#define PHASE_ASCENT_TIME 10000
+		#endif
+		#ifndef PHASE_FLOAT_TIME
+			#define PHASE_FLOAT_TIME 300000
+		#endif
+		#ifndef PHASE_DESCENT_TIME
+			#define PHASE_DESCENT_TIME 30000
+		#endif
+		#ifndef PHASE_LANDED_TIME
+			#define PHASE_LANDED_TIME 120000
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		MissionPhase phase = PHASE_PRELAUNCH;
+		MissionPhase previousPhase = PHASE_PRELAUNCH;
+		unsigned long phaseStart = 0;
+
+		//Phase whose condition is holding, and since when
+		MissionPhase candidate = PHASE_PRELAUNCH;
+		unsigned long candidateSince = 0;
+
+		//Pad altitude, followed until launch, and the altitude below which it can have landed
+		Centimetres padAltitude;
+		Centimetres landedCeiling;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Phase(Centimetres landedCeiling);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			MissionPhase getPhase();
+			MissionPhase getPreviousPhase();
+			unsigned long getPhaseTime();
+			Centimetres getPadAltitude();
+			static const char* getName(MissionPhase phase);
+
+			//Rates of the current phase (ms, 0 is off)
+			uint16_t getSampleInterval();
+			uint16_t getReadingsInterval();
+			uint16_t getTelemetryInterval();
+			uint32_t getTimelapseInterval();
+			uint32_t getBeaconInterval();
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool update(Centimetres altitude, CentimetresPerSecond climbRate, bool sampling);
+			bool set(MissionPhase phase);
+
+		private:
+			MissionPhase getNextPhase(Centimetres altitude, CentimetresPerSecond climbRate, bool sampling);
+};
+
+#endif
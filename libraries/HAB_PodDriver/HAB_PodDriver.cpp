@@ -0,0 +1,71 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to switch a pod's heater and actuator driver pins. The template
+*				version takes the pins at compile time and writes the Mega's ports directly, so the
+*				enable, push and pull lines change together in a single write.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_PodDriver.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_PodDriver::HAB_PodDriver(uint8_t heat_en, uint8_t act_en, uint8_t act_push, uint8_t act_pull){
+		this->heat_en = heat_en;
+		this->act_en = act_en;
+		this->act_push = act_push;
+		this->act_pull = act_pull;
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		begin																	|
+	|	Purpose: 	Sets the pins as outputs.												|
+	|	Arguments:	void																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		void HAB_PodDriver::begin(){
+			pinMode(heat_en,       OUTPUT);
+			pinMode(act_en,        OUTPUT);
+			pinMode(act_push,      OUTPUT);
+			pinMode(act_pull,      OUTPUT);
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		drive																	|
+	|	Purpose: 	Sets the actuator enable, push and pull lines. Enable is written		|
+	|				last when turning on and first when turning off.						|
+	|	Arguments:	bool, bool, bool														|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		void HAB_PodDriver::drive(bool enable, bool push, bool pull){
+			if(!enable){ digitalWrite(act_en, LOW); }
+			digitalWrite(act_push, (push ? HIGH : LOW));
+			digitalWrite(act_pull, (pull ? HIGH : LOW));
+			if(enable){ digitalWrite(act_en, HIGH); }
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		setHeating																|
+	|	Purpose: 	Turns the heater on or off.												|
+	|	Arguments:	bool																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		void HAB_PodDriver::setHeating(bool enable){
+			digitalWrite(heat_en, (enable ? HIGH : LOW));
+		}
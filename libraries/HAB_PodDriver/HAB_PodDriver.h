@@ -0,0 +1,136 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to switch a pod's heater and actuator driver pins. The template
+*				version takes the pins at compile time and writes the Mega's ports directly, so the
+*				enable, push and pull lines change together in a single write.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_PodDriver_h
+#define HAB_PodDriver_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Mega digital pins 22 to 29 are PA0 to PA7, 30 to 37 are PC7 down to PC0
+	constexpr bool podPinOnPortA(uint8_t pin){ return pin >= 22 && pin <= 29; }
+	constexpr bool podPinOnPortC(uint8_t pin){ return pin >= 30 && pin <= 37; }
+	constexpr uint8_t podPinMask(uint8_t pin){ return (uint8_t)(1 << (pin <= 29 ? pin - 22 : 37 - pin)); }
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		HAB_PodDriver															|
+	|	Purpose: 	Switches the pins with digitalWrite, for pins only known at run time.	|
+	|				HAB_PodPins overrides it with port writes.								|
+	\*-------------------------------------------------------------------------------------*/
+	class HAB_PodDriver {
+
+		//--------------------------------------------------------------------------\
+		//								   Variables					   			|
+		//--------------------------------------------------------------------------/
+			private:
+
+			uint8_t heat_en, act_en, act_push, act_pull;
+
+
+		//--------------------------------------------------------------------------\
+		//								  Constructor					   			|
+		//--------------------------------------------------------------------------/
+			public:
+
+			HAB_PodDriver(uint8_t heat_en, uint8_t act_en, uint8_t act_push, uint8_t act_pull);
+
+
+		//--------------------------------------------------------------------------\
+		//								   Functions					   			|
+		//--------------------------------------------------------------------------/
+			virtual void begin();
+			virtual void drive(bool enable, bool push, bool pull);
+			virtual void setHeating(bool enable);
+	};
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		HAB_PodPins																|
+	|	Purpose: 	The same, with the pins fixed at compile time. All four must be on the	|
+	|				same port (pins 22-29 or 30-37), which the HAB_Definitions pods are.	|
+	|				Heating is a single sbi/cbi, and the actuator lines are one masked		|
+	|				write with interrupts held off, so push and pull never overlap.			|
+	\*-------------------------------------------------------------------------------------*/
+	template <uint8_t HEAT_EN, uint8_t ACT_EN, uint8_t ACT_PUSH, uint8_t ACT_PULL>
+	class HAB_PodPins : public HAB_PodDriver {
+
+		//--------------------------------------------------------------------------\
+		//								  Definitions					   			|
+		//--------------------------------------------------------------------------/
+			private:
+
+			static constexpr bool onPortA = podPinOnPortA(HEAT_EN);
+			static_assert((podPinOnPortA(HEAT_EN) && podPinOnPortA(ACT_EN) && podPinOnPortA(ACT_PUSH) && podPinOnPortA(ACT_PULL))
+				|| (podPinOnPortC(HEAT_EN) && podPinOnPortC(ACT_EN) && podPinOnPortC(ACT_PUSH) && podPinOnPortC(ACT_PULL)),
+				"A pod's pins must all be on pins 22-29 (PORTA) or all on 30-37 (PORTC)");
+
+			static constexpr uint8_t heatMask = podPinMask(HEAT_EN);
+			static constexpr uint8_t enableMask = podPinMask(ACT_EN);
+			static constexpr uint8_t pushMask = podPinMask(ACT_PUSH);
+			static constexpr uint8_t pullMask = podPinMask(ACT_PULL);
+			static constexpr uint8_t driveMask = enableMask | pushMask | pullMask;
+
+			static inline volatile uint8_t& port(){ return (onPortA ? PORTA : PORTC); }
+			static inline volatile uint8_t& ddr(){ return (onPortA ? DDRA : DDRC); }
+
+
+		//--------------------------------------------------------------------------\
+		//								  Constructor					   			|
+		//--------------------------------------------------------------------------/
+			public:
+
+			HAB_PodPins() : HAB_PodDriver(HEAT_EN, ACT_EN, ACT_PUSH, ACT_PULL) {}
+
+
+		//--------------------------------------------------------------------------\
+		//								   Functions					   			|
+		//--------------------------------------------------------------------------/
+
+			//Outputs, starting low
+			void begin(){
+				uint8_t oldSREG = SREG;
+				cli();
+				port() &= ~(driveMask | heatMask);
+				ddr() |= (driveMask | heatMask);
+				SREG = oldSREG;
+			}
+
+			void drive(bool enable, bool push, bool pull){
+				uint8_t bits = (enable ? enableMask : 0) | (push ? pushMask : 0) | (pull ? pullMask : 0);
+				uint8_t oldSREG = SREG;
+				cli();
+				port() = (port() & ~driveMask) | bits;
+				SREG = oldSREG;
+			}
+
+			void setHeating(bool enable){
+				if(enable){ port() |= heatMask; }
+				else{ port() &= ~heatMask; }
+			}
+	};
+
+#endif
@@ -0,0 +1,345 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to share the flight battery between the heaters, actuators and
+*				camera. Each load asks before switching on, and is granted, deferred or given its
+*				turn against a current budget that is lowered as the battery runs down.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Power.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	struct powerLoad {
+		PowerLoadType type;
+		const char* owner;
+		bool granted;
+		bool waiting;
+		bool revoked; //Asked to switch off for a higher priority load
+		unsigned long grantedAt;
+		unsigned long waitingSince;
+		unsigned long lastRequest;
+		uint32_t deferredTime; //ms, of finished waits
+	};
+
+	//Loads are registered by their owners' constructors, so these are set before any of them run
+	static powerLoad loads[POWER_MAX_LOADS];
+	static uint8_t loadCount = 0;
+	static uint16_t powerBudget = POWER_BUDGET;
+
+	//Charge drawn since startup, from the estimated currents
+	static uint32_t chargeUsed = 0; //mAs
+	static uint16_t chargeRemainder = 0; //mAms, below a mAs
+	static unsigned long lastUpdate = 0;
+
+	static const uint16_t loadCurrents[] = { POWER_HEATER_CURRENT, POWER_CAMERA_CURRENT, POWER_ACTUATOR_CURRENT };
+	static const uint32_t batteryCharge = POWER_BATTERY_CAPACITY * 3600UL; //mAs
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getBudget																|
+		|	Purpose: 	Returns the current the loads may draw at full charge (mA).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getBudget(){
+				return powerBudget;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getAvailableBudget														|
+		|	Purpose: 	Returns the budget for the battery's charge, halved once it is low.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getAvailableBudget(){
+				return (getStateOfCharge() < POWER_LOW_SOC ? powerBudget / 2 : powerBudget);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCurrent																|
+		|	Purpose: 	Returns the estimated draw of the base and every granted load (mA).	|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getCurrent(){
+				uint16_t current = POWER_BASE_CURRENT;
+				for(uint8_t i = 0; i != loadCount; i++){
+					if(loads[i].granted){ current += loadCurrents[loads[i].type]; }
+				}
+				return current;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStateOfCharge														|
+		|	Purpose: 	Returns the estimated charge left in the battery (percent).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Power::getStateOfCharge(){
+				if(chargeUsed >= batteryCharge){ return 0; }
+				return 100 - chargeUsed / (batteryCharge / 100);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDeferredTime															|
+		|	Purpose: 	Returns the time all loads have spent waiting for power (ms).			|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Power::getDeferredTime(){
+				uint32_t total = 0;
+				for(uint8_t i = 0; i != loadCount; i++){
+					total += getLoadDeferredTime(i);
+				}
+				return total;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getGrantedMask															|
+		|	Purpose: 	Returns the loads that are on, bit n for load n.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getGrantedMask(){
+				uint16_t mask = 0;
+				for(uint8_t i = 0; i != loadCount; i++){
+					if(loads[i].granted){ mask |= (1 << i); }
+				}
+				return mask;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getWaitingMask															|
+		|	Purpose: 	Returns the loads that are deferred, bit n for load n.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getWaitingMask(){
+				uint16_t mask = 0;
+				for(uint8_t i = 0; i != loadCount; i++){
+					if(loads[i].waiting){ mask |= (1 << i); }
+				}
+				return mask;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoadCount															|
+		|	Purpose: 	Returns the number of registered loads.									|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Power::getLoadCount(){
+				return loadCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoadType																|
+		|	Purpose: 	Returns what kind of load it is.										|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	PowerLoadType															|
+		\*-------------------------------------------------------------------------------------*/
+			PowerLoadType HAB_Power::getLoadType(uint8_t id){
+				return loads[id].type;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoadOwner															|
+		|	Purpose: 	Returns the name of what the load belongs to, e.g. its pod.				|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	const char*																|
+		\*-------------------------------------------------------------------------------------*/
+			const char* HAB_Power::getLoadOwner(uint8_t id){
+				return loads[id].owner;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoadCurrent															|
+		|	Purpose: 	Returns the estimated draw of the load when on (mA).					|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Power::getLoadCurrent(uint8_t id){
+				return loadCurrents[loads[id].type];
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getLoadDeferredTime														|
+		|	Purpose: 	Returns the time the load has spent waiting for power, including		|
+		|				its current wait (ms).													|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Power::getLoadDeferredTime(uint8_t id){
+				powerLoad* load = loads + id;
+				return load->deferredTime + (load->waiting ? millis() - load->waitingSince : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isGranted																|
+		|	Purpose: 	Returns true while the load may stay on. A heater has to switch off		|
+		|				(and release) when a higher priority load needs its share, or once it	|
+		|				has had POWER_SLICE while another load waits.							|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Power::isGranted(uint8_t id){
+				if(id >= loadCount){ return true; }
+				powerLoad* load = loads + id;
+				if(!load->granted || load->revoked){ return false; }
+				if(load->type != POWER_HEATER || (millis() - load->grantedAt) < POWER_SLICE){ return true; }
+				return getWaitingMask() == 0;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setBudget																|
+		|	Purpose: 	Sets the current the loads may draw at full charge (mA). Loads already	|
+		|				on are left on.															|
+		|	Arguments:	uint16_t																|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Power::setBudget(uint16_t budget){
+				powerBudget = budget;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setStateOfCharge														|
+		|	Purpose: 	Sets the battery's charge, e.g. after swapping it before launch.		|
+		|	Arguments:	uint8_t (percent)														|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Power::setStateOfCharge(uint8_t percent){
+				chargeUsed = (uint32_t)(100 - min(percent, (uint8_t)100)) * (batteryCharge / 100);
+				chargeRemainder = 0;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addLoad																	|
+		|	Purpose: 	Registers a load, returning the id it asks with. POWER_NO_LOAD if		|
+		|				there is no room, it is then always granted.							|
+		|	Arguments:	PowerLoadType, const char*												|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Power::addLoad(PowerLoadType type, const char* owner){
+				if(loadCount == POWER_MAX_LOADS){ return POWER_NO_LOAD; }
+				powerLoad* load = loads + loadCount;
+				memset(load, 0, sizeof(powerLoad));
+				load->type = type;
+				load->owner = owner;
+				return loadCount++;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		acquire																	|
+		|	Purpose: 	Asks to switch a load on. It is granted if it fits in the budget and	|
+		|				no load of the same or a higher priority has waited longer. Otherwise	|
+		|				it is deferred, and heaters in the way of a higher priority load are	|
+		|				asked to switch off. A deferred load keeps asking every loop; nothing	|
+		|				else on it is always granted, so one load larger than the budget		|
+		|				still runs alone.														|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool (true if granted)													|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Power::acquire(uint8_t id){
+				if(id >= loadCount){ return true; }
+				powerLoad* load = loads + id;
+				unsigned long now = millis();
+				load->lastRequest = now;
+				if(load->granted){ return true; }
+				if(!load->waiting){
+					load->waiting = true;
+					load->waitingSince = now;
+				}
+
+				//Waits its turn
+				for(uint8_t i = 0; i != loadCount; i++){
+					if(i == id || !loads[i].waiting){ continue; }
+					if(loads[i].type > load->type || (loads[i].type == load->type && (long)(loads[i].waitingSince - load->waitingSince) < 0)){
+						return false;
+					}
+				}
+
+				//Makes room by switching heaters off
+				uint16_t current = getCurrent();
+				if(current != POWER_BASE_CURRENT && current + loadCurrents[load->type] > getAvailableBudget()){
+					if(load->type > POWER_HEATER){
+						for(uint8_t i = 0; i != loadCount; i++){
+							if(loads[i].granted && loads[i].type == POWER_HEATER){ loads[i].revoked = true; }
+						}
+					}
+					return false;
+				}
+
+				load->granted = true;
+				load->revoked = false;
+				load->waiting = false;
+				load->grantedAt = now;
+				load->deferredTime += now - load->waitingSince;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		release																	|
+		|	Purpose: 	Switches a load off, or drops its request if it was waiting.			|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Power::release(uint8_t id){
+				if(id >= loadCount){ return; }
+				powerLoad* load = loads + id;
+				if(load->waiting){
+					load->deferredTime += millis() - load->waitingSince;
+					load->waiting = false;
+				}
+				load->granted = false;
+				load->revoked = false;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Counts the charge drawn since the last call, and drops requests that	|
+		|				are no longer being made. Called every loop.							|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Power::update(){
+				unsigned long now = millis();
+				uint32_t drawn = (uint32_t)getCurrent() * (now - lastUpdate) + chargeRemainder;
+				lastUpdate = now;
+				chargeUsed += drawn / 1000;
+				chargeRemainder = drawn % 1000;
+
+				for(uint8_t i = 0; i != loadCount; i++){
+					powerLoad* load = loads + i;
+					if(load->waiting && (now - load->lastRequest) > POWER_REQUEST_TIMEOUT){
+						load->deferredTime += load->lastRequest - load->waitingSince;
+						load->waiting = false;
+					}
+				}
+			}
@@ -0,0 +1,122 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to share the flight battery between the heaters, actuators and
+*				camera. Each load asks before switching on, and is granted, deferred or given its
+*				turn against a current budget that is lowered as the battery runs down.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Power_h
+#define HAB_Power_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Kinds of load, in increasing priority. Heaters can be switched off for a higher priority
+	//load, and take turns when they can't all be on, an actuator or capture is never cut short.
+	enum PowerLoadType : uint8_t {
+		POWER_HEATER = 0,
+		POWER_CAMERA = 1,
+		POWER_ACTUATOR = 2
+	};
+
+	//Returned when there is no room for another load, which is then never limited
+	#define POWER_NO_LOAD 0xFF
+
+
+class HAB_Power {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef POWER_MAX_LOADS
+			#define POWER_MAX_LOADS 10
+		#endif
+
+		//Estimated draw of each load from the battery (mA)
+		#ifndef POWER_BASE_CURRENT
+			#define POWER_BASE_CURRENT 250 //The Mega, Ethernet shield, GPS and BME, always on
+		#endif
+		#ifndef POWER_HEATER_CURRENT
+			#define POWER_HEATER_CURRENT 420 //5W at 12V
+		#endif
+		#ifndef POWER_CAMERA_CURRENT
+			#define POWER_CAMERA_CURRENT 180 //Capture and the SD card writes
+		#endif
+		#ifndef POWER_ACTUATOR_CURRENT
+			#define POWER_ACTUATOR_CURRENT 800 //Driving, not stalled
+		#endif
+
+		//Budget and battery
+		#ifndef POWER_BUDGET
+			#define POWER_BUDGET 2000 //mA the loads together may draw, all four heaters or an actuator with two
+		#endif
+		#ifndef POWER_BATTERY_CAPACITY
+			#define POWER_BATTERY_CAPACITY 6000 //mAh
+		#endif
+		#ifndef POWER_LOW_SOC
+			#define POWER_LOW_SOC 25 //%, below this the budget is halved
+		#endif
+
+		//Turns
+		#ifndef POWER_SLICE
+			#define POWER_SLICE 2000 //ms a heater keeps its turn while another load waits
+		#endif
+		#ifndef POWER_REQUEST_TIMEOUT
+			#define POWER_REQUEST_TIMEOUT 1000 //ms after which a request that is not repeated is dropped
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			static uint16_t getBudget();
+			static uint16_t getAvailableBudget();
+			static uint16_t getCurrent();
+			static uint8_t getStateOfCharge();
+			static uint32_t getDeferredTime();
+			static uint16_t getGrantedMask();
+			static uint16_t getWaitingMask();
+			static uint8_t getLoadCount();
+			static PowerLoadType getLoadType(uint8_t id);
+			static const char* getLoadOwner(uint8_t id);
+			static uint16_t getLoadCurrent(uint8_t id);
+			static uint32_t getLoadDeferredTime(uint8_t id);
+			static bool isGranted(uint8_t id);
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			static void setBudget(uint16_t budget);
+			static void setStateOfCharge(uint8_t percent);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			static uint8_t addLoad(PowerLoadType type, const char* owner);
+			static bool acquire(uint8_t id);
+			static void release(uint8_t id);
+			static void update();
+};
+
+#endif
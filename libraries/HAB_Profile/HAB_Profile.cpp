@@ -0,0 +1,246 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure what the flight code costs on the board itself.
+*				Each profiled section keeps its call count, mean and worst-case time (and so
+*				cycles), and the deepest stack it reached, for a bench build with PROFILING on.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Profile.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//End of the heap, from the AVR C library
+	extern char* __brkval;
+	extern char __heap_start;
+
+	struct profileSlot {
+		const char* name;
+		uint32_t count;
+		uint32_t totalTime; //us
+		uint32_t maxTime; //us
+		uint16_t maxStack; //Bytes below the stack pointer at begin
+	};
+
+	static profileSlot slots[PROFILE_MAX_SLOTS];
+	static uint8_t slotCount = 0;
+
+	//Section being measured, sections don't nest
+	static int8_t openSlot = -1;
+	static unsigned long openTime = 0;
+	static uint8_t* openStack = NULL;
+
+	//Least free memory seen between the heap and the stack
+	static uint16_t stackHeadroom = 0xFFFF;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSlotCount															|
+		|	Purpose: 	Returns the number of profiled sections.								|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Profile::getSlotCount(){
+				return slotCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCount																|
+		|	Purpose: 	Returns how many times a section has run since the last reset.			|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Profile::getCount(uint8_t slot){
+				return (slot < slotCount ? slots[slot].count : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMeanTime																|
+		|	Purpose: 	Returns a section's mean time (us).										|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Profile::getMeanTime(uint8_t slot){
+				if(slot >= slotCount || slots[slot].count == 0){ return 0; }
+				return slots[slot].totalTime / slots[slot].count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMaxTime																|
+		|	Purpose: 	Returns a section's worst-case time (us).								|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Profile::getMaxTime(uint8_t slot){
+				return (slot < slotCount ? slots[slot].maxTime : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMaxStack																|
+		|	Purpose: 	Returns the deepest a section took the stack, below where it was at		|
+		|				the start of the section (bytes).										|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Profile::getMaxStack(uint8_t slot){
+				return (slot < slotCount ? slots[slot].maxStack : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStackHeadroom														|
+		|	Purpose: 	Returns the least free memory seen between the heap and the stack at	|
+		|				the end of a section (bytes).											|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Profile::getStackHeadroom(){
+				return stackHeadroom;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getReport																|
+		|	Purpose: 	Writes a section's line of the report, to be compared between builds:	|
+		|				PROF,name,count,mean us,max us,max cycles,max stack bytes				|
+		|				e.g. PROF,TEMP,1200,212,236,3776,18. The time is to the 4us of			|
+		|				micros(). Returns NULL if there is no such section.						|
+		|	Arguments:	uint8_t, char* (at least 80)											|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Profile::getReport(uint8_t slot, char* buffer){
+				if(slot >= slotCount){ return NULL; }
+				char number[12];
+
+				strcpy(buffer, "PROF,");
+				strcat(buffer, slots[slot].name);
+				strcat(buffer, ",");
+				strcat(buffer, ultoa(slots[slot].count, number, 10));
+				strcat(buffer, ",");
+				strcat(buffer, ultoa(getMeanTime(slot), number, 10));
+				strcat(buffer, ",");
+				strcat(buffer, ultoa(slots[slot].maxTime, number, 10));
+				strcat(buffer, ",");
+				strcat(buffer, ultoa(slots[slot].maxTime * (F_CPU / 1000000UL), number, 10));
+				strcat(buffer, ",");
+				strcat(buffer, utoa(slots[slot].maxStack, number, 10));
+				return buffer;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHeapEnd																|
+		|	Purpose: 	Returns the first byte above the heap.									|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t*																|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t* HAB_Profile::getHeapEnd(){
+				return (uint8_t*)(__brkval != 0 ? __brkval : &__heap_start);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		findStackBottom															|
+		|	Purpose: 	Returns the lowest byte the stack has written since it was painted,		|
+		|				the first one up from the heap that is not the paint.					|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t*																|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t* HAB_Profile::findStackBottom(){
+				uint8_t* bottom = getHeapEnd();
+				uint8_t* top = (uint8_t*)(uintptr_t)SP;
+				while(bottom < top && *bottom == PROFILE_PAINT){ bottom++; }
+				return bottom;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setup																	|
+		|	Purpose: 	Names the sections, slot n is names[n]. Only the first					|
+		|				PROFILE_MAX_SLOTS are kept.												|
+		|	Arguments:	const char* const*, uint8_t												|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Profile::setup(const char* const* names, uint8_t count){
+				slotCount = min(count, (uint8_t)PROFILE_MAX_SLOTS);
+				for(uint8_t i = 0; i != slotCount; i++){
+					slots[i].name = names[i];
+				}
+				reset();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		begin																	|
+		|	Purpose: 	Starts measuring a section. The free memory below the stack is painted	|
+		|				first, so it is left out of the time. Ignored inside another section.	|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Profile::begin(uint8_t slot){
+				if(slot >= slotCount || openSlot >= 0){ return; }
+
+				openStack = (uint8_t*)(uintptr_t)SP;
+				uint8_t* heapEnd = getHeapEnd();
+				if(openStack - heapEnd > PROFILE_STACK_MARGIN){
+					memset(heapEnd, PROFILE_PAINT, openStack - heapEnd - PROFILE_STACK_MARGIN);
+				}
+				openSlot = slot;
+				openTime = micros();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		end																		|
+		|	Purpose: 	Stops measuring a section, adding its time and how deep it took the		|
+		|				stack.																	|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Profile::end(uint8_t slot){
+				uint32_t time = micros() - openTime;
+				if(slot != openSlot){ return; }
+				openSlot = -1;
+
+				uint8_t* bottom = findStackBottom();
+				profileSlot* entry = slots + slot;
+				entry->count++;
+				entry->totalTime += time;
+				entry->maxTime = max(entry->maxTime, time);
+				if(bottom < openStack){
+					entry->maxStack = max(entry->maxStack, (uint16_t)(openStack - bottom));
+				}
+				stackHeadroom = min(stackHeadroom, (uint16_t)(bottom - getHeapEnd()));
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		reset																	|
+		|	Purpose: 	Clears every section's measurements, e.g. between benchmark runs.		|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Profile::reset(){
+				for(uint8_t i = 0; i != slotCount; i++){
+					slots[i].count = 0;
+					slots[i].totalTime = 0;
+					slots[i].maxTime = 0;
+					slots[i].maxStack = 0;
+				}
+				openSlot = -1;
+				stackHeadroom = 0xFFFF;
+			}
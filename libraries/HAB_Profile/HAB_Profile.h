@@ -0,0 +1,103 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to measure what the flight code costs on the board itself.
+*				Each profiled section keeps its call count, mean and worst-case time (and so
+*				cycles), and the deepest stack it reached, for a bench build with PROFILING on.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Profile_h
+#define HAB_Profile_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Only a PROFILING build measures, otherwise these are empty. Include this after the
+	//definitions so PROFILING is seen. The host build (HAB_TRACING) draws them on its
+	//timeline instead, with the loop's sections and its events, which are only marked there.
+	#ifdef PROFILING
+		#define PROFILE_SETUP(names, count) HAB_Profile::setup(names, count)
+		#define PROFILE_BEGIN(slot) HAB_Profile::begin(slot)
+		#define PROFILE_END(slot) HAB_Profile::end(slot)
+		#define PROFILE_LOOP()
+		#define PROFILE_SECTION(name)
+		#define PROFILE_EVENT(name, detail, category)
+	#elif defined(HAB_TRACING)
+		#include <HAB_Trace.h>
+		#define PROFILE_SETUP(names, count) HAB_Trace::setSlotNames(names, count)
+		#define PROFILE_BEGIN(slot) HAB_Trace::beginSlot(slot)
+		#define PROFILE_END(slot) HAB_Trace::endSlot(slot)
+		#define PROFILE_LOOP() HAB_Trace::loop()
+		#define PROFILE_SECTION(name) HAB_Trace::section(name)
+		#define PROFILE_EVENT(name, detail, category) HAB_Trace::instant(name, detail, category)
+	#else
+		#define PROFILE_SETUP(names, count)
+		#define PROFILE_BEGIN(slot)
+		#define PROFILE_END(slot)
+		#define PROFILE_LOOP()
+		#define PROFILE_SECTION(name)
+		#define PROFILE_EVENT(name, detail, category)
+	#endif
+
+
+class HAB_Profile {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef PROFILE_MAX_SLOTS
+			#define PROFILE_MAX_SLOTS 8
+		#endif
+		#ifndef PROFILE_PAINT
+			#define PROFILE_PAINT 0xC5 //Free memory is filled with this, the stack overwrites it
+		#endif
+		#ifndef PROFILE_STACK_MARGIN
+			#define PROFILE_STACK_MARGIN 32 //Bytes below the stack pointer left unpainted, for begin's own frame
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			static uint8_t getSlotCount();
+			static uint32_t getCount(uint8_t slot);
+			static uint32_t getMeanTime(uint8_t slot);
+			static uint32_t getMaxTime(uint8_t slot);
+			static uint16_t getMaxStack(uint8_t slot);
+			static uint16_t getStackHeadroom();
+			static char* getReport(uint8_t slot, char* buffer);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			static void setup(const char* const* names, uint8_t count);
+			static void begin(uint8_t slot);
+			static void end(uint8_t slot);
+			static void reset();
+
+		private:
+			static uint8_t* getHeapEnd();
+			static uint8_t* findStackBottom();
+};
+
+#endif
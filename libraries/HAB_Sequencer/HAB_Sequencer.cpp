@@ -0,0 +1,150 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to hold a script of commands uploaded from the ground, each
+*				run onboard once an altitude or up-time is reached. Time-critical actions then
+*				don't wait on the link, and still happen while there is no connection.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Sequencer.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Sequencer::HAB_Sequencer(){}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getEntryCount															|
+		|	Purpose: 	Returns the number of entries still to run.								|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Sequencer::getEntryCount(){
+				return entryCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getRunCount																|
+		|	Purpose: 	Returns the number of entries run since startup.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Sequencer::getRunCount(){
+				return runCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getEntryInfo															|
+		|	Purpose: 	Writes an entry as it is listed, e.g.									|
+		|				SEQ 0 ALT 20000.00 T - OVR_ACT_OPEN										|
+		|				Returns NULL if there is no such entry.									|
+		|	Arguments:	uint8_t, char* (at least SEQUENCE_COMMAND_SIZE + 40)					|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Sequencer::getEntryInfo(uint8_t index, char* buffer){
+				if(index >= entryCount){ return NULL; }
+				sequenceEntry* entry = entries + index;
+				char number[16];
+
+				strcpy(buffer, "SEQ ");
+				strcat(buffer, utoa(index, number, 10));
+				strcat(buffer, " ALT ");
+				strcat(buffer, (entry->useAltitude ? formatFixed(number, entry->altitude) : "-"));
+				strcat(buffer, " T ");
+				strcat(buffer, (entry->useTime ? ultoa(entry->time, number, 10) : "-"));
+				strcat(buffer, " ");
+				strcat(buffer, entry->command);
+				return buffer;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		add																		|
+		|	Purpose: 	Adds an entry, run once the altitude or up-time (s) is reached. The		|
+		|				command must already be validated. Returns false if there is no room,	|
+		|				it is too long, or it has no trigger.									|
+		|	Arguments:	bool, Centimetres, bool, uint32_t, const char*							|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Sequencer::add(bool useAltitude, Centimetres altitude, bool useTime, uint32_t time, const char* command){
+				if(entryCount == SEQUENCE_MAX_ENTRIES || strlen(command) >= SEQUENCE_COMMAND_SIZE || (!useAltitude && !useTime)){
+					return false;
+				}
+				sequenceEntry* entry = entries + entryCount++;
+				entry->useAltitude = useAltitude;
+				entry->altitude = altitude;
+				entry->useTime = useTime;
+				entry->time = time;
+				strcpy(entry->command, command);
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		remove																	|
+		|	Purpose: 	Removes an entry, the later ones move up. Returns false if there is no	|
+		|				such entry.																|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Sequencer::remove(uint8_t index){
+				if(index >= entryCount){ return false; }
+				entryCount--;
+				for(uint8_t i = index; i != entryCount; i++){
+					entries[i] = entries[i + 1];
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		clear																	|
+		|	Purpose: 	Removes every entry.													|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Sequencer::clear(){
+				entryCount = 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		next																	|
+		|	Purpose: 	Finds the first entry whose trigger is reached, copies its command		|
+		|				and removes it. Returns false if none is due. Called every tick until	|
+		|				it returns false, it only looks at the entries left.					|
+		|	Arguments:	Centimetres, uint32_t (up-time, s), char* (SEQUENCE_COMMAND_SIZE)		|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Sequencer::next(Centimetres altitude, uint32_t time, char* command){
+				for(uint8_t i = 0; i != entryCount; i++){
+					sequenceEntry* entry = entries + i;
+					if((entry->useAltitude && altitude >= entry->altitude) || (entry->useTime && time >= entry->time)){
+						strcpy(command, entry->command);
+						HAB_Logging::printLog("Sequence entry due: ");
+						HAB_Logging::printLogln(command, "");
+						remove(i);
+						runCount++;
+						return true;
+					}
+				}
+				return false;
+			}
@@ -0,0 +1,90 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to hold a script of commands uploaded from the ground, each
+*				run onboard once an altitude or up-time is reached. Time-critical actions then
+*				don't wait on the link, and still happen while there is no connection.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Sequencer_h
+#define HAB_Sequencer_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <HAB_Fixed.h>
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+class HAB_Sequencer {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef SEQUENCE_MAX_ENTRIES
+			#define SEQUENCE_MAX_ENTRIES 10
+		#endif
+		#ifndef SEQUENCE_COMMAND_SIZE
+			#define SEQUENCE_COMMAND_SIZE 32 //Including the terminator
+		#endif
+
+		//Runs once either trigger is reached, an unused one is never reached
+		struct sequenceEntry {
+			bool useAltitude;
+			bool useTime;
+			Centimetres altitude; //At or above
+			uint32_t time; //Up-time (s) at or after
+			char command[SEQUENCE_COMMAND_SIZE];
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//Entries still to run, in the order they were added. Run ones are removed, so each tick
+		//only looks at those left.
+		sequenceEntry entries[SEQUENCE_MAX_ENTRIES];
+		uint8_t entryCount = 0;
+		uint16_t runCount = 0;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Sequencer();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getEntryCount();
+			uint16_t getRunCount();
+			char* getEntryInfo(uint8_t index, char* buffer);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool add(bool useAltitude, Centimetres altitude, bool useTime, uint32_t time, const char* command);
+			bool remove(uint8_t index);
+			void clear();
+			bool next(Centimetres altitude, uint32_t time, char* command);
+};
+
+#endif
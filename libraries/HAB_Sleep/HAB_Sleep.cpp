@@ -0,0 +1,205 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to idle the MCU between the loop's timed work instead of
+*				spinning. The ADC and SPI are powered down while it sleeps, and it keeps the duty
+*				cycle and an estimate of the current it saves.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Sleep.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Ports whose input ends a sleep before their buffers overflow
+	static Stream* wakeSerials[SLEEP_MAX_SERIALS];
+	static uint8_t wakeSerialCount = 0;
+
+	//Set by the wake pin's interrupt, e.g. the Ethernet controller's
+	static volatile bool wakeRequested = false;
+
+	//Duty cycle of the last full window, and the time slept in the current one
+	static uint8_t dutyCycle = 100;
+	static unsigned long windowStart = 0;
+	static uint32_t windowSlept = 0; //us
+	static uint32_t totalSlept = 0; //ms
+	static uint16_t sleptRemainder = 0; //us, below a ms
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDutyCycle															|
+		|	Purpose: 	Returns how much of the last window the MCU was awake (%).				|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Sleep::getDutyCycle(){
+				return dutyCycle;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCurrent																|
+		|	Purpose: 	Returns the MCU's estimated draw over the last window, between its		|
+		|				idle and active currents by the duty cycle (mA).						|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Sleep::getCurrent(){
+				return SLEEP_IDLE_CURRENT + ((SLEEP_ACTIVE_CURRENT - SLEEP_IDLE_CURRENT) * dutyCycle + 50) / 100;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSleepTime															|
+		|	Purpose: 	Returns the time slept since startup (ms).								|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Sleep::getSleepTime(){
+				return totalSlept;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimeUntil															|
+		|	Purpose: 	Returns the time until work last done at a time is due again, 0 if it	|
+		|				already is (ms).														|
+		|	Arguments:	unsigned long (last done), unsigned long (interval)						|
+		|	Returns:	unsigned long															|
+		\*-------------------------------------------------------------------------------------*/
+			unsigned long HAB_Sleep::getTimeUntil(unsigned long last, unsigned long interval){
+				unsigned long elapsed = millis() - last;
+				return (elapsed >= interval ? 0 : interval - elapsed);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setWakePin																|
+		|	Purpose: 	Ends a sleep when the pin falls, e.g. the Ethernet controller's			|
+		|				interrupt line. Must be an external interrupt pin.						|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Sleep::setWakePin(uint8_t pin){
+				pinMode(pin, INPUT_PULLUP);
+				attachInterrupt(digitalPinToInterrupt(pin), onWake, FALLING);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addWakeSerial															|
+		|	Purpose: 	Ends a sleep once a port has half a buffer of input waiting. Each byte	|
+		|				wakes the MCU anyway, this only decides whether it sleeps on. Returns	|
+		|				false if there is no room for another.									|
+		|	Arguments:	Stream*																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Sleep::addWakeSerial(Stream* serial){
+				if(wakeSerialCount == SLEEP_MAX_SERIALS){ return false; }
+				wakeSerials[wakeSerialCount++] = serial;
+				return true;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		idle																	|
+		|	Purpose: 	Sleeps in idle mode for up to the given time, with the ADC and SPI		|
+		|				powered down, and set up again as they were after. Timer 0 keeps		|
+		|				running, so millis() stays right and its tick wakes the MCU every ms	|
+		|				to check for the wake pin, serial input and the end of the time.		|
+		|				Called once per loop with its slack.									|
+		|	Arguments:	uint16_t (ms)															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Sleep::idle(uint16_t ms){
+				unsigned long start = millis();
+
+				//Closes the window
+				if((start - windowStart) >= SLEEP_WINDOW){
+					uint32_t window = (start - windowStart) * 10; //us per %
+					dutyCycle = (windowSlept >= window * 100 ? 0 : 100 - windowSlept / window);
+					windowStart = start;
+					windowSlept = 0;
+				}
+				if(ms == 0){ return; }
+
+				//Everything in the loop that uses them has finished
+				unsigned long startMicros = micros();
+				uint8_t adc = ADCSRA;
+				uint8_t spiControl = SPCR;
+				uint8_t spiStatus = SPSR;
+				ADCSRA = adc & ~_BV(ADEN);
+				power_adc_disable();
+				power_spi_disable();
+
+				set_sleep_mode(SLEEP_MODE_IDLE);
+				while((millis() - start) < ms && !isWakeDue()){
+					//Interrupts are only enabled by the instruction before the sleep, so a wake in between isn't missed
+					cli();
+					if(wakeRequested){
+						sei();
+						break;
+					}
+					sleep_enable();
+					sei();
+					sleep_cpu();
+					sleep_disable();
+				}
+				wakeRequested = false;
+
+				//The SPI isn't kept set up while gated, so the W5100's and SD card's clock mode and rate are put back
+				power_spi_enable();
+				SPCR = spiControl;
+				SPSR = spiStatus & _BV(SPI2X);
+				power_adc_enable();
+				ADCSRA = adc;
+
+				//Adds the time slept
+				uint32_t slept = micros() - startMicros;
+				windowSlept += slept;
+				slept += sleptRemainder;
+				totalSlept += slept / 1000;
+				sleptRemainder = slept % 1000;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isWakeDue																|
+		|	Purpose: 	Returns true once a wake port has half a buffer of input waiting.		|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Sleep::isWakeDue(){
+				for(uint8_t i = 0; i != wakeSerialCount; i++){
+					if(wakeSerials[i]->available() >= SLEEP_SERIAL_WAKE){ return true; }
+				}
+				return false;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		onWake																	|
+		|	Purpose: 	The wake pin's interrupt, ends the current sleep.						|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Sleep::onWake(){
+				wakeRequested = true;
+			}
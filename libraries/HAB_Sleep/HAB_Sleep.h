@@ -0,0 +1,80 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to idle the MCU between the loop's timed work instead of
+*				spinning. The ADC and SPI are powered down while it sleeps, and it keeps the duty
+*				cycle and an estimate of the current it saves.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Sleep_h
+#define HAB_Sleep_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <avr/sleep.h>
+	#include <avr/power.h>
+
+
+class HAB_Sleep {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef SLEEP_MAX_SERIALS
+			#define SLEEP_MAX_SERIALS 2
+		#endif
+		#ifndef SLEEP_SERIAL_WAKE
+			#define SLEEP_SERIAL_WAKE 32 //Bytes waiting that end a sleep, half the 64 byte receive buffer
+		#endif
+		#ifndef SLEEP_WINDOW
+			#define SLEEP_WINDOW 10000 //ms the duty cycle is measured over
+		#endif
+
+		//Estimated draw of the MCU alone (mA), at 16MHz and 5V
+		#ifndef SLEEP_ACTIVE_CURRENT
+			#define SLEEP_ACTIVE_CURRENT 20
+		#endif
+		#ifndef SLEEP_IDLE_CURRENT
+			#define SLEEP_IDLE_CURRENT 8 //Idle, with the ADC and SPI off
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			static uint8_t getDutyCycle();
+			static uint16_t getCurrent();
+			static uint32_t getSleepTime();
+			static unsigned long getTimeUntil(unsigned long last, unsigned long interval);
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			static void setWakePin(uint8_t pin);
+			static bool addWakeSerial(Stream* serial);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			static void idle(uint16_t ms);
+
+		private:
+			static bool isWakeDue();
+			static void onWake();
+};
+
+#endif
@@ -0,0 +1,215 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to bring the subsystems up together at startup. Each one's
+*				check is polled side by side with its own deadline, and the flight starts without
+*				those that are late, which are followed up from the loop.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Startup.h"
+	#include <HAB_Fixed.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Startup::HAB_Startup(){
+		startTime = millis();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCheckCount															|
+		|	Purpose: 	Returns the number of subsystems checked.								|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Startup::getCheckCount(){
+				return checkCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getName																	|
+		|	Purpose: 	Returns a check's subsystem name, e.g. "GPS".							|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	const char*																|
+		\*-------------------------------------------------------------------------------------*/
+			const char* HAB_Startup::getName(uint8_t index){
+				return (index < checkCount ? checks[index].name : "?");
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getStatus																|
+		|	Purpose: 	Returns a check's status.												|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	StartupStatus															|
+		\*-------------------------------------------------------------------------------------*/
+			StartupStatus HAB_Startup::getStatus(uint8_t index){
+				return (index < checkCount ? checks[index].status : STARTUP_FAILED);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSettledTime															|
+		|	Purpose: 	Returns when a check became ready or failed, from the start (ms). 0		|
+		|				while it is still pending or late.										|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Startup::getSettledTime(uint8_t index){
+				return (index < checkCount ? checks[index].settledTime : 0);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getReadyTime															|
+		|	Purpose: 	Returns when the flight started, from the start (ms). 0 until then.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Startup::getReadyTime(){
+				return readyTime;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDegradedMask															|
+		|	Purpose: 	Returns the checks that are not ready, bit n for check n.				|
+		|	Arguments:	void																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Startup::getDegradedMask(){
+				uint16_t mask = 0;
+				for(uint8_t i = 0; i != checkCount; i++){
+					if(checks[i].status != STARTUP_READY){ mask |= (1 << i); }
+				}
+				return mask;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isStarted																|
+		|	Purpose: 	Returns true once no check is pending: each is ready, failed or late,	|
+		|				and the flight can start.												|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Startup::isStarted(){
+				for(uint8_t i = 0; i != checkCount; i++){
+					if(checks[i].status == STARTUP_PENDING){ return false; }
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		isSettled																|
+		|	Purpose: 	Returns true once every check is ready or failed, so none are left to	|
+		|				follow up.																|
+		|	Arguments:	void																	|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Startup::isSettled(){
+				for(uint8_t i = 0; i != checkCount; i++){
+					if(checks[i].status == STARTUP_PENDING || checks[i].status == STARTUP_LATE){ return false; }
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getReport																|
+		|	Purpose: 	Writes the readiness report: the time to start, then each check as		|
+		|				NAME=seconds to ready, FAIL, LATE or WAIT. Checks that don't fit are	|
+		|				left off. e.g. STARTUP 4.2,NET=0.0,GS=2.3,CAM=FAIL,GPS=LATE				|
+		|	Arguments:	char* (buffer), uint16_t (its size)										|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Startup::getReport(char* buffer, uint16_t size){
+				char number[12];
+				strcpy(buffer, "STARTUP ");
+				strcat(buffer, (readyTime != 0 ? formatFixed(number, (int32_t)(readyTime / 100), 1) : "WAIT"));
+
+				for(uint8_t i = 0; i != checkCount; i++){
+					const char* result;
+					switch(checks[i].status){
+						case STARTUP_READY:		result = formatFixed(number, (int32_t)(checks[i].settledTime / 100), 1); break;
+						case STARTUP_FAILED:	result = "FAIL"; break;
+						case STARTUP_LATE:		result = "LATE"; break;
+						default:				result = "WAIT"; break;
+					}
+					if(strlen(buffer) + strlen(checks[i].name) + strlen(result) + 3 > size){ break; }
+					strcat(buffer, ",");
+					strcat(buffer, checks[i].name);
+					strcat(buffer, "=");
+					strcat(buffer, result);
+				}
+				return buffer;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		add																		|
+		|	Purpose: 	Adds a subsystem's check, with how long the flight waits for it from	|
+		|				the start (ms, 0 always waits). Returns false if there is no room.		|
+		|	Arguments:	const char*, StartupCheck, uint32_t										|
+		|	Returns:	bool																	|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Startup::add(const char* name, StartupCheck check, uint32_t timeout){
+				if(checkCount == STARTUP_MAX_CHECKS){ return false; }
+				startupEntry* entry = checks + checkCount++;
+				entry->name = name;
+				entry->check = check;
+				entry->timeout = timeout;
+				entry->status = STARTUP_PENDING;
+				entry->settledTime = 0;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Polls each pending and late check once, and marks those past their		|
+		|				deadline late. Returns the first check whose status changed (the rest	|
+		|				are polled on the next call), or -1.									|
+		|	Arguments:	void																	|
+		|	Returns:	int8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_Startup::update(){
+				int8_t changed = -1;
+				for(uint8_t i = 0; i != checkCount && changed < 0; i++){
+					startupEntry* entry = checks + i;
+					if(entry->status == STARTUP_READY || entry->status == STARTUP_FAILED){ continue; }
+
+					uint32_t elapsed = millis() - startTime;
+					StartupStatus status = entry->check();
+					if(status == STARTUP_PENDING){
+						if(entry->status == STARTUP_PENDING && entry->timeout != 0 && elapsed >= entry->timeout){
+							entry->status = STARTUP_LATE;
+							changed = i;
+						}
+					}
+					else{
+						entry->status = status;
+						entry->settledTime = elapsed;
+						changed = i;
+					}
+				}
+
+				if(readyTime == 0 && isStarted()){
+					readyTime = max(millis() - startTime, 1UL);
+				}
+				return changed;
+			}
@@ -0,0 +1,102 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to bring the subsystems up together at startup. Each one's
+*				check is polled side by side with its own deadline, and the flight starts without
+*				those that are late, which are followed up from the loop.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Startup_h
+#define HAB_Startup_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	enum StartupStatus : uint8_t {
+		STARTUP_PENDING = 0,	//Still coming up
+		STARTUP_READY = 1,
+		STARTUP_FAILED = 2,		//Gave up, not checked again
+		STARTUP_LATE = 3		//Past its deadline, still checked from the loop
+	};
+
+	//Polls a subsystem, returning pending, ready or failed. Must not block.
+	typedef StartupStatus (*StartupCheck)();
+
+
+class HAB_Startup {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef STARTUP_MAX_CHECKS
+			#define STARTUP_MAX_CHECKS 10
+		#endif
+
+		struct startupEntry {
+			const char* name;
+			StartupCheck check;
+			uint32_t timeout; //ms from the start, 0 waits for it
+			StartupStatus status;
+			uint32_t settledTime; //ms from the start it became ready or failed
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		startupEntry checks[STARTUP_MAX_CHECKS];
+		uint8_t checkCount = 0;
+
+		unsigned long startTime = 0;
+		uint32_t readyTime = 0; //ms from the start the flight began, 0 until then
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Startup();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getCheckCount();
+			const char* getName(uint8_t index);
+			StartupStatus getStatus(uint8_t index);
+			uint32_t getSettledTime(uint8_t index);
+			uint32_t getReadyTime();
+			uint16_t getDegradedMask();
+			bool isStarted();
+			bool isSettled();
+			char* getReport(char* buffer, uint16_t size);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			bool add(const char* name, StartupCheck check, uint32_t timeout);
+			int8_t update();
+};
+
+#endif
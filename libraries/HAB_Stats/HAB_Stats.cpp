@@ -0,0 +1,191 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep the count, minimum, maximum, mean and variance of
+*				each sensor over fixed windows, one sample at a time.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Stats.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Stats::HAB_Stats(){
+		windowStart = millis();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getChannelCount															|
+		|	Purpose: 	Returns the number of channels.											|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Stats::getChannelCount(){
+				return channelCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTag																	|
+		|	Purpose: 	Returns the short name of a channel.									|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			const char* HAB_Stats::getTag(uint8_t channel){
+				return channels[channel].tag;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getField																|
+		|	Purpose: 	Returns the telemetry field a channel belongs to.						|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint16_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Stats::getField(uint8_t channel){
+				return channels[channel].field;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getWindowEnd															|
+		|	Purpose: 	Returns the up-time (s) the last full window ended at, 0 if none yet.	|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint32_t HAB_Stats::getWindowEnd(){
+				return windowEnd;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getCount, getMean, getStdDev, getMin, getMax							|
+		|	Purpose: 	Return the results of a channel over the last full window.				|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	uint16_t / float														|
+		\*-------------------------------------------------------------------------------------*/
+			uint16_t HAB_Stats::getCount(uint8_t channel){ return summaries[channel].count; }
+			float HAB_Stats::getMean(uint8_t channel){ return summaries[channel].mean; }
+			float HAB_Stats::getStdDev(uint8_t channel){ return summaries[channel].stdDev; }
+			float HAB_Stats::getMin(uint8_t channel){ return summaries[channel].min; }
+			float HAB_Stats::getMax(uint8_t channel){ return summaries[channel].max; }
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addChannel																|
+		|	Purpose: 	Adds a channel. The tag is kept as a pointer, so it must not change.	|
+		|	Arguments:	char*, uint16_t															|
+		|	Returns:	int8_t (index of the channel, -1 if full)								|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_Stats::addChannel(const char* tag, uint16_t field){
+				if(channelCount >= STATS_MAX_CHANNELS){ return -1; }
+
+				channels[channelCount].tag = tag;
+				channels[channelCount].field = field;
+				reset(&channels[channelCount]);
+				memset(&summaries[channelCount], 0, sizeof(statsSummary));
+				return channelCount++;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		add																		|
+		|	Purpose: 	Adds a sample to a channel. Welford's method keeps the variance			|
+		|				accurate in float without storing the samples.							|
+		|	Arguments:	uint8_t, float															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Stats::add(uint8_t channel, float value){
+				if(channel >= channelCount || isnan(value)){ return; }
+				statsChannel* ch = &channels[channel];
+				if(ch->count == 65535){ return; }
+
+				ch->count++;
+				float delta = value - ch->mean;
+				ch->mean += delta / ch->count;
+				ch->m2 += delta * (value - ch->mean);
+				if(value < ch->min){ ch->min = value; }
+				if(value > ch->max){ ch->max = value; }
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Closes the window once it is over, keeping its results and starting		|
+		|				the next one. Should be called once per loop.							|
+		|	Arguments:	void																	|
+		|	Returns:	bool (true if a window was just closed)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Stats::update(){
+				if((millis() - windowStart) < STATS_WINDOW){ return false; }
+				windowStart += STATS_WINDOW;
+				if((millis() - windowStart) >= STATS_WINDOW){ windowStart = millis(); } //Fell behind, starts over
+				windowEnd = millis() / 1000;
+
+				for(uint8_t i = 0; i != channelCount; i++){
+					statsChannel* ch = &channels[i];
+					statsSummary* summary = &summaries[i];
+					summary->count = ch->count;
+					summary->mean = ch->mean;
+					summary->stdDev = (ch->count > 1 ? sqrt(ch->m2 / (ch->count - 1)) : 0);
+					summary->min = (ch->count > 0 ? ch->min : 0);
+					summary->max = (ch->count > 0 ? ch->max : 0);
+					reset(ch);
+				}
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		logSummaries															|
+		|	Purpose: 	Writes the results of the last window to the log, one line a channel.	|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Stats::logSummaries(){
+				char* stringPtr = HAB_Logging::getStringPtr();
+				char number[16];
+
+				for(uint8_t i = 0; i != channelCount; i++){
+					strcpy(stringPtr, "STATS ");
+					strcat(stringPtr, channels[i].tag);
+					strcat(stringPtr, " n=");		strcat(stringPtr, utoa(summaries[i].count, number, 10));
+					strcat(stringPtr, " min=");		strcat(stringPtr, dtostrf(summaries[i].min, 1, 2, number));
+					strcat(stringPtr, " max=");		strcat(stringPtr, dtostrf(summaries[i].max, 1, 2, number));
+					strcat(stringPtr, " mean=");	strcat(stringPtr, dtostrf(summaries[i].mean, 1, 2, number));
+					strcat(stringPtr, " sd=");		strcat(stringPtr, dtostrf(summaries[i].stdDev, 1, 3, number));
+					HAB_Logging::printLogln(stringPtr);
+				}
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		reset																	|
+		|	Purpose: 	Clears a channel for the next window.									|
+		|	Arguments:	statsChannel*															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Stats::reset(statsChannel* channel){
+				channel->count = 0;
+				channel->mean = 0;
+				channel->m2 = 0;
+				channel->min = INFINITY;
+				channel->max = -INFINITY;
+			}
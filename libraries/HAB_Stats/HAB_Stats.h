@@ -0,0 +1,114 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep the count, minimum, maximum, mean and variance of
+*				each sensor over fixed windows, one sample at a time.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Stats_h
+#define HAB_Stats_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#ifndef HAB_Logging_h
+        #include <HAB_Logging.h>
+    #endif
+
+
+class HAB_Stats {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef STATS_MAX_CHANNELS
+			#define STATS_MAX_CHANNELS 10
+		#endif
+		#ifndef STATS_WINDOW
+			#define STATS_WINDOW 60000 //ms
+		#endif
+
+		//Running values of the current window (Welford)
+		struct statsChannel {
+			const char* tag;
+			uint16_t field; //Telemetry field the channel belongs to
+			uint16_t count;
+			float mean;
+			float m2; //Sum of squared differences from the mean
+			float min;
+			float max;
+		};
+
+		//Results of the last full window
+		struct statsSummary {
+			uint16_t count;
+			float mean;
+			float stdDev;
+			float min;
+			float max;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		statsChannel channels[STATS_MAX_CHANNELS];
+		statsSummary summaries[STATS_MAX_CHANNELS];
+		uint8_t channelCount = 0;
+
+		//Window timing
+		unsigned long windowStart = 0;
+		uint32_t windowEnd = 0; //Up-time (s) the last full window ended at, 0 if none yet
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Stats();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getChannelCount();
+			const char* getTag(uint8_t channel);
+			uint16_t getField(uint8_t channel);
+			uint32_t getWindowEnd();
+			uint16_t getCount(uint8_t channel);
+			float getMean(uint8_t channel);
+			float getStdDev(uint8_t channel);
+			float getMin(uint8_t channel);
+			float getMax(uint8_t channel);
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			int8_t addChannel(const char* tag, uint16_t field);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			void add(uint8_t channel, float value);
+			bool update();
+			void logSummaries();
+
+		private:
+			void reset(statsChannel* channel);
+};
+
+#endif
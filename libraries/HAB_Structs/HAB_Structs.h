@@ -1,31 +1,58 @@
 #ifndef HAB_Structs_h
 #define HAB_Structs_h
 
-struct actuatorReadings {
-	uint16_t position; //signed int
-    float temperature;
-    char actuatorStatusPtr[10] = "AUTO"; //OVR_CLOSE
-    char heaterStatusPtr[13] = "AUTO"; //OVR_DISABLE
+#include <HAB_Fixed.h>
+
+//Override states, numbered as they are sent in telemetry and kept in the history records
+enum ActuatorStatus : uint8_t {
+    ACT_OVR_CLOSE = 0,
+    ACT_OVR_OPEN = 1,
+    ACT_AUTO = 2
+};
+
+enum HeaterStatus : uint8_t {
+    HEAT_OVR_DISABLED = 0,
+    HEAT_OVR_ENABLED = 1,
+    HEAT_AUTO = 2
+};
+
+//How an actuator's travel is going, or how the last one ended
+enum MotionStatus : uint8_t {
+    MOTION_IDLE = 0,
+    MOTION_MOVING = 1,
+    MOTION_SLOW = 2, //Reached the limit, but slowly (usually cold)
+    MOTION_STALLED = 3 //Stopped short of the limit
+};
+
+//The records are packed and their sizes checked, so the logger, telemetry and replay tools all see the same layout
+struct __attribute__((packed)) actuatorReadings {
+	uint16_t position; //ADC counts, 0-1023
+    CentiCelsius temperature;
+    ActuatorStatus actuatorStatus;
+    HeaterStatus heaterStatus;
+    MotionStatus motionStatus;
 };
 typedef struct actuatorReadings ActuatorReadings;
+static_assert(sizeof(ActuatorReadings) == 7, "ActuatorReadings layout changed");
 
-struct bmeReadings {
-	float temperature; //signed int
-    float pressure;
-    float humidity;
+struct __attribute__((packed)) bmeReadings {
+    Pascals pressure;
+	CentiCelsius temperature;
+    CentiPercent humidity;
 };
 typedef struct bmeReadings BMEReadings;
+static_assert(sizeof(BMEReadings) == 8, "BMEReadings layout changed");
 
-struct gpsReadings {  
-    uint8_t second; //Seconds
-    uint8_t minute; //Seconds
-    uint8_t hour; //Seconds
-	char dateTime[50];
-    float speed; //Meters per second
-    float altitude; //Meters
-	float latitude; //Degrees
-	float longitude; //Degrees
+struct __attribute__((packed)) gpsReadings {
+    CentimetresPerSecond speed;
+    Centimetres altitude;
+	MicroDegrees latitude;
+	MicroDegrees longitude;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
 };
 typedef struct gpsReadings GPSReadings;
+static_assert(sizeof(GPSReadings) == 19, "GPSReadings layout changed");
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,219 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep the list of telemetry subscribers, each with
+*				its own format, fields and rate. Each distinct packet is formatted once per tick.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Telemetry.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Telemetry::HAB_Telemetry(HAB_Outbox* outbox, TelemetryFormatter formatter){
+		this->outbox = outbox;
+		this->formatter = formatter;
+		for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){ subs[i].used = false; }
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSubscriberCount														|
+		|	Purpose: 	Returns the number of subscribers.										|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Telemetry::getSubscriberCount(){
+				uint8_t count = 0;
+				for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+					if(subs[i].used){ count++; }
+				}
+				return count;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getSubscriberInfo														|
+		|	Purpose: 	Describes a subscriber, e.g. "SUB 0 172.20.3.240:54444 F0 M0FFF 1000ms	|
+		|				E1". Returns NULL if there is no subscriber at that index.				|
+		|	Arguments:	uint8_t, char* (at least 48 characters)									|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* HAB_Telemetry::getSubscriberInfo(uint8_t index, char* buffer){
+				if(index >= TELEMETRY_MAX_SUBSCRIBERS || !subs[index].used){ return NULL; }
+
+				telemetrySubscriber* sub = &subs[index];
+				sprintf(buffer, "SUB %u %u.%u.%u.%u:%u F%u M%04X %ums E%u", index,
+					sub->ip[0], sub->ip[1], sub->ip[2], sub->ip[3], sub->port,
+					sub->format, sub->mask, sub->interval, sub->events);
+				return buffer;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getFormatCount															|
+		|	Purpose: 	Returns the number of distinct packets formatted in the last tick.		|
+		|	Arguments:	void																	|
+		|	Returns:	uint8_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t HAB_Telemetry::getFormatCount(){
+				return formatCount;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimeToNext															|
+		|	Purpose: 	Returns the time until the next subscriber is due, 0 if one is (ms).	|
+		|				With no subscribers it is never due.									|
+		|	Arguments:	void																	|
+		|	Returns:	unsigned long															|
+		\*-------------------------------------------------------------------------------------*/
+			unsigned long HAB_Telemetry::getTimeToNext(){
+				unsigned long now = millis();
+				unsigned long next = 0xFFFFFFFF;
+				for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+					if(!subs[i].used){ continue; }
+					unsigned long elapsed = now - subs[i].lastSent;
+					if(elapsed >= subs[i].interval){ return 0; }
+					next = min(next, subs[i].interval - elapsed);
+				}
+				return next;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Setters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addSubscriber															|
+		|	Purpose: 	Adds a subscriber. The interval is in milliseconds, events is true if	|
+		|				it should also get the event messages.									|
+		|	Arguments:	IPAddress, uint16_t, TelemetryFormat, uint16_t, uint16_t, bool			|
+		|	Returns:	int8_t (index of the subscriber, -1 if it could not be added)			|
+		\*-------------------------------------------------------------------------------------*/
+			int8_t HAB_Telemetry::addSubscriber(IPAddress ip, uint16_t port, TelemetryFormat format, uint16_t mask, uint16_t interval, bool events){
+				if(format >= TLM_FORMAT_COUNT || (mask & TLM_ALL) == 0){ return -1; }
+
+				//Finds a free entry
+				int8_t index = -1;
+				for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+					if(!subs[i].used){ index = i; break; }
+				}
+				if(index == -1){ return -1; }
+
+				//Each subscriber is its own outbox destination
+				int8_t dest = outbox->addDestination(ip, port, events);
+				if(dest == -1){ return -1; }
+
+				telemetrySubscriber* sub = &subs[index];
+				sub->used = true;
+				sub->dest = dest;
+				sub->ip = ip;
+				sub->port = port;
+				sub->events = events;
+				sub->format = format;
+				sub->mask = mask & TLM_ALL;
+				sub->interval = (interval < TELEMETRY_MIN_INTERVAL ? TELEMETRY_MIN_INTERVAL : interval);
+				sub->lastSent = millis() - sub->interval; //Due right away
+				return index;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		removeSubscriber														|
+		|	Purpose: 	Removes a subscriber, it stops getting telemetry and events.			|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	bool (false if there was no subscriber at that index)					|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Telemetry::removeSubscriber(uint8_t index){
+				if(index >= TELEMETRY_MAX_SUBSCRIBERS || !subs[index].used){ return false; }
+
+				outbox->removeDestination(subs[index].dest);
+				subs[index].used = false;
+				return true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setSubscriberInterval													|
+		|	Purpose: 	Changes how often a subscriber gets telemetry, in milliseconds.			|
+		|	Arguments:	uint8_t, uint16_t														|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Telemetry::setSubscriberInterval(uint8_t index, uint16_t interval){
+				if(index >= TELEMETRY_MAX_SUBSCRIBERS || !subs[index].used){ return; }
+				subs[index].interval = (interval < TELEMETRY_MIN_INTERVAL ? TELEMETRY_MIN_INTERVAL : interval);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Formats the telemetry for every subscriber that is due, each distinct	|
+		|				format and field mask only once, and hands it to the outbox.			|
+		|				Should be called once per loop.											|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Telemetry::update(){
+				unsigned long now = millis();
+				bool due[TELEMETRY_MAX_SUBSCRIBERS];
+				bool anyDue = false;
+
+				for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+					due[i] = subs[i].used && (now - subs[i].lastSent) >= subs[i].interval;
+					anyDue = anyDue || due[i];
+				}
+				if(!anyDue){ return; }
+
+				//The arena is rewritten, so telemetry still waiting in the outbox is formatted again too
+				TelemetryFormat keyFormat[TELEMETRY_MAX_SUBSCRIBERS];
+				uint16_t keyMask[TELEMETRY_MAX_SUBSCRIBERS];
+				char* keyText[TELEMETRY_MAX_SUBSCRIBERS];
+				uint16_t used = 0;
+				formatCount = 0;
+
+				for(uint8_t i = 0; i != TELEMETRY_MAX_SUBSCRIBERS; i++){
+					if(!due[i] && !(subs[i].used && outbox->hasTelemetry(subs[i].dest))){ continue; }
+
+					//Looks for the same packet already formatted this tick
+					char* text = NULL;
+					for(uint8_t k = 0; k != formatCount; k++){
+						if(keyFormat[k] == subs[i].format && keyMask[k] == subs[i].mask){
+							text = keyText[k];
+							break;
+						}
+					}
+
+					//Else formats it into the arena
+					if(text == NULL){
+						uint16_t len = formatter(arena + used, TELEMETRY_ARENA_SIZE - used, subs[i].format, subs[i].mask);
+						if(len > 0 && used + len + 1 <= TELEMETRY_ARENA_SIZE){
+							text = arena + used;
+							used += len + 1;
+							keyFormat[formatCount] = subs[i].format;
+							keyMask[formatCount] = subs[i].mask;
+							keyText[formatCount] = text;
+							formatCount++;
+						}
+					}
+
+					//Out of room, the packet is skipped rather than left pointing at old text
+					outbox->setTelemetry(subs[i].dest, text);
+					if(due[i]){ subs[i].lastSent = now; }
+				}
+			}
@@ -0,0 +1,140 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to keep the list of telemetry subscribers, each with
+*				its own format, fields and rate. Each distinct packet is formatted once per tick.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Telemetry_h
+#define HAB_Telemetry_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#ifndef HAB_Outbox_h
+        #include <HAB_Outbox.h>
+    #endif
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Packet formats
+	enum TelemetryFormat : uint8_t {
+		TLM_FULL = 0,	//PRISM's positional CSV, fields not in the mask are left empty
+		TLM_TAGGED = 1,	//[TLM] followed by only the fields in the mask, each with a tag
+		TLM_SUMMARY = 2	//[STAT] followed by the last window's statistics of the fields in the mask
+	};
+	#define TLM_FORMAT_COUNT 3
+
+	//Fields, in the order they appear in the packet
+	#define TLM_TIME		0x0001
+	#define TLM_HAB_ALT		0x0002
+	#define TLM_HAB_SPEED	0x0004
+	#define TLM_HAB_LON		0x0008
+	#define TLM_HAB_LAT		0x0010
+	#define TLM_CSA_ALT		0x0020
+	#define TLM_CSA_LON		0x0040
+	#define TLM_CSA_LAT		0x0080
+	#define TLM_TEMP		0x0100
+	#define TLM_PRESSURE	0x0200
+	#define TLM_HUMIDITY	0x0400
+	#define TLM_PODS		0x0800
+	#define TLM_LINK		0x1000
+	#define TLM_POWER		0x2000
+	#define TLM_PHASE		0x4000
+	#define TLM_LANDING		0x8000
+	#define TLM_ALL			0xFFFF
+
+	//Writes the packet for a format and field mask into the buffer, returns its length
+	typedef uint16_t (*TelemetryFormatter)(char* buffer, uint16_t size, TelemetryFormat format, uint16_t mask);
+
+
+class HAB_Telemetry {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		#ifndef TELEMETRY_MAX_SUBSCRIBERS
+			#define TELEMETRY_MAX_SUBSCRIBERS 6
+		#endif
+		#ifndef TELEMETRY_ARENA_SIZE
+			#define TELEMETRY_ARENA_SIZE 512 //Holds every distinct packet of a tick
+		#endif
+		#ifndef TELEMETRY_MIN_INTERVAL
+			#define TELEMETRY_MIN_INTERVAL 100 //Fastest rate (ms)
+		#endif
+
+		struct telemetrySubscriber {
+			bool used;
+			int8_t dest; //Outbox destination
+			IPAddress ip;
+			uint16_t port;
+			bool events;
+			TelemetryFormat format;
+			uint16_t mask;
+			uint16_t interval;
+			unsigned long lastSent;
+		};
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//Sends the packets
+		HAB_Outbox* outbox;
+		TelemetryFormatter formatter;
+
+		//Subscribers
+		telemetrySubscriber subs[TELEMETRY_MAX_SUBSCRIBERS];
+
+		//Packets of the current tick
+		char arena[TELEMETRY_ARENA_SIZE];
+		uint8_t formatCount = 0; //Distinct packets formatted in the last tick
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Telemetry(HAB_Outbox* outbox, TelemetryFormatter formatter);
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			uint8_t getSubscriberCount();
+			char* getSubscriberInfo(uint8_t index, char* buffer);
+			uint8_t getFormatCount();
+			unsigned long getTimeToNext();
+
+
+		//--------------------------------------------------------------------------------\
+		//Setters-------------------------------------------------------------------------|
+			int8_t addSubscriber(IPAddress ip, uint16_t port, TelemetryFormat format, uint16_t mask, uint16_t interval, bool events);
+			bool removeSubscriber(uint8_t index);
+			void setSubscriberInterval(uint8_t index, uint16_t interval);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			void update();
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to model how a pod's actuator warms and cools, as a first order
+*				system driven by the ambient temperature and its heater. The model is fitted in
+*				flight, and used to choose the heater duty and when to start pre-heating.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Thermal.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Constructor					   			|
+//--------------------------------------------------------------------------/
+
+
+	HAB_Thermal::HAB_Thermal(){
+		reset();
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Getters-------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimeConstant															|
+		|	Purpose: 	Returns the fitted time for the actuator to settle to the ambient (s).	|
+		|	Arguments:	void																	|
+		|	Returns:	float																	|
+		\*-------------------------------------------------------------------------------------*/
+			float HAB_Thermal::getTimeConstant(){
+				return (THERMAL_STEP / 1000.0) / cooling;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getHeatingRise															|
+		|	Purpose: 	Returns how far above the ambient the heater alone holds it (C).		|
+		|	Arguments:	void																	|
+		|	Returns:	float																	|
+		\*-------------------------------------------------------------------------------------*/
+			float HAB_Thermal::getHeatingRise(){
+				return heating / cooling;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getTimeToReach															|
+		|	Purpose: 	Returns how long the heater, left on, takes to bring the actuator to	|
+		|				the setpoint (s). 0 if already there, and a day if it never can.		|
+		|	Arguments:	float, float, float														|
+		|	Returns:	float																	|
+		\*-------------------------------------------------------------------------------------*/
+			float HAB_Thermal::getTimeToReach(float temperature, float ambient, float setpoint){
+				if(temperature >= setpoint){ return 0; }
+				float settled = ambient + heating / cooling;
+				if(settled <= setpoint){ return 86400; }
+				return getTimeConstant() * log((settled - temperature) / (settled - setpoint));
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getDuty																	|
+		|	Purpose: 	Returns the heater duty (0 to 1) for the next step: what the model		|
+		|				says holds the setpoint against the ambient, plus a proportional		|
+		|				correction, so it runs flat out when well below it.						|
+		|	Arguments:	float, float, float														|
+		|	Returns:	float																	|
+		\*-------------------------------------------------------------------------------------*/
+			float HAB_Thermal::getDuty(float temperature, float ambient, float setpoint){
+				float duty = cooling * (setpoint - ambient) / heating + THERMAL_GAIN * (setpoint - temperature);
+				return constrain(duty, 0.0, 1.0);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Miscellaneous-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		update																	|
+		|	Purpose: 	Fits one step: the temperature and ambient at its start, the duty		|
+		|				applied through it, and the temperature at its end. Recursive least		|
+		|				squares with forgetting, so the fit follows the flight's conditions.	|
+		|				A step without the heater only fits the cooling. A fit that comes out	|
+		|				unphysical is dropped.													|
+		|	Arguments:	float, float, float, float												|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Thermal::update(float lastTemperature, float lastAmbient, float duty, float temperature){
+				float x0 = lastAmbient - lastTemperature;
+				float x1 = duty;
+				float error = (temperature - lastTemperature) - (cooling * x0 + heating * x1);
+
+				//With the heater off the step says nothing of it, so only the cooling is fitted, keeping the rise
+				//believed so far (a fit from cooling alone drifts it, and pre-heating would start late)
+				if(x1 == 0){
+					float k0 = p00 * x0 / (THERMAL_FORGETTING + x0 * p00 * x0);
+					float newCooling = cooling + k0 * error;
+					if(newCooling <= 0 || newCooling >= 0.5){ return; }
+					heating *= newCooling / cooling;
+					cooling = newCooling;
+					p00 = (p00 - k0 * x0 * p00) / THERMAL_FORGETTING;
+					if(p00 > 1){ p00 = 1e-4; }
+					return;
+				}
+
+				//Gain = P x / (lambda + x' P x)
+				float px0 = p00 * x0 + p01 * x1;
+				float px1 = p01 * x0 + p11 * x1;
+				float denominator = THERMAL_FORGETTING + x0 * px0 + x1 * px1;
+				float k0 = px0 / denominator;
+				float k1 = px1 / denominator;
+
+				float newCooling = cooling + k0 * error;
+				float newHeating = heating + k1 * error;
+				if(newCooling <= 0 || newCooling >= 0.5 || newHeating <= 0){ return; }
+				cooling = newCooling;
+				heating = newHeating;
+
+				//P = (P - k x' P) / lambda
+				p00 = (p00 - k0 * px0) / THERMAL_FORGETTING;
+				p01 = (p01 - k0 * px1) / THERMAL_FORGETTING;
+				p11 = (p11 - k1 * px1) / THERMAL_FORGETTING;
+
+				//Without much change in the inputs the covariance grows, starts it over before it is large enough to jolt the fit
+				if(p00 + p11 > 100){ p00 = 1e-4; p01 = 0; p11 = 1; }
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		reset																	|
+		|	Purpose: 	Goes back to the starting model.										|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Thermal::reset(){
+				cooling = (THERMAL_STEP / 1000.0) / THERMAL_DEFAULT_TAU;
+				heating = cooling * THERMAL_DEFAULT_RISE;
+				p00 = 1e-4;
+				p01 = 0;
+				p11 = 1;
+			}
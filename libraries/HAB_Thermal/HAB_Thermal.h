@@ -0,0 +1,94 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	This library is used to model how a pod's actuator warms and cools, as a first order
+*				system driven by the ambient temperature and its heater. The model is fitted in
+*				flight, and used to choose the heater duty and when to start pre-heating.
+*				It is specifically tailored to the Western University HAB project.
+*/
+
+
+#ifndef HAB_Thermal_h
+#define HAB_Thermal_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef THERMAL_STEP
+		#define THERMAL_STEP 10000 //ms between model updates, also the heater PWM period
+	#endif
+
+
+class HAB_Thermal {
+
+	//--------------------------------------------------------------------------\
+	//								  Definitions					   			|
+	//--------------------------------------------------------------------------/
+		private:
+
+		//Starting model, until the fit has something better
+		#ifndef THERMAL_DEFAULT_TAU
+			#define THERMAL_DEFAULT_TAU 1800 //s for the actuator to settle to the ambient
+		#endif
+		#ifndef THERMAL_DEFAULT_RISE
+			#define THERMAL_DEFAULT_RISE 40 //C above the ambient it settles at with the heater always on
+		#endif
+		#ifndef THERMAL_FORGETTING
+			#define THERMAL_FORGETTING 0.995 //Each step's weight in the fit, about a half hour memory
+		#endif
+		#ifndef THERMAL_GAIN
+			#define THERMAL_GAIN 0.25 //Duty per C below the setpoint, on top of the model's steady duty
+		#endif
+
+
+	//--------------------------------------------------------------------------\
+	//								   Variables					   			|
+	//--------------------------------------------------------------------------/
+
+		//T(k+1) - T(k) = cooling * (ambient - T(k)) + heating * duty, per step
+		float cooling;
+		float heating;
+
+		//Recursive least squares covariance
+		float p00, p01, p11;
+
+
+	//--------------------------------------------------------------------------\
+	//								  Constructor					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+		HAB_Thermal();
+
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+
+
+		//--------------------------------------------------------------------------------\
+		//Getters-------------------------------------------------------------------------|
+			float getTimeConstant();
+			float getHeatingRise();
+			float getTimeToReach(float temperature, float ambient, float setpoint);
+			float getDuty(float temperature, float ambient, float setpoint);
+
+
+		//--------------------------------------------------------------------------------\
+		//Miscellaneous-------------------------------------------------------------------|
+			void update(float lastTemperature, float lastAmbient, float duty, float temperature);
+			void reset();
+};
+
+#endif
@@ -5,7 +5,7 @@
 //General-------------------------------------------------------------------------|
 
 	#define READINGS_TIME_STEP 1000	
-	#define STOP_ALTITUDE 5000
+	#define STOP_ALTITUDE 5000 //m, landing is only detected below this
 	
 	#define GROUNDSTATION_NAME "GROUNDSTATION"
 	#define PRISM_NAME "PRISM"
@@ -15,15 +15,19 @@
 //--------------------------------------------------------------------------------\
 //Ethernet & UDP------------------------------------------------------------------|
 
+	#undef UDP_TX_PACKET_MAX_SIZE //Replaces the Ethernet library's 24
 	#define UDP_TX_PACKET_MAX_SIZE 300 //Is this a safe size?
 	#define HEARTBEAT_TIMEOUT 10000
 	#define GPS_TIMEOUT 10000 //Our Timeout
 	#define CSA_GPS_TIMEOUT 30000 //CSA timeout
 	#define RECONNECT_DELAY 1000
-	#define ARGUMENT_MAX_LENGTH 20
+	#define RECEIVE_TIME_BUDGET 5 //Most time spent draining packets per loop (ms)
+	#define RECEIVE_MAX_PACKETS 16
+	#define COMMAND_MAX_ARGS 7
 	#define COMMAND_DELIMITER " "
 	#define FIELD_DELIMITER ","
 	#define MAX_TRANSMIT_ATTEMPTS 0 //Each additional attempt adds 200ms, which can delay the program a significant amount
+	//#define ETHERNET_INT_PIN 2 //W5100 INT, wakes the loop for a packet. Only if the shield's INT jumper is bridged.
 
 	//Local MAC, IP, port
 	#define MAC {0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED}
@@ -57,10 +61,37 @@
 	#define PRISM_PORT 10001
 	
 
+//--------------------------------------------------------------------------------\
+//Startup-------------------------------------------------------------------------|
+
+	//How long the flight waits for each subsystem from the start of the checks (ms), 0 waits for it. One that is
+	//late is started without, and followed up in the loop. The SD card, camera and BME settle at once.
+	#define STARTUP_NET_TIMEOUT 0
+	#define STARTUP_GS_TIMEOUT 30000
+	#define STARTUP_GPS_MODE_TIMEOUT 12000 //Three tries of the dynamic model take up to 10.5s
+	#define STARTUP_GPS_LOCK_TIMEOUT 60000
+	#define STARTUP_POD_TIMEOUT 5000
+
+
+//--------------------------------------------------------------------------------\
+//Idle----------------------------------------------------------------------------|
+
+	#define IDLE_MAX_TIME 20 //Longest sleep (ms), how often commands and pongs are polled for without ETHERNET_INT_PIN
+
+
+//--------------------------------------------------------------------------------\
+//Profiling-----------------------------------------------------------------------|
+
+	//Bench builds only: times the sections in profileNames and measures their stack, see PROFILE_REPORT.
+	//Painting the stack before each section adds about a millisecond to it, outside the time measured.
+	//#define PROFILING
+
+
 //--------------------------------------------------------------------------------\
 //GPS-----------------------------------------------------------------------------|
 
 	#define GPS_BAUD 9600
+	#undef GPS_MAX_AGE //Replaces HAB_GPS's default, for the sketch
 	#define GPS_MAX_AGE 110
 	#define GPS_RX_PIN 38 //Any digital
 	#define GPS_TX_PIN 10 //Recieve pin
@@ -94,6 +125,12 @@
 	//I2C (Set up wiring for this, no software config required)
 	//SDI to 20
 	//SCK to 21
+
+	//Forced mode settings, see HAB_BME280.h (x1 oversampling is about a 10ms conversion)
+	#define BME_OVERSAMPLING_T 2 //x2
+	#define BME_OVERSAMPLING_P 1 //x1
+	#define BME_OVERSAMPLING_H 1 //x1
+	#define BME_FILTER 0 //Off, the statistics do the smoothing
 	
 //--------------------------------------------------------------------------------\
 //Fan-----------------------------------------------------------------------------|	
@@ -117,9 +154,8 @@
 	#define MIN_ACTUATOR_TEMP -10
 	#define MAX_ACTUATOR_TEMP 0
 	
-	//#define POD_OPEN 0 //10 //THESE DON'T WORK HERE?? 
-	//#define POD_CLOSED 1 //1015 //Modify them in actuator.h
-	#define ADDITIONAL_PUSH_TIME 5000
+	//The open and closed limits are per pod, measured by CALIBRATE and kept in EEPROM (defaults in HAB_Actuator.h)
+	#define ADDITIONAL_PUSH_TIME 5000 //Longest push past the limit, the travel normally ends once the position settles
 
 	//Pod 1
 	#define HEAT1_EN 22
@@ -16,7 +16,9 @@ import tkinter as tk
 import _thread
 import time
 import queue
+import os
 import winsound
+from image_downlink import ImageAssembler
 
 
 #-----------------------------------------------------------------------------------------------------------\
@@ -56,6 +58,21 @@ act4CloseAlt = 99999
 actOpenLim = 10
 actCloseLim = 1020
 
+#Downlinked images are saved here
+image_directory = "images"
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                Image downlink                                             |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def sendGroundCommand(command):
+    if(remote_address != '' and remote_port != ''):
+        remoteSocket.sendto(bytes("GROUNDSTATION," + command, 'utf-8'), (str(remote_address), int(remote_port)))
+
+imageAssembler = ImageAssembler(sendGroundCommand, image_directory)
+
 
 #-----------------------------------------------------------------------------------------------------------\
 #                                              GUI thread functions                                         |
@@ -303,7 +320,7 @@ def threadmain():
     haltButton.place(x=420, y=200)
 	
     #Commands list
-    commandsLabel = tk.Label(height=13, width=30, justify="left", text="SET_ACTIVE <pod name>\nOVR_ACT_OPEN\nOVR_ACT_CLOSE\nOVR_ACT_HALT\nACT_ENABLE_LOCK\nACT_DISABLE_LOCK\nSET_MAX_TEMP <-20 to 30>\nSET_MIN_TEMP <-20 to 30>\nOVR_HEAT_ENABLE\nOVR_HEAT_DISABLE\nOVR_HEAT_RELEASE\nSET_DESCENDING\nHAB_END_FLIGHT")
+    commandsLabel = tk.Label(height=39, width=30, justify="left", text="SET_ACTIVE <pod name>\nOVR_ACT_OPEN\nOVR_ACT_CLOSE\nOVR_ACT_HALT\nACT_ENABLE_LOCK\nACT_DISABLE_LOCK\nCALIBRATE <pod name or ALL>\nCAL_CANCEL\nSET_MAX_TEMP <-20 to 30>\nSET_MIN_TEMP <-20 to 30>\nOVR_HEAT_ENABLE\nOVR_HEAT_DISABLE\nOVR_HEAT_RELEASE\nHEAT_REPORT\nPOWER_BUDGET <500 to 5000>\nPOWER_SOC <0 to 100>\nPOWER_REPORT\nSET_PHASE <name>\nSET_DESCENDING\nHAB_END_FLIGHT\nCAPTURE <0 to 2>\nCAM_TIMELAPSE <seconds>\nIMG_SEND <file name>\nIMG_CANCEL\nIMG_RATE <256 to 8192>\nSUB_ADD <ip> <port> <fmt> <mask> <ms>\nSUB_DEL <index>\nSUB_LIST\nGET_HISTORY <start s> <end s> <stride>\nHIST_CANCEL\nBME_CONFIG <t> <p> <h> <filter>\nBURST_RATE <20 to 50>\nSTARTUP_REPORT\nSEQ_ADD <m or -> <s or -> <command>\nSEQ_DEL <index>\nSEQ_LIST\nSEQ_CLEAR\nPROFILE_REPORT\nPROFILE_RESET")
     commandsLabel.place(x=1050, y=300)
 	
     #Start the GUI loop
@@ -323,9 +340,19 @@ def updateDisplays(message_text):
         eventFile = open("eventLog.txt", "a")
         eventFile.write(message_text + "\n")
         eventFile.close()
+    elif(message_text.startswith("[HIST]")):
+        #Records from the balloon's SD card, backfilled after an outage or asked for with GET_HISTORY
+        historyFile = open("historyLog.txt", "a")
+        historyFile.write(message_text + "\n")
+        historyFile.close()
+    elif(message_text.startswith("[TLM]") or message_text.startswith("[STAT]")):
+        #Tagged telemetry or statistics from an extra subscriber, only logged
+        telemetryFile = open("telemetryLog.txt", "a")
+        telemetryFile.write(message_text + "\n")
+        telemetryFile.close()
     else:
         telemetryFile = open("telemetryLog.txt", "a")
-        telemetryFile.write(message_text)
+        telemetryFile.write(message_text + "\n")
         telemetryFile.close()
 	
         #Assumed telemetry, so parse it
@@ -464,8 +491,26 @@ if __name__ == '__main__':
 	    #Attempt to receive a packet
         try:      
             message, address = serverSocket.recvfrom(1024)
-            print('(' + address[0] + ':' + str(address[1]) + ') : ' + message.decode('utf-8'))
-            updateDisplays(message.decode('utf-8'))
+
+            #Echoes pings straight back so the balloon can measure the link
+            if(message.startswith(b"[PING]")):
+                sendGroundCommand("PONG," + message[len(b"[PING]"):].decode('utf-8').strip("\0"))
+            #Image chunks are binary, so they are handled before decoding
+            elif(message.startswith(b"[IMAGE]")):
+                imageAssembler.handle_chunk(message)
+            elif(message.startswith(b"[IMGEND]")):
+                print('(' + address[0] + ':' + str(address[1]) + ') : ' + message.decode('utf-8'))
+                savedPath = imageAssembler.handle_end(message.decode('utf-8'))
+                if(savedPath):
+                    print('Saved image ' + savedPath)
+            else:
+                #Events and telemetry are batched, one per line
+                for line in message.decode('utf-8').split("\n"):
+                    line = line.strip("\0\r")
+                    if(line == ""):
+                        continue
+                    print('(' + address[0] + ':' + str(address[1]) + ') : ' + line)
+                    updateDisplays(line)
 
 		    #If no client address yet defined
             if(remote_address == ''):
@@ -0,0 +1,507 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : simulator.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : This program runs Monte Carlo flights of Western University's _HAB project on the host, to choose the pod
+#                    altitudes and timing constants. The flight software's pod, heater and link handling is followed step by
+#                    step with its constants read from the libraries, and each flight draws its own ascent, temperatures,
+#                    GPS dropouts and packet loss. The flights are spread across every core. A quick model: test/mission's
+#                    mission_sim flies the sketch's own code on the host build instead, for the figures to trust, and its
+#                    --trace gives the loop's timeline.
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import argparse
+import math
+import multiprocessing
+import os
+import random
+import re
+import time
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Variables                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+repo_directory = os.path.dirname(os.path.abspath(__file__))
+
+#Constants read from these, later files win like the sketch's includes
+source_files = [
+    "libraries/HAB_Thermal/HAB_Thermal.h",
+    "libraries/HAB_Motion/HAB_Motion.h",
+    "libraries/HAB_Actuator/HAB_Actuator.h",
+    "libraries/HAB_Phase/HAB_Phase.h",
+    "libraries/HAB_definitions/HAB_Definitions.h",
+]
+sketch_file = "flight_software_manual.ino"
+
+#Step of the simulation (s), the sketch's readings step
+step = 1.0
+
+#What the flights draw from, (mean, standard deviation) unless noted. These are the model, not the flight
+#software, so they are kept here rather than read.
+flight_model = {
+    "pad_altitude": (250, 50),              #m
+    "ascent_rate": (5.0, 0.7),              #m/s
+    "burst_altitude": (31000, 2500),        #m
+    "descent_rate": (5.0, 0.5),             #m/s at sea level, faster in the thin air above
+    "ground_temperature": (10, 8),          #C
+    "lapse_rate": (6.5, 0.5),               #C/km up to the tropopause
+    "tropopause": (11000, 1500),            #m
+    "stratosphere_warming": (1.0, 0.3),     #C/km above 20km
+    "pod_tau": (1.0, 0.2),                  #Fraction of THERMAL_DEFAULT_TAU
+    "pod_rise": (1.0, 0.2),                 #Fraction of THERMAL_DEFAULT_RISE
+    "gps_dropout_rate": 1 / 1800.0,         #Per second
+    "gps_dropout_length": 60,               #s, mean
+    "packet_loss": (0.0, 0.3),              #Uniform range, drawn once per flight
+    "outage_rate": 1 / 3600.0,              #Per second, the link is down entirely
+    "outage_length": 120,                   #s, mean
+    "operator_delay": (5, 2),               #s from seeing the altitude to sending the command
+    "operator_retry": 15,                   #s before a command that got no reply is sent again
+    "travel_time": (8, 1.5),                #s for a warm actuator's full travel
+    "cold_slowdown": 0.03,                  #Travel time added per C below 0C
+    "freeze_temperature": (-25, 3),         #C, an actuator this cold stalls
+    "noisy_position": 0.15,                 #Chance a travel's position never settles, so it is pushed the full time
+    "seal_push": (0.5, 4.0),                #Uniform range (s), push past the limit a pod needs to seal when noisy
+}
+
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                             Flight software constants                                     |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def readConstants():
+    #Every numeric #define, the sketch's pod intervals in order
+    constants = {}
+    for name in source_files:
+        with open(os.path.join(repo_directory, name)) as sourceFile:
+            for match in re.finditer(r"^\s*#define\s+(\w+)\s+(-?\d+(?:\.\d+)?)\b", sourceFile.read(), re.M):
+                constants[match.group(1)] = float(match.group(2))
+
+    pods = []
+    with open(os.path.join(repo_directory, sketch_file)) as sourceFile:
+        for match in re.finditer(r'HAB_Actuator\("(\w+)".*?fromMetres\((\d+)\),\s*fromMetres\((\d+)\)\)', sourceFile.read()):
+            pods.append({"name": match.group(1), "open": float(match.group(2)), "close": float(match.group(3))})
+    return constants, pods
+
+def applyOverrides(constants, pods, settings, podSettings):
+    #NAME=value, and index=open:close (m) with the first pod 1
+    for setting in settings:
+        name, value = setting.split("=", 1)
+        if(name not in constants):
+            raise SystemExit("Unknown constant " + name)
+        constants[name] = float(value)
+    for setting in podSettings:
+        index, interval = setting.split("=", 1)
+        openAltitude, closeAltitude = interval.split(":")
+        pods[int(index) - 1]["open"] = float(openAltitude)
+        pods[int(index) - 1]["close"] = float(closeAltitude)
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                  Flight model                                             |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def draw(rng, name):
+    mean, deviation = flight_model[name]
+    return rng.gauss(mean, deviation)
+
+def ambientTemperature(flight, altitude):
+    #Standard-atmosphere shape: the lapse rate to the tropopause, then flat, then warming above 20km
+    coldest = min(altitude, flight["tropopause"])
+    temperature = flight["ground_temperature"] - flight["lapse_rate"] * (coldest - flight["pad_altitude"]) / 1000.0
+    return temperature + flight["stratosphere_warming"] * max(0.0, altitude - 20000) / 1000.0
+
+def drawFlight(rng):
+    flight = {name: draw(rng, name) for name in ("pad_altitude", "ascent_rate", "burst_altitude", "descent_rate", "ground_temperature",
+        "lapse_rate", "tropopause", "stratosphere_warming", "pod_tau", "pod_rise", "freeze_temperature")}
+    flight["ascent_rate"] = max(flight["ascent_rate"], 2.0)
+    flight["descent_rate"] = max(flight["descent_rate"], 2.0)
+    flight["packet_loss"] = rng.uniform(*flight_model["packet_loss"])
+    return flight
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                            Flight software, as modelled                                   |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+class Pod:
+    #One pod: HAB_Actuator's interval, travel and heater, with the thermal model it fits taken as already fitted
+    def __init__(self, spec, constants, flight, rng):
+        self.name = spec["name"]
+        self.openAlt = spec["open"]
+        self.closeAlt = spec["close"]
+        self.constants = constants
+        self.rng = rng
+        self.tau = constants["THERMAL_DEFAULT_TAU"] * flight["pod_tau"]
+        self.rise = constants["THERMAL_DEFAULT_RISE"] * flight["pod_rise"]
+        self.freeze = flight["freeze_temperature"]
+        self.temperature = flight["ground_temperature"]
+        self.hasEnteredInterval = False
+        self.hasOpened = False
+
+        #Travel: None, "open" or "close", and how long it has left (s)
+        self.isOpen = False
+        self.moving = None
+        self.travelLeft = 0.0
+        self.override = None #None (released), "open" or "close"
+        self.stalled = False
+        self.unsealed = False
+
+        #Heater step
+        self.duty = 0.0
+        self.stepLeft = 0.0
+        self.heaterEnergy = 0.0 #Duty-seconds
+
+        #Results
+        self.intervalTime = 0.0
+        self.sampledTime = 0.0
+        self.openOutside = 0.0
+
+    def isInInterval(self, altitude):
+        #HAB_Actuator::isInInterval
+        if(self.openAlt < self.closeAlt):
+            return self.openAlt <= altitude < self.closeAlt
+        if(not self.hasEnteredInterval and altitude >= self.openAlt):
+            self.hasEnteredInterval = True
+            return True
+        return self.hasEnteredInterval and altitude > self.closeAlt
+
+    def updateHeating(self, ambient, altitude, climbRate, target):
+        #HAB_Actuator::updateHeating and isHeatingNeeded, a duty chosen every THERMAL_STEP
+        self.stepLeft -= step
+        if(self.stepLeft <= 0):
+            self.stepLeft += self.constants["THERMAL_STEP"] / 1000.0
+            needed = self.isInInterval(altitude)
+            if(not needed and not self.hasOpened and altitude < self.openAlt and climbRate * 100 >= self.constants["THERMAL_MIN_CLIMB"]):
+                settled = ambient + self.rise
+                toReach = (0 if self.temperature >= target else 86400 if settled <= target
+                    else self.tau * math.log((settled - self.temperature) / (settled - target)))
+                needed = (self.openAlt - altitude) / climbRate <= toReach + self.constants["THERMAL_PREHEAT_MARGIN"]
+            setpoint = target if needed else self.constants["THERMAL_SURVIVAL_TEMP"]
+            duty = (setpoint - ambient) / self.rise + self.constants["THERMAL_GAIN"] * (setpoint - self.temperature)
+            self.duty = min(max(duty, 0.0), 1.0)
+            if(self.duty * self.constants["THERMAL_STEP"] < self.constants["THERMAL_MIN_ON"]):
+                self.duty = 0.0
+
+        #First order towards the ambient, plus the heater
+        self.temperature += (ambient + self.rise * self.duty - self.temperature) * step / self.tau
+        self.heaterEnergy += self.duty * step
+
+    def updateMotion(self):
+        #handleActuator: starts towards the override, and halts once settled, pushed the full time, or stalled
+        if(self.moving is None and self.override is not None and not self.stalled and (self.override == "open") != self.isOpen):
+            self.moving = self.override
+            travel = max(1.0, self.rng.gauss(*flight_model["travel_time"]))
+            travel *= 1 + flight_model["cold_slowdown"] * max(0.0, -self.temperature)
+            push = self.constants["MOTION_SETTLED_TIME"] / 1000.0
+            if(self.rng.random() < flight_model["noisy_position"]):
+                push = self.constants["ADDITIONAL_PUSH_TIME"] / 1000.0
+                if(self.moving == "close"):
+                    self.unsealed = self.unsealed or push < self.rng.uniform(*flight_model["seal_push"])
+            self.travelLeft = travel + push
+            if(self.moving == "open"):
+                self.hasOpened = True
+        if(self.moving is None):
+            return None
+        if(self.temperature < self.freeze):
+            self.moving = None
+            self.stalled = True
+            return "stall"
+        self.travelLeft -= step
+        if(self.travelLeft <= 0):
+            self.isOpen = (self.moving == "open")
+            done = self.moving
+            self.moving = None
+            return done
+        return None
+
+    def halt(self):
+        #deactivateAll, when another pod is made active
+        self.moving = None
+
+
+class Link:
+    #The heartbeat and reconnection in recievePacketsUDP, over a lossy link with outages
+    def __init__(self, constants, flight, rng):
+        self.constants = constants
+        self.rng = rng
+        self.loss = flight["packet_loss"]
+        self.outageLeft = 0.0
+        self.connected = True
+        self.lastHeartbeat = 0.0
+        self.lastInit = 0.0
+        self.disconnects = 0
+        self.spuriousDisconnects = 0
+        self.disconnectedTime = 0.0
+
+    def update(self, now):
+        if(self.outageLeft > 0):
+            self.outageLeft -= step
+        elif(self.rng.random() < flight_model["outage_rate"] * step):
+            self.outageLeft = self.rng.expovariate(1.0 / flight_model["outage_length"])
+
+        #The groundstation's heartbeat, about every second
+        if(self.connected and self.delivered()):
+            self.lastHeartbeat = now
+
+        lost = False
+        if(now - self.lastHeartbeat > self.constants["HEARTBEAT_TIMEOUT"] / 1000.0 and self.connected):
+            self.connected = False
+            self.disconnects += 1
+            if(self.outageLeft <= 0):
+                self.spuriousDisconnects += 1
+            lost = True
+        #Disconnected, INTLZ every RECONNECT_DELAY until the groundstation's reply gets back
+        if(not self.connected):
+            self.disconnectedTime += step
+            if(now - self.lastInit > self.constants["RECONNECT_DELAY"] / 1000.0):
+                self.lastInit = now
+                if(self.delivered() and self.delivered()):
+                    self.connected = True
+                    self.lastHeartbeat = now
+        return lost
+
+    def delivered(self):
+        return self.outageLeft <= 0 and self.rng.random() >= self.loss
+
+
+class Operator:
+    #The groundstation operator, commanding from the telemetry they see
+    def __init__(self, pods, rng):
+        self.pods = pods
+        self.rng = rng
+        self.seenAltitude = None
+        self.seenDescending = False
+        self.pending = None #(due time, pod index, "open" or "close")
+        self.lastSent = {}
+
+    def update(self, now, link, habAltitude, descending):
+        #Telemetry reaches them only while connected
+        if(link.connected and link.delivered()):
+            self.seenAltitude = habAltitude
+            self.seenDescending = descending
+        if(self.seenAltitude is None):
+            return None
+
+        #The pod that should be in use, open while within its interval
+        wanted = None
+        for i, pod in enumerate(self.pods):
+            #A stalled pod is alarmed and given up on
+            if(pod.stalled):
+                continue
+            if(pod.isOpen or pod.moving == "open" or pod.override == "open"):
+                if(not pod.openAlt <= self.seenAltitude < pod.closeAlt):
+                    wanted = (i, "close")
+                    break
+            elif(not pod.hasOpened and not self.seenDescending and pod.openAlt <= self.seenAltitude < pod.closeAlt):
+                wanted = (i, "open")
+                break
+        if(wanted is None):
+            self.pending = None
+            return None
+        if(self.pending is None or self.pending[1:] != wanted):
+            self.pending = (now + max(0.0, self.rng.gauss(*flight_model["operator_delay"])),) + wanted
+        if(now < self.pending[0]):
+            return None
+
+        #Sent, and again if nothing changed by the retry time
+        if(now - self.lastSent.get(wanted, -1e9) < flight_model["operator_retry"]):
+            return None
+        self.lastSent[wanted] = now
+        return wanted
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                     Flights                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def runFlight(seed, constants, podSpecs):
+    #One flight from the pad to landing, returns each pod's results and the link's
+    rng = random.Random(seed)
+    flight = drawFlight(rng)
+    pods = [Pod(spec, constants, flight, rng) for spec in podSpecs]
+    link = Link(constants, flight, rng)
+    operator = Operator(pods, rng)
+    target = (constants["MIN_ACTUATOR_TEMP"] + constants["MAX_ACTUATOR_TEMP"]) / 2
+
+    altitude = flight["pad_altitude"]
+    habAltitude = altitude
+    climbRate = 0.0
+    descending = False
+    gpsDropLeft = 0.0
+    activeIndex = 0
+    now = 0.0
+
+    while(True):
+        now += step
+
+        #Flight-------------------------------------------------------------|
+        if(not descending):
+            rate = max(0.5, flight["ascent_rate"] + rng.gauss(0, 0.5))
+            altitude += rate * step
+            if(altitude >= flight["burst_altitude"]):
+                descending = True
+        else:
+            rate = -flight["descent_rate"] * math.exp(altitude / 14000.0)
+            altitude += rate * step
+            if(altitude <= flight["pad_altitude"]):
+                break
+        ambient = ambientTemperature(flight, altitude)
+
+        #GPS, the readings keep the last fix through a dropout--------------|
+        if(gpsDropLeft > 0):
+            gpsDropLeft -= step
+        elif(rng.random() < flight_model["gps_dropout_rate"] * step):
+            gpsDropLeft = rng.expovariate(1.0 / flight_model["gps_dropout_length"])
+        if(gpsDropLeft <= 0):
+            climbRate += ((altitude - habAltitude) / step - climbRate) / 4
+            habAltitude = altitude
+
+        #Link, the active pod's override is released when it is lost--------|
+        if(link.update(now)):
+            pods[activeIndex].override = None
+
+        #Commands-----------------------------------------------------------|
+        command = operator.update(now, link, habAltitude, descending)
+        if(command is not None and link.delivered()):
+            index, action = command
+            if(index != activeIndex):
+                pods[activeIndex].halt()
+                activeIndex = index
+            pods[index].override = action
+
+        #Pods---------------------------------------------------------------|
+        for i, pod in enumerate(pods):
+            pod.updateHeating(ambient, habAltitude, climbRate, target)
+            if(i == activeIndex):
+                pod.updateMotion()
+            inInterval = (not descending) and pod.openAlt <= altitude < pod.closeAlt
+            if(inInterval):
+                pod.intervalTime += step
+                if(pod.isOpen and pod.moving is None):
+                    pod.sampledTime += step
+            elif(pod.isOpen or pod.moving is not None):
+                pod.openOutside += step
+
+
+    results = []
+    for pod in pods:
+        crossed = pod.intervalTime > 0
+        results.append({
+            "crossed": crossed,
+            "coverage": (pod.sampledTime / pod.intervalTime if crossed else 0.0),
+            "never_opened": crossed and not pod.hasOpened,
+            "stalled": pod.stalled,
+            "unsealed": pod.unsealed,
+            "left_open": pod.isOpen or pod.openOutside > 60,
+            "heater": pod.heaterEnergy,
+        })
+    return {"pods": results, "disconnects": link.disconnects, "spurious": link.spuriousDisconnects,
+        "disconnected": link.disconnectedTime, "duration": now}
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                  Monte Carlo                                              |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def runBatch(job):
+    #A batch of flights in one worker, summed there so only the totals come back
+    seeds, constants, podSpecs = job
+    totals = newTotals(len(podSpecs))
+    for seed in seeds:
+        addFlight(totals, runFlight(seed, constants, podSpecs))
+    return totals
+
+def newTotals(podCount):
+    return {"flights": 0, "disconnects": 0, "spurious": 0, "disconnected": 0.0,
+        "pods": [{"crossed": 0, "coverage": [], "never_opened": 0, "stalled": 0, "unsealed": 0, "left_open": 0, "heater": 0.0}
+            for _ in range(podCount)]}
+
+def addFlight(totals, flight):
+    totals["flights"] += 1
+    for name in ("disconnects", "spurious", "disconnected"):
+        totals[name] += flight[name]
+    for podTotals, pod in zip(totals["pods"], flight["pods"]):
+        if(pod["crossed"]):
+            podTotals["crossed"] += 1
+            podTotals["coverage"].append(pod["coverage"])
+        for name in ("never_opened", "stalled", "unsealed", "left_open"):
+            podTotals[name] += pod[name]
+        podTotals["heater"] += pod["heater"]
+
+def mergeTotals(totals, other):
+    for name in ("flights", "disconnects", "spurious", "disconnected"):
+        totals[name] += other[name]
+    for podTotals, podOther in zip(totals["pods"], other["pods"]):
+        for name in podTotals:
+            podTotals[name] += podOther[name]
+
+def runMonteCarlo(flights, constants, podSpecs, workers, batch, seed):
+    #Batches are handed out as workers free up, so a slow batch doesn't hold the others back
+    seeds = list(range(seed, seed + flights))
+    jobs = [(seeds[i:i + batch], constants, podSpecs) for i in range(0, flights, batch)]
+    totals = newTotals(len(podSpecs))
+    if(workers == 1):
+        for job in jobs:
+            mergeTotals(totals, runBatch(job))
+        return totals
+    with multiprocessing.Pool(workers) as pool:
+        for result in pool.imap_unordered(runBatch, jobs, chunksize=1):
+            mergeTotals(totals, result)
+    return totals
+
+def percentile(values, fraction):
+    if(not values):
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+def printReport(totals, podSpecs, elapsed, workers):
+    flights = totals["flights"]
+    print("%d flights in %.1f s on %d workers (%.0f flights/s)" % (flights, elapsed, workers, flights / max(elapsed, 1e-9)))
+    print("Link: %.2f disconnects per flight (%.2f with the link up), %.0f s disconnected per flight" % (
+        totals["disconnects"] / flights, totals["spurious"] / flights, totals["disconnected"] / flights))
+    print("%-6s %13s %9s %9s %9s %9s %9s %9s %9s %9s" % ("Pod", "Band (m)", "Crossed", "Mean cov", "P10 cov",
+        "No open", "Stalled", "Unsealed", "Left open", "Heat (s)"))
+    for spec, pod in zip(podSpecs, totals["pods"]):
+        crossed = max(pod["crossed"], 1)
+        print("%-6s %6d-%-6d %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %9.0f" % (spec["name"], spec["open"], min(spec["close"], 99999),
+            100.0 * pod["crossed"] / flights, 100.0 * sum(pod["coverage"]) / crossed, 100.0 * percentile(pod["coverage"], 0.1),
+            100.0 * pod["never_opened"] / crossed, 100.0 * pod["stalled"] / flights, 100.0 * pod["unsealed"] / flights,
+            100.0 * pod["left_open"] / flights, pod["heater"] / flights))
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                      Main                                                 |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+if(__name__ == "__main__"):
+    parser = argparse.ArgumentParser(description="Monte Carlo flights of the HAB's pod, heater and link handling.")
+    parser.add_argument("-n", "--flights", type=int, default=1000)
+    parser.add_argument("-j", "--workers", type=int, default=os.cpu_count())
+    parser.add_argument("--batch", type=int, default=10, help="flights per batch handed to a worker")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--set", action="append", default=[], metavar="NAME=VALUE", help="override a flight software constant")
+    parser.add_argument("--pod", action="append", default=[], metavar="N=OPEN:CLOSE", help="override pod N's interval (m)")
+    arguments = parser.parse_args()
+
+    constants, podSpecs = readConstants()
+    applyOverrides(constants, podSpecs, arguments.set, arguments.pod)
+    startTime = time.time()
+    totals = runMonteCarlo(arguments.flights, constants, podSpecs, max(1, arguments.workers), max(1, arguments.batch), arguments.seed)
+    printReport(totals, podSpecs, time.time() - startTime, max(1, arguments.workers))
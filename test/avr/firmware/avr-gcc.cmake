@@ -0,0 +1,33 @@
+#----------------------------------------------------------------------------------------------------------
+#   Author  :   Western University HAB team
+#   Date    :   Oct 19, 2026
+#   Purpose :   avr-gcc for the Arduino Mega (ATmega2560), with the flags the Arduino IDE's AVR core
+#               builds with (its platform.txt), so sizes and cycles are the board's.
+#
+#               cmake -S test/avr/firmware -B _avr_build -DCMAKE_TOOLCHAIN_FILE=test/avr/firmware/avr-gcc.cmake
+#----------------------------------------------------------------------------------------------------------
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR avr)
+
+set(CMAKE_C_COMPILER avr-gcc)
+set(CMAKE_CXX_COMPILER avr-g++)
+set(CMAKE_ASM_COMPILER avr-gcc)
+set(CMAKE_AR avr-gcc-ar)
+set(CMAKE_RANLIB avr-gcc-ranlib)
+
+#Nothing can be run to test the compiler
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(HAB_MCU atmega2560)
+set(HAB_F_CPU 16000000L)
+set(HAB_AVR_FLAGS "-mmcu=${HAB_MCU} -DF_CPU=${HAB_F_CPU} -DARDUINO=10819 -DARDUINO_AVR_MEGA2560 -DARDUINO_ARCH_AVR")
+
+set(CMAKE_C_FLAGS_INIT "${HAB_AVR_FLAGS} -std=gnu11 -Os -g -flto -fno-fat-lto-objects -ffunction-sections -fdata-sections")
+set(CMAKE_CXX_FLAGS_INIT "${HAB_AVR_FLAGS} -std=gnu++11 -Os -g -flto -fpermissive -fno-exceptions -fno-threadsafe-statics -ffunction-sections -fdata-sections -Wno-error=narrowing")
+set(CMAKE_ASM_FLAGS_INIT "${HAB_AVR_FLAGS} -x assembler-with-cpp -flto")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-mmcu=${HAB_MCU} -Os -g -flto -fuse-linker-plugin -Wl,--gc-sections")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,224 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Bench firmware for simavr_bench: calls the flight code's hot paths on the ATmega2560
+*				as the loop does, each between a write of its slot to GPIOR0 and to GPIOR1, which
+*				simavr_bench times in cycles and watches the stack pointer between. The slots'
+*				names are read from slotNames by report.py. Nothing is wired to the simulated
+*				board: the SPI and I2C buses are empty and every ADC input reads what the runner
+*				sets. Time is moved on by setting the core's millisecond count where a path only
+*				runs once enough of it has passed. Ends with GPIOR2 and a sleep with interrupts off.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Actuator.h>
+	#include <HAB_Fixed.h>
+	#include <HAB_Landing.h>
+	#include <HAB_Outbox.h>
+	#include <HAB_Parse.h>
+	#include <HAB_Thermal.h>
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+	#include <avr/sleep.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define BENCH_ITERATIONS 32
+
+	//Brackets a call, the barriers keep its work between the writes
+	#define BENCH_BEGIN(slot) do{ __asm__ __volatile__("" ::: "memory"); GPIOR0 = (slot); }while(0)
+	#define BENCH_END(slot) do{ GPIOR1 = (slot); __asm__ __volatile__("" ::: "memory"); }while(0)
+
+	//Slot 0 is no slot, the names follow from BENCH_EMPTY
+	enum benchSlot : uint8_t {
+		BENCH_EMPTY = 1,
+		BENCH_TOKENIZE,
+		BENCH_PARSE_FIXED,
+		BENCH_FORMAT_FIXED,
+		BENCH_THERMISTOR,
+		BENCH_INTERVAL,
+		BENCH_THERMAL_UPDATE,
+		BENCH_THERMAL_DUTY,
+		BENCH_UPDATE_HEATING,
+		BENCH_LANDING,
+		BENCH_OUTBOX_QUEUE
+	};
+
+	static const char* const slotNames[] = {
+		"empty",
+		"HAB_Parse: PRISM packet",
+		"HAB_Parse::parseFixed",
+		"formatFixed",
+		"HAB_Actuator::getTemperature",
+		"HAB_Actuator::isInInterval",
+		"HAB_Thermal::update",
+		"HAB_Thermal::getDuty",
+		"HAB_Actuator::updateHeating",
+		"HAB_Landing::update (descending)",
+		"HAB_Outbox::queue"
+	};
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//The core's millisecond count, set to move time on
+	extern volatile unsigned long timer0_millis;
+
+	//Keeps the results, so the calls are not optimised away
+	static volatile int32_t sink;
+
+	EthernetUDP udp;
+	HAB_Actuator pod("POD_1", 23, 24, 25, A9, 22, A8, fromMetres(12000), fromMetres(20000));
+	HAB_Landing landing;
+	HAB_Outbox outbox(&udp);
+	HAB_Thermal thermal;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static void advance(unsigned long ms){
+		uint8_t oldSREG = SREG;
+		cli();
+		timer0_millis += ms;
+		SREG = oldSREG;
+	}
+
+	static void benchParse(){
+		char packet[80];
+		const char* text = "PRISM,1042,17:21:09,OK,POS0,43.009953,-81.273613,18234.56";
+		HAB_Token field;
+		int32_t value;
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			strcpy(packet, text);
+			BENCH_BEGIN(BENCH_TOKENIZE);
+			HAB_Cursor cursor = HAB_Parse::begin(packet, strlen(packet));
+			while(HAB_Parse::next(cursor, ',', field)){
+				if(HAB_Parse::parseFixed(field, 6, value)){ sink = value; }
+				else{ HAB_Parse::toUpper(field); }
+			}
+			BENCH_END(BENCH_TOKENIZE);
+		}
+
+		char number[] = "-81.273613";
+		HAB_Token token = { number, (uint16_t)strlen(number) };
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			BENCH_BEGIN(BENCH_PARSE_FIXED);
+			HAB_Parse::parseFixed(token, 6, value);
+			BENCH_END(BENCH_PARSE_FIXED);
+			sink = value;
+		}
+
+		char text2[16];
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			BENCH_BEGIN(BENCH_FORMAT_FIXED);
+			formatFixed(text2, (int32_t)i * 7919L - 2000000L, 2);
+			BENCH_END(BENCH_FORMAT_FIXED);
+			sink = text2[0];
+		}
+	}
+
+	static void benchActuator(){
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			BENCH_BEGIN(BENCH_THERMISTOR);
+			sink = pod.getTemperature().value();
+			BENCH_END(BENCH_THERMISTOR);
+		}
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			Centimetres altitude = Centimetres((int32_t)i * 125000L);
+			BENCH_BEGIN(BENCH_INTERVAL);
+			sink = pod.isInInterval(altitude);
+			BENCH_END(BENCH_INTERVAL);
+		}
+
+		//Every call a step boundary, where the model is fitted and the duty chosen
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			advance(THERMAL_STEP);
+			BENCH_BEGIN(BENCH_UPDATE_HEATING);
+			pod.updateHeating(fromCelsius(-20), fromCelsius(-50), true, Centimetres((int32_t)i * 50000L + 900000L),
+				CentimetresPerSecond(500), fromCelsius(-5));
+			BENCH_END(BENCH_UPDATE_HEATING);
+		}
+	}
+
+	static void benchThermal(){
+		float temperature = -20;
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			float duty = (i % 4) / 4.0;
+			BENCH_BEGIN(BENCH_THERMAL_UPDATE);
+			thermal.update(temperature, -50, duty, temperature + 0.3 * duty - 0.1);
+			BENCH_END(BENCH_THERMAL_UPDATE);
+			BENCH_BEGIN(BENCH_THERMAL_DUTY);
+			sink = thermal.getDuty(temperature, -50, -5) * 100;
+			BENCH_END(BENCH_THERMAL_DUTY);
+		}
+	}
+
+	static void benchLanding(){
+		//An ascent through every band, drifting east, for the winds
+		MicroDegrees latitude = fromDegrees(43.009953), longitude = fromDegrees(-81.273613);
+		for(int32_t metres = 250; metres < 30000; metres += 250){
+			advance(1000);
+			longitude += MicroDegrees(120);
+			latitude += MicroDegrees(15);
+			landing.update(fromMetres(metres), CentimetresPerSecond(500), latitude, longitude, fromMetres(250), false);
+		}
+
+		//Each fix on the way down predicts through the bands below it
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			advance(1000);
+			longitude += MicroDegrees(200);
+			BENCH_BEGIN(BENCH_LANDING);
+			landing.update(fromMetres(29000 - (int32_t)i * 40), CentimetresPerSecond(-4000), latitude, longitude, fromMetres(250), true);
+			BENCH_END(BENCH_LANDING);
+			sink = landing.getTimeToLanding();
+		}
+	}
+
+	static void benchOutbox(){
+		//Past what the text buffer holds, so the later ones make room
+		char message[96];
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			strcpy(message, "POD_1 heater 1234 J, duty 45%, tau 1800 s, rise 40 C, event ");
+			utoa(i, message + strlen(message), 10);
+			BENCH_BEGIN(BENCH_OUTBOX_QUEUE);
+			sink = outbox.queue(message, (MessagePriority)(i % MSG_PRIORITY_COUNT));
+			BENCH_END(BENCH_OUTBOX_QUEUE);
+		}
+	}
+
+
+	void setup(){
+		Serial.begin(115200);
+
+		for(uint8_t i = 0; i != BENCH_ITERATIONS; i++){
+			BENCH_BEGIN(BENCH_EMPTY);
+			BENCH_END(BENCH_EMPTY);
+		}
+		benchParse();
+		benchActuator();
+		benchThermal();
+		benchLanding();
+		benchOutbox();
+
+		//Done, simavr stops on a sleep it can't wake from
+		GPIOR2 = sizeof(slotNames) / sizeof(slotNames[0]);
+		cli();
+		sleep_enable();
+		sleep_cpu();
+	}
+
+	void loop(){}
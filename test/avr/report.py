@@ -0,0 +1,129 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : report.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : The ATmega2560 profile: runs the bench firmware under simavr_bench, names its slots from bench.cpp, and
+#                    writes each one's cycles (mean, best and worst, less the empty slot's cost of marking it), its worst
+#                    case in microseconds at 16 MHz and the stack it took, with the sizes of the bench and the flight sketch
+#                    from avr-size and the sketch's largest RAM symbols from avr-nm. Exits 1 if the sketch's static RAM and
+#                    the deepest stack the bench saw, with a margin for the interrupts, don't fit in the board's 8 KB.
+#
+#                    python3 report.py <simavr_bench> <hab_bench.elf> <flight_software.elf> <bench.cpp> <output.json>
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import json
+import os
+import re
+import subprocess
+import sys
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Variables                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+frequency = 16000000 #Hz
+sram = 8192 #bytes
+stack_margin = 512 #bytes left for the interrupts and what the bench doesn't reach
+top_symbols = 15
+
+#The names, in slot order from 1
+slot_names = re.compile(r"slotNames\[\]\s*=\s*\{(?P<names>.*?)\};", re.S)
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Functions                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def readSlotNames(benchName):
+    with open(benchName) as benchFile:
+        match = slot_names.search(benchFile.read())
+    if(match is None): raise SystemExit("FAILED: no slotNames in " + benchName)
+    return re.findall(r'"((?:[^"\\]|\\.)*)"', match.group("names"))
+
+def sectionSizes(elfName):
+    #{section: bytes} from avr-size's System V listing
+    sizes = {}
+    listing = subprocess.run([avrTool("avr-size"), "-A", elfName], check=True, capture_output=True, text=True).stdout
+    for line in listing.splitlines():
+        fields = line.split()
+        if(len(fields) >= 2 and fields[0].startswith(".") and fields[1].isdigit()):
+            sizes[fields[0]] = int(fields[1])
+    return {"text": sizes.get(".text", 0), "data": sizes.get(".data", 0), "bss": sizes.get(".bss", 0),
+        "noinit": sizes.get(".noinit", 0)}
+
+def ramSymbols(elfName):
+    #The largest symbols in .data and .bss, biggest first
+    listing = subprocess.run([avrTool("avr-nm"), "-S", "-C", "--size-sort", "-r", elfName], check=True, capture_output=True,
+        text=True).stdout
+    symbols = []
+    for line in listing.splitlines():
+        fields = line.split(None, 3)
+        if(len(fields) == 4 and fields[2] in "bBdD"):
+            symbols.append({"name": fields[3], "bytes": int(fields[1], 16)})
+    return symbols[:top_symbols]
+
+def avrTool(name):
+    #Beside avr-gcc if the build found it there, otherwise on the path
+    directory = os.environ.get("AVR_BIN", "")
+    return os.path.join(directory, name) if directory else name
+
+def profile(runnerName, benchElf, sketchElf, benchName, outputName):
+    names = readSlotNames(benchName)
+    raw = outputName + ".raw"
+    subprocess.run([runnerName, benchElf, raw], check=True)
+    with open(raw) as rawFile:
+        run = json.load(rawFile)
+    os.remove(raw)
+
+    #Marking a slot costs what the empty one took
+    slots = {slot["slot"]: slot for slot in run["slots"]}
+    overhead = slots[1]["min"] if(1 in slots and slots[1]["calls"]) else 0
+    functions = []
+    for number, name in enumerate(names, 1):
+        slot = slots.get(number)
+        if(slot is None or slot["calls"] == 0 or number == 1): continue
+        worst = max(0, slot["max"] - overhead)
+        functions.append({"name": name, "calls": slot["calls"],
+            "mean_cycles": round(slot["total"] / slot["calls"] - overhead, 1),
+            "min_cycles": max(0, slot["min"] - overhead), "wcet_cycles": worst,
+            "wcet_us": round(worst * 1e6 / frequency, 2), "stack_bytes": slot["stack"]})
+
+    sketch = sectionSizes(sketchElf)
+    deepestStack = run["ramend"] - run["lowest_sp"]
+    staticRam = sketch["data"] + sketch["bss"] + sketch["noinit"]
+    report = {
+        "mcu": run["mcu"], "frequency": frequency, "sram": sram,
+        "functions": functions,
+        "sizes": {"bench": sectionSizes(benchElf), "flight_software": sketch},
+        "flight_software_ram": ramSymbols(sketchElf),
+        "stack": {"deepest_bench": deepestStack, "margin": stack_margin},
+        "ram_free": sram - staticRam - deepestStack - stack_margin
+    }
+    with open(outputName, "w") as outputFile:
+        json.dump(report, outputFile, indent=2)
+
+    print("%-36s %6s %10s %10s %10s %8s" % ("function", "calls", "mean cyc", "WCET cyc", "WCET us", "stack"))
+    for function in functions:
+        print("%-36s %6d %10.1f %10d %10.2f %8d" % (function["name"], function["calls"], function["mean_cycles"],
+            function["wcet_cycles"], function["wcet_us"], function["stack_bytes"]))
+    print("flight_software: .text %d, .data %d, .bss %d bytes; deepest bench stack %d; %d of %d bytes of SRAM left" % (
+        sketch["text"], sketch["data"], sketch["bss"], deepestStack, report["ram_free"], sram))
+    if(report["ram_free"] < 0):
+        print("FAILED: static RAM and stack don't fit in SRAM with a %d byte margin" % stack_margin)
+        return False
+    return True
+
+
+if __name__ == "__main__":
+    if(len(sys.argv) != 6):
+        raise SystemExit("Usage: report.py <simavr_bench> <hab_bench.elf> <flight_software.elf> <bench.cpp> <output.json>")
+    sys.exit(0 if profile(*sys.argv[1:]) else 1)
@@ -0,0 +1,174 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Runs the bench firmware (firmware/bench.cpp) on simavr's ATmega2560 at 16 MHz and
+*				times its slots: the cycles from each write of a slot to GPIOR0 to its write to
+*				GPIOR1, and how far the stack pointer went below where it was at the start. The
+*				peripherals are simavr's own with nothing wired to them, every ADC input reads
+*				half the supply. Writes the slots by number as JSON, report.py names them. Exits
+*				1 if the firmware crashes, runs past its cycle limit, or never reports it is done.
+*
+*				simavr_bench <hab_bench.elf> <output.json>
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <simavr/sim_avr.h>
+	#include <simavr/sim_elf.h>
+	#include <simavr/sim_io.h>
+	#include <simavr/avr_adc.h>
+	#include <stdio.h>
+	#include <stdint.h>
+	#include <string.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//The general purpose I/O registers the firmware marks its slots with, as data addresses
+	#define BENCH_BEGIN_ADDRESS 0x3E //GPIOR0
+	#define BENCH_END_ADDRESS 0x4A //GPIOR1
+	#define BENCH_DONE_ADDRESS 0x4B //GPIOR2
+
+	#define BENCH_SLOTS 256
+	#define BENCH_FREQUENCY 16000000UL
+	#define BENCH_MAX_CYCLES (BENCH_FREQUENCY * 60) //A minute of the board's time
+	#define BENCH_ADC_MILLIVOLTS 2500
+
+	typedef struct {
+		uint32_t calls;
+		uint64_t total, min, max; //cycles
+		uint16_t stack; //bytes, deepest below where the slot began
+	} benchSlot;
+
+	typedef struct {
+		benchSlot slots[BENCH_SLOTS];
+		uint8_t open; //slot being timed, 0 for none
+		uint64_t start; //cycle it began
+		uint16_t startSP, lowestSP; //the slot's
+		uint16_t deepestSP; //the whole run's
+		uint8_t done; //slot count the firmware reported, 0 until it does
+	} benchState;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static uint16_t stackPointer(avr_t* avr){
+		return avr->data[R_SPL] | (avr->data[R_SPH] << 8);
+	}
+
+	static void onBegin(avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param){
+		benchState* state = (benchState*)param;
+		avr->data[addr] = v;
+		state->open = v;
+		state->start = avr->cycle;
+		state->startSP = state->lowestSP = stackPointer(avr);
+	}
+
+	static void onEnd(avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param){
+		benchState* state = (benchState*)param;
+		avr->data[addr] = v;
+		if(state->open == 0 || state->open != v){ return; }
+
+		benchSlot* slot = &state->slots[v];
+		uint64_t cycles = avr->cycle - state->start;
+		uint16_t stack = state->startSP - state->lowestSP;
+		if(slot->calls == 0 || cycles < slot->min){ slot->min = cycles; }
+		if(cycles > slot->max){ slot->max = cycles; }
+		if(stack > slot->stack){ slot->stack = stack; }
+		slot->total += cycles;
+		slot->calls++;
+		state->open = 0;
+	}
+
+	static void onDone(avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param){
+		benchState* state = (benchState*)param;
+		avr->data[addr] = v;
+		state->done = v;
+	}
+
+	static int writeReport(const char* name, const benchState* state, avr_t* avr){
+		FILE* file = fopen(name, "w");
+		if(file == NULL){ return 0; }
+
+		fprintf(file, "{\n  \"mcu\": \"atmega2560\",\n  \"frequency\": %lu,\n  \"cycles\": %llu,\n", BENCH_FREQUENCY,
+			(unsigned long long)avr->cycle);
+		fprintf(file, "  \"ramend\": %u,\n  \"lowest_sp\": %u,\n  \"slots\": [", avr->ramend, state->deepestSP);
+		const char* separator = "\n";
+		for(int i = 1; i <= state->done; i++){
+			const benchSlot* slot = &state->slots[i];
+			fprintf(file, "%s    {\"slot\": %d, \"calls\": %u, \"total\": %llu, \"min\": %llu, \"max\": %llu, \"stack\": %u}",
+				separator, i, slot->calls, (unsigned long long)slot->total, (unsigned long long)slot->min,
+				(unsigned long long)slot->max, slot->stack);
+			separator = ",\n";
+		}
+		fprintf(file, "\n  ]\n}\n");
+		fclose(file);
+		return 1;
+	}
+
+
+	int main(int argc, char** argv){
+		if(argc != 3){
+			fprintf(stderr, "Usage: simavr_bench <hab_bench.elf> <output.json>\n");
+			return 1;
+		}
+
+		elf_firmware_t firmware;
+		memset(&firmware, 0, sizeof(firmware));
+		if(elf_read_firmware(argv[1], &firmware) != 0){
+			fprintf(stderr, "FAILED: can't read %s\n", argv[1]);
+			return 1;
+		}
+		avr_t* avr = avr_make_mcu_by_name("atmega2560");
+		if(avr == NULL){
+			fprintf(stderr, "FAILED: simavr has no atmega2560\n");
+			return 1;
+		}
+		avr_init(avr);
+		firmware.frequency = BENCH_FREQUENCY;
+		avr_load_firmware(avr, &firmware);
+		avr->vcc = avr->avcc = avr->aref = 5000;
+
+		//Each pod's position and thermistor at mid scale
+		for(int i = 0; i != 16; i++){
+			avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC0 + i), BENCH_ADC_MILLIVOLTS);
+		}
+
+		static benchState state;
+		state.deepestSP = avr->ramend;
+		avr_register_io_write(avr, BENCH_BEGIN_ADDRESS, onBegin, &state);
+		avr_register_io_write(avr, BENCH_END_ADDRESS, onEnd, &state);
+		avr_register_io_write(avr, BENCH_DONE_ADDRESS, onDone, &state);
+
+		//An instruction at a time, so the stack pointer is seen at its lowest
+		int run = cpu_Running;
+		while(run != cpu_Done && run != cpu_Crashed && avr->cycle < BENCH_MAX_CYCLES){
+			run = avr_run(avr);
+			uint16_t sp = stackPointer(avr);
+			if(sp < state.deepestSP){ state.deepestSP = sp; }
+			if(state.open != 0 && sp < state.lowestSP){ state.lowestSP = sp; }
+		}
+
+		if(run == cpu_Crashed){
+			fprintf(stderr, "FAILED: the firmware crashed at pc 0x%05x\n", avr->pc);
+			return 1;
+		}
+		if(state.done == 0){
+			fprintf(stderr, "FAILED: the firmware didn't finish in %lu cycles\n", (unsigned long)BENCH_MAX_CYCLES);
+			return 1;
+		}
+		if(!writeReport(argv[2], &state, avr)){
+			fprintf(stderr, "FAILED: can't write %s\n", argv[2]);
+			return 1;
+		}
+		return 0;
+	}
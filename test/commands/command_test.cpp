@@ -0,0 +1,115 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Sends the host build of the sketch commands from the first groundstation and
+*				checks what they do in each mission phase, e.g. that CALIBRATE only runs on the
+*				pad, that the startup report reaches the ground uncut, that SEQ_ADD only takes
+*				numbers, that telemetry isn't slowed for a groundstation that doesn't answer
+*				pings, and that a halted pod's science burst ends. Exits 1 on the first check
+*				that fails.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Sketch.h>
+	#include <string>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Everything the board sent, as one string
+	static std::string sent;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static void capture(const hostDatagram& datagram){
+		sent.append((const char*)datagram.data, datagram.length);
+	}
+
+	static bool check(bool condition, const char* what){
+		if(!condition){ printf("FAILED: %s\n", what); }
+		return condition;
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		command																	|
+	|	Purpose: 	Sends a command as the groundstation does, and returns whether the		|
+	|				board answered that it was executed.									|
+	|	Arguments:	const char*																|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		static bool command(const char* text){
+			std::string packet = std::string(GROUNDSTATION_NAME) + FIELD_DELIMITER + text;
+			HAB_Host::sendToBoard(IPAddress(GS1_IP_O1, GS1_IP_O2, GS1_IP_O3, GS1_IP_O4), GS1_PORT, LOCAL_PORT, packet.c_str(), packet.size());
+			sent.clear();
+			recievePacketsUDP();
+			_outbox->flushAll();
+			return sent.find("Command executed!") != std::string::npos;
+		}
+
+
+	int main(){
+		HAB_Host::setNetworkHook(capture);
+		setup();
+		bool passed = check(_phase->getPhase() == PHASE_PRELAUNCH, "starts on the pad");
+
+		//Replies only go out once the groundstation is heard from
+		command("HBT");
+		passed &= check(!noConnection, "connected");
+
+		//A groundstation that only heartbeats, and never answers pings, keeps the starting telemetry rate
+		for(uint8_t i = 0; i != 20; i++){
+			HAB_Host::spend(LINK_PING_INTERVAL * 1000UL);
+			_link->update();
+		}
+		passed &= check(_link->getInterval() == LINK_START_INTERVAL, "telemetry rate kept without pongs");
+		command("HBT");
+
+		//On the pad a pod is calibrated
+		passed &= check(command("CALIBRATE POD_1") && _calibration->isRunning(), "CALIBRATE runs on the pad");
+		passed &= check(command("CAL_CANCEL") && !_calibration->isRunning(), "CAL_CANCEL stops it");
+
+		//The startup report goes out whole, every check on one line
+		char report[200];
+		command("STARTUP_REPORT");
+		_startup->getReport(report, sizeof(report));
+		passed &= check(strlen(report) > 60 && sent.find(report) != std::string::npos, "STARTUP_REPORT sent uncut");
+
+		//Once launched it is refused, for one pod or all
+		_phase->set(PHASE_ASCENT);
+		passed &= check(!command("CALIBRATE POD_1") && !_calibration->isRunning(), "CALIBRATE refused in ascent");
+		passed &= check(!command("CALIBRATE ALL") && !_calibration->isRunning(), "CALIBRATE ALL refused in ascent");
+		_phase->set(PHASE_DESCENT);
+		passed &= check(!command("CALIBRATE POD_2") && !_calibration->isRunning(), "CALIBRATE refused in descent");
+
+		//A sequence entry's up-time has to be a number
+		passed &= check(!command("SEQ_ADD - abc OVR_ACT_HALT"), "SEQ_ADD refuses a time that isn't a number");
+		passed &= check(!command("SEQ_ADD - 12x OVR_ACT_HALT"), "SEQ_ADD refuses a time with junk after it");
+		passed &= check(command("SEQ_ADD - 3600 OVR_ACT_HALT"), "SEQ_ADD takes a time in seconds");
+		command("SEQ_CLEAR");
+
+		//A pod's science burst runs while it is held open, and ends when it is halted
+		_phase->set(PHASE_ASCENT);
+		command("SET_ACTIVE POD_1");
+		command("ACT_DISABLE_LOCK");
+		passed &= check(command("OVR_ACT_OPEN") && _actArray[activeIndex].isActuatorOverrideOpen(), "OVR_ACT_OPEN overrides open");
+		_burst->start(_actArray[activeIndex].getName());
+		loop();
+		passed &= check(_burst->isActive(), "burst runs while the pod is held open");
+		passed &= check(command("OVR_ACT_HALT"), "OVR_ACT_HALT");
+		loop();
+		passed &= check(!_burst->isActive(), "burst ends when the pod is halted");
+
+		if(passed){ printf("Commands: all checks passed\n"); }
+		return (passed ? 0 : 1);
+	}
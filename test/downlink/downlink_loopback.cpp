@@ -0,0 +1,109 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The board's end of the downlink loopback test. Loads an image into the SD card,
+*				sends it with HAB_Downlink over real UDP sockets on the loopback address, and takes
+*				the ground's IMG_NACK and IMG_ACK commands the way the sketch does.
+*
+*				downlink_loopback <image file> <name on the card> <board port> <ground port> [timeout ms]
+*				Exits 0 once the ground acknowledges the image.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <Arduino.h>
+	#include <SD.h>
+	#include <Ethernet.h>
+	#include <HAB_Downlink.h>
+	#include <vector>
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		handleCommand															|
+	|	Purpose: 	IMG_NACK <id> <first>[-<last>] and IMG_ACK <id>, with or without the	|
+	|				ground station prefix.													|
+	|	Arguments:	HAB_Downlink&, char*													|
+	|	Returns:	bool (true once acknowledged)											|
+	\*-------------------------------------------------------------------------------------*/
+		static bool handleCommand(HAB_Downlink& downlink, char* command){
+			if(!strncmp(command, "GROUNDSTATION,", 14)){ command += 14; }
+
+			char* name = strtok(command, " ");
+			char* id = strtok(NULL, " ");
+			char* range = strtok(NULL, " ");
+			if(!name || !id){ return false; }
+
+			if(!strcmp(name, "IMG_NACK") && range){
+				char* dash = strchr(range, '-');
+				uint16_t first = atoi(range);
+				uint16_t last = (dash ? atoi(dash + 1) : first);
+				if(!downlink.handleNack(atoi(id), first, last)){ printf("Rejected IMG_NACK %s %s\n", id, range); }
+				return false;
+			}
+			if(!strcmp(name, "IMG_ACK")){ return downlink.handleAck(atoi(id)); }
+			return false;
+		}
+
+
+	int main(int argc, char** argv){
+		if(argc < 5){
+			fprintf(stderr, "Usage: %s <image file> <name on the card> <board port> <ground port> [timeout ms]\n", argv[0]);
+			return 2;
+		}
+		unsigned long timeout = (argc > 5 ? strtoul(argv[5], NULL, 10) : 20000);
+
+		//Loads the image onto the card
+		FILE* image = fopen(argv[1], "rb");
+		if(!image){
+			perror(argv[1]);
+			return 2;
+		}
+		std::vector<uint8_t> data;
+		int b;
+		while((b = fgetc(image)) != EOF){ data.push_back(b); }
+		fclose(image);
+		HAB_Host::writeFile(argv[2], data.data(), data.size());
+
+		//Real time and real sockets, the ground end is another process
+		HAB_Host::setRealTime(true);
+		HAB_Host::setSockets(true);
+		SD.begin(4);
+
+		EthernetUDP conn;
+		if(!conn.begin(atoi(argv[3]))){
+			fprintf(stderr, "Could not bind port %s\n", argv[3]);
+			return 2;
+		}
+		HAB_Downlink downlink(&conn);
+		downlink.addDestination(IPAddress(127, 0, 0, 1), atoi(argv[4]));
+		downlink.setRate(8192);
+		if(!downlink.startImage(argv[2])){ return 1; }
+
+		//The sketch's loop, cut down to the downlink
+		char command[300]; //As HAB_Definitions sizes the sketch's
+		unsigned long start = millis();
+		while(millis() - start < timeout){
+			downlink.update();
+			while(conn.parsePacket()){
+				int length = conn.read(command, sizeof(command) - 1);
+				if(length <= 0){ continue; }
+				command[length] = '\0';
+				if(handleCommand(downlink, command)){
+					printf("Acknowledged: %lu chunks sent, %lu resent\n", (unsigned long)downlink.getChunksSent(), (unsigned long)downlink.getChunksResent());
+					return 0;
+				}
+			}
+			delay(1);
+		}
+
+		printf("Timed out: %u chunks pending, %lu sent, %lu resent\n", downlink.getPendingCount(), (unsigned long)downlink.getChunksSent(), (unsigned long)downlink.getChunksResent());
+		return 1;
+	}
@@ -0,0 +1,130 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : test_downlink.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : Sends an image from HAB_Downlink (built for the host as downlink_loopback) to the groundstation's
+#                    ImageAssembler over UDP on the loopback address, dropping chunks so the NACK resume is exercised.
+#                    Run by ctest, which sets HAB_DOWNLINK_LOOPBACK to the board program.
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import os
+import random
+import socket
+import subprocess
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+from image_downlink import ImageAssembler
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Functions                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def freePort():
+    probe = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    probe.bind(("127.0.0.1", 0))
+    port = probe.getsockname()[1]
+    probe.close()
+    return port
+
+def downlink(data, name, directory, dropChunk=lambda chunk: False):
+    #Runs the board end, and plays the groundstation until it exits. The first copy of each chunk dropChunk picks is lost.
+    with tempfile.NamedTemporaryFile(delete=False) as imageFile:
+        imageFile.write(data)
+    ground = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    ground.bind(("127.0.0.1", 0))
+    ground.settimeout(0.2)
+    boardPort = freePort()
+
+    def sendCommand(command):
+        ground.sendto(bytes("GROUNDSTATION," + command, "utf-8"), ("127.0.0.1", boardPort))
+
+    assembler = ImageAssembler(sendCommand, directory)
+    board = subprocess.Popen([os.environ["HAB_DOWNLINK_LOOPBACK"], imageFile.name, name, str(boardPort), str(ground.getsockname()[1])],
+                             stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    seen = set()
+    dropped = 0
+    saved = None
+    try:
+        while(board.poll() is None):
+            try:
+                packet = ground.recv(2048)
+            except socket.timeout:
+                continue
+            if(packet.startswith(b"[IMAGE]")):
+                chunk = int(packet[len(b"[IMAGE]"):].split(b",", 3)[1])
+                if(chunk not in seen and dropChunk(chunk)):
+                    seen.add(chunk)
+                    dropped += 1
+                    continue
+                seen.add(chunk)
+                assembler.handle_chunk(packet)
+            elif(packet.startswith(b"[IMGEND]")):
+                saved = assembler.handle_end(packet.decode("utf-8", "replace")) or saved
+        output = board.communicate(timeout=30)[0].decode("utf-8", "replace")
+    finally:
+        if(board.poll() is None):
+            board.kill()
+        ground.close()
+        os.unlink(imageFile.name)
+    return board.returncode, output, saved, dropped
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                     Tests                                                 |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+@unittest.skipUnless(os.environ.get("HAB_DOWNLINK_LOOPBACK"), "needs the downlink_loopback program")
+class DownlinkLoopbackTest(unittest.TestCase):
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        self.images = os.path.join(self.directory.name, "images")
+        self.data = bytes(random.Random(2026).getrandbits(8) for _ in range(10000))
+
+    def tearDown(self):
+        self.directory.cleanup()
+
+    def test_resumes_dropped_chunks(self):
+        code, output, saved, dropped = downlink(self.data, "IMG001.JPG", self.images, lambda chunk: chunk % 5 == 2)
+        self.assertEqual(code, 0, output)
+        self.assertGreater(dropped, 0)
+        self.assertIn("resent", output)
+        self.assertNotIn(" 0 resent", output)
+        self.assertEqual(saved, os.path.join(self.images, "IMG001.JPG"))
+        with open(saved, "rb") as imageFile:
+            self.assertEqual(imageFile.read(), self.data)
+
+    def test_name_stays_in_directory(self):
+        code, output, saved, dropped = downlink(self.data, "../x/../evil.jpg", self.images)
+        self.assertEqual(code, 0, output)
+        self.assertEqual(saved, os.path.join(self.images, "evil.jpg"))
+        self.assertEqual(os.listdir(self.directory.name), ["images"])
+        with open(saved, "rb") as imageFile:
+            self.assertEqual(imageFile.read(), self.data)
+
+
+class ImageNameTest(unittest.TestCase):
+    def test_rejects_unusable_names(self):
+        with tempfile.TemporaryDirectory() as directory:
+            for name in ("", ".", "..", "images/..", "..\\.."):
+                commands = []
+                assembler = ImageAssembler(commands.append, directory)
+                assembler.handle_chunk(b"[IMAGE]1,0,1,data")
+                self.assertIsNone(assembler.handle_end("[IMGEND]1,1,4," + name))
+                self.assertEqual(commands, [])
+            self.assertEqual(os.listdir(directory), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,124 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Cycles and time per call of the fixed point paths against the float code they
+*				replaced: the thermistor table against the B equation, the interval check,
+*				formatFixed against dtostrf, and parseFixed against atof. These are the host's
+*				cycles (the time stamp counter on x86), which has an FPU, so they show the
+*				fixed point paths are no slower; the AVR, with float in software, widens the gap.
+*
+*				fixed_bench [iterations]
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Fixed.h>
+	#include <HAB_Actuator.h>
+	#include <HAB_Parse.h>
+	#include <math.h>
+	#include <chrono>
+	#if defined(__x86_64__) || defined(__i386__)
+		#include <x86intrin.h>
+	#endif
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Keeps the results, so the loops are not optimised away
+	static volatile int32_t sink;
+	static volatile double floatSink;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static uint64_t cycles(){
+		#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+		#else
+			return 0;
+		#endif
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		bench																	|
+	|	Purpose: 	Runs a case the given number of times and prints its cycles and time	|
+	|				per call.																|
+	|	Arguments:	char*, uint32_t, function												|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		template <typename Case>
+		static void bench(const char* name, uint32_t iterations, Case run){
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			uint64_t startCycles = cycles();
+			for(uint32_t i = 0; i != iterations; i++){ run(i); }
+			uint64_t spent = cycles() - startCycles;
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			printf("%-36s %8.1f cycles %8.1f ns\n", name, (double)spent / iterations, seconds * 1e9 / iterations);
+		}
+
+
+	int main(int argc, char** argv){
+		uint32_t iterations = (argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000);
+		HAB_Actuator pod("POD_1", 23, 24, 25, A9, 22, A8, fromMetres(12000), fromMetres(20000));
+
+		//----------------------------------------------------------\
+		//Thermistor------------------------------------------------|
+			bench("thermistor: table", iterations, [&](uint32_t i){
+				HAB_Host::setAnalog(A8, 100 + i % 800);
+				sink = pod.getTemperature().value();
+			});
+			bench("thermistor: B equation (float)", iterations, [&](uint32_t i){
+				HAB_Host::setAnalog(A8, 100 + i % 800);
+				float reading = analogRead(A8);
+				reading = SERIESRESISTOR / (1023 / reading - 1);
+				float inverse = log(reading / THERMISTORNOMINAL) / BCOEFFICIENT + 1.0 / (TEMPERATURENOMINAL + 273.15);
+				floatSink = 1.0 / inverse - 273.15;
+			});
+
+		//----------------------------------------------------------\
+		//Interval check--------------------------------------------|
+			bench("interval: Centimetres", iterations, [&](uint32_t i){
+				sink = pod.isInInterval(Centimetres((int32_t)(i * 4099) % 4000000));
+			});
+			volatile float openAlt = 12000, closeAlt = 20000;
+			bench("interval: float metres", iterations, [&](uint32_t i){
+				float altitude = (float)((int32_t)(i * 4099) % 4000000) / 100;
+				sink = (altitude >= openAlt && altitude < closeAlt);
+			});
+
+		//----------------------------------------------------------\
+		//Formatting------------------------------------------------|
+			char text[32];
+			bench("format: formatFixed", iterations, [&](uint32_t i){
+				formatFixed(text, (int32_t)(i * 7919) - 2000000, 2);
+				sink = text[0];
+			});
+			bench("format: dtostrf", iterations, [&](uint32_t i){
+				dtostrf(((int32_t)(i * 7919) - 2000000) / 100.0f, 1, 2, text);
+				sink = text[0];
+			});
+
+		//----------------------------------------------------------\
+		//Parsing---------------------------------------------------|
+			char field[] = "-81.273613";
+			HAB_Token token = { field, (uint16_t)strlen(field) };
+			int32_t value;
+			bench("parse: parseFixed", iterations, [&](uint32_t i){
+				HAB_Parse::parseFixed(token, 6, value);
+				sink = value;
+			});
+			bench("parse: atof", iterations, [&](uint32_t i){
+				floatSink = atof(field);
+			});
+
+		return 0;
+	}
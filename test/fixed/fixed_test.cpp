@@ -0,0 +1,203 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Property checks of the fixed point readings against the floating point they
+*				replaced: the thermistor table against the B equation, the rounding of the
+*				constant conversions, formatFixed against printf, HAB_Parse::parseFixed against
+*				strtod, the interval checks against float altitudes, and the BME280 driver's
+*				integer compensation against the air it was given. Random cases are drawn from a
+*				fixed seed. Exits 1 if any property fails.
+*
+*				fixed_test [cases]
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Fixed.h>
+	#include <HAB_Actuator.h>
+	#include <HAB_BME280.h>
+	#include <HAB_Parse.h>
+	#include <float.h>
+	#include <math.h>
+	#include <random>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	static std::mt19937 rng(2026);
+	static uint8_t failures = 0;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static double uniform(double low, double high){
+		return std::uniform_real_distribution<double>(low, high)(rng);
+	}
+
+	//Reports a property, with its worst case
+	static void property(const char* name, bool held, const char* worst){
+		printf("%-48s %-6s %s\n", name, (held ? "ok" : "FAILED"), worst);
+		if(!held){ failures++; }
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		bEquation																|
+	|	Purpose: 	The float thermistor formula getTemperature used before the table (C).	|
+	|	Arguments:	uint16_t (ADC reading)													|
+	|	Returns:	double																	|
+	\*-------------------------------------------------------------------------------------*/
+		static double bEquation(uint16_t reading){
+			double resistance = SERIESRESISTOR / (1023.0 / reading - 1);
+			double inverse = log(resistance / THERMISTORNOMINAL) / BCOEFFICIENT + 1.0 / (TEMPERATURENOMINAL + 273.15);
+			return 1.0 / inverse - 273.15;
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Properties----------------------------------------------------------------------|
+
+		static void checkThermistor(){
+			HAB_Actuator pod("POD_1", 23, 24, 25, A9, 22, A8, fromMetres(2000), fromMetres(10000));
+			double worst = 0;
+			uint16_t worstReading = 0;
+			bool monotonic = true;
+			int16_t last = 32767;
+			for(uint16_t reading = 1; reading != 1023; reading++){
+				HAB_Host::setAnalog(A8, reading);
+				int16_t fixed = pod.getTemperature().value();
+				monotonic = monotonic && fixed <= last;
+				last = fixed;
+
+				double exact = bEquation(reading);
+				if(exact < -40 || exact > 60){ continue; }
+				if(fabs(fixed / 100.0 - exact) > worst){
+					worst = fabs(fixed / 100.0 - exact);
+					worstReading = reading;
+				}
+			}
+			char text[64];
+			snprintf(text, sizeof(text), "worst %.3f C at ADC %u", worst, worstReading);
+			property("thermistor table within 0.15 C of B (-40..60 C)", worst <= 0.15, text);
+			property("thermistor table falls as the reading rises", monotonic, "");
+		}
+
+		static void checkRounding(uint32_t cases){
+			bool held = true;
+			double worst = 0;
+			for(uint32_t i = 0; i != cases; i++){
+				double metres = uniform(-1000, 40000), celsius = uniform(-80, 80), degrees = uniform(-180, 180);
+				held = held && fromMetres(metres).value() == lround(metres * 100);
+				held = held && fromCelsius(celsius).value() == lround(celsius * 100);
+				held = held && fromDegrees(degrees).value() == lround(degrees * 1000000);
+
+				//Half a step, and what a float can't hold of it
+				worst = fmax(worst, fabs(toFloat(fromMetres(metres)) - metres) / (0.005 + fabs(metres) * FLT_EPSILON));
+			}
+			char text[64];
+			snprintf(text, sizeof(text), "toFloat(fromMetres) within %.2f of its bound", worst);
+			property("from* round to the nearest step", held && worst <= 1, text);
+		}
+
+		static void checkFormat(uint32_t cases){
+			char fixed[16], reference[32];
+			bool held = true;
+			for(uint32_t i = 0; i != cases && held; i++){
+				int32_t value = (int32_t)rng();
+				if(i % 4 == 0){ value %= 100000; } //Small values, to hit the leading zeros
+				uint8_t decimals = i % 7;
+				snprintf(reference, sizeof(reference), "%.*f", decimals, value / pow(10, decimals));
+				formatFixed(fixed, value, decimals);
+				if(strcmp(fixed, reference) && !(value < 0 && !strcmp(fixed + 1, reference))){ //printf may drop the sign of -0.00
+					printf("  %d with %u decimals: %s, printf %s\n", value, decimals, fixed, reference);
+					held = false;
+				}
+			}
+			property("formatFixed matches printf", held, "");
+		}
+
+		static void checkParse(uint32_t cases){
+			char text[32];
+			bool held = true;
+			for(uint32_t i = 0; i != cases && held; i++){
+				uint8_t decimals = i % 7, digits = rng() % 9;
+				double number = uniform(-2000, 2000);
+				snprintf(text, sizeof(text), "%.*f", digits, number);
+				HAB_Token token = { text, (uint16_t)strlen(text) };
+				int32_t value;
+				double exact = strtod(text, NULL) * pow(10, decimals);
+				//Extra digits are dropped, so it is within a step of the float (towards zero)
+				if(!HAB_Parse::parseFixed(token, decimals, value) || fabs(value - exact) >= 1 + 1e-6 * fabs(exact)
+					|| (exact > 0 && value > exact + 1e-6) || (exact < 0 && value < exact - 1e-6)){
+					printf("  \"%s\" with %u decimals: %d\n", text, decimals, value);
+					held = false;
+				}
+			}
+			property("parseFixed within a step of strtod", held, "");
+		}
+
+		static void checkInterval(uint32_t cases){
+			uint32_t checked = 0;
+			bool held = true;
+			for(uint32_t i = 0; i != cases && held; i++){
+				double open = uniform(0, 30000), close = open + uniform(1000, 10000), altitude = uniform(-500, 42000);
+				HAB_Actuator pod("POD_1", 23, 24, 25, A9, 22, A8, fromMetres(open), fromMetres(close));
+
+				//Altitudes within the rounding of an edge can go either way
+				if(fabs(altitude - open) < 0.01 || fabs(altitude - close) < 0.01){ continue; }
+				checked++;
+				if(pod.isInInterval(fromMetres(altitude)) != (altitude >= open && altitude < close)){
+					printf("  %.3f m in [%.3f, %.3f)\n", altitude, open, close);
+					held = false;
+				}
+			}
+			char text[64];
+			snprintf(text, sizeof(text), "%u altitudes", checked);
+			property("isInInterval matches float altitudes", held, text);
+		}
+
+		static void checkBME(uint32_t cases){
+			HAB_BME280 bme;
+			bool held = bme.begin() && bme.setSampling(1, 1, 1, 0);
+			double worstT = 0, worstP = 0, worstH = 0;
+			for(uint32_t i = 0; i != cases && held; i++){
+				hostEnvironment& air = HAB_Host::getEnvironment();
+				//Within the sensor's specified range, it reads nonsense below 300 hPa
+				air.temperature = uniform(-40, 40);
+				air.pressure = uniform(30000, 110000);
+				air.humidity = uniform(0, 100);
+				if(!bme.start()){ held = false; break; }
+				delay(bme.getConversionTime() + 1);
+				if(!bme.poll()){ held = false; break; }
+
+				//As the sketch takes them: hundredths of a degree, Pa from Q24.8, hundredths of a percent from Q22.10
+				worstT = fmax(worstT, fabs(bme.getTemperature() / 100.0 - air.temperature));
+				worstP = fmax(worstP, fabs(((bme.getPressure() + 128) >> 8) - air.pressure));
+				worstH = fmax(worstH, fabs(((bme.getHumidity() * 100 + 512) >> 10) / 100.0 - air.humidity));
+			}
+			char text[96];
+			snprintf(text, sizeof(text), "worst %.3f C, %.1f Pa, %.3f %%", worstT, worstP, worstH);
+			property("BME280 integer compensation matches the air", held && worstT <= 0.011 && worstP <= 1.5 && worstH <= 0.02, text);
+		}
+
+
+	int main(int argc, char** argv){
+		uint32_t cases = (argc > 1 ? strtoul(argv[1], NULL, 10) : 100000);
+
+		checkThermistor();
+		checkRounding(cases);
+		checkFormat(cases);
+		checkParse(cases);
+		checkInterval(cases);
+		checkBME(cases / 100);
+
+		return (failures ? 1 : 0);
+	}
@@ -0,0 +1,232 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Replays a flight's datalog.txt through HAB_Phase and HAB_Landing as the sketch feeds
+*				them: each row's fix at its time on the simulated clock, with the sketch's smoothed
+*				climb rate. Every prediction made on the way down is scored against where the
+*				track really came down: how far off it was, whether the landing was inside its
+*				error ellipse, and its time to landing. Tracks are in tracks/ (see make_track.py).
+*				Exits 1 if a track never gets a prediction, or the predictions miss by more than
+*				their errors allow.
+*
+*				landing_replay <datalog.txt>...
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Landing.h>
+	#include <HAB_Phase.h>
+	#include <HAB_Definitions.h>
+	#include <math.h>
+	#include <vector>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//A row of the log, what the landing prediction is given
+	struct trackFix {
+		uint32_t time; //s of uptime
+		Centimetres altitude;
+		MicroDegrees latitude;
+		MicroDegrees longitude;
+	};
+
+	//A prediction, against the landing
+	struct scoredPrediction {
+		float altitude; //m it was made at
+		float east, north; //m it missed by
+		float errorEast, errorNorth; //m, 1 sigma
+		float timeToLanding; //s predicted
+		float actualTime; //s it really took
+	};
+
+	//Share of predictions from the descent whose ellipse has to hold the landing, at 2 sigma. The
+	//errors are a sigma each way, so 86% of them would if they were exactly right.
+	#define REPLAY_MIN_WITHIN 0.7
+	//Furthest the last prediction above the final kilometre may be off
+	#define REPLAY_FINAL_MISS 2000 //m
+
+	#define METRES_PER_MICRODEGREE 0.111319 //As HAB_Landing has it
+
+	static const float checkpoints[] = { 25000, 20000, 15000, 10000, 7500, 5000, 3000, 2000, 1000 };
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		readTrack																|
+	|	Purpose: 	Reads a datalog.txt, finding its columns by the header writeToExcel		|
+	|				gives it. Returns false if it can't be read.							|
+	|	Arguments:	const char*, std::vector<trackFix>&										|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		static bool readTrack(const char* name, std::vector<trackFix>& track){
+			FILE* file = fopen(name, "r");
+			if(file == NULL){ return false; }
+
+			char line[1024];
+			int8_t timeColumn = -1, altitudeColumn = -1, latitudeColumn = -1, longitudeColumn = -1;
+			if(fgets(line, sizeof(line), file)){
+				int8_t column = 0;
+				for(char* field = strtok(line, ",\r\n"); field != NULL; field = strtok(NULL, ",\r\n"), column++){
+					if(!strcmp(field, "Time(s)")){ timeColumn = column; }
+					else if(!strcmp(field, "Altitude(m)")){ altitudeColumn = column; }
+					else if(!strcmp(field, "Latitude(deg)")){ latitudeColumn = column; }
+					else if(!strcmp(field, "Longitude(deg)")){ longitudeColumn = column; }
+				}
+			}
+			if(timeColumn < 0 || altitudeColumn < 0 || latitudeColumn < 0 || longitudeColumn < 0){
+				fclose(file);
+				return false;
+			}
+
+			while(fgets(line, sizeof(line), file)){
+				trackFix fix;
+				uint8_t found = 0;
+				int8_t column = 0;
+				for(char* field = strtok(line, ",\r\n"); field != NULL; field = strtok(NULL, ",\r\n"), column++){
+					unsigned hours, minutes, seconds;
+					if(column == timeColumn && sscanf(field, "%u:%u:%u", &hours, &minutes, &seconds) == 3){
+						fix.time = hours * 3600 + minutes * 60 + seconds;
+						found++;
+					}
+					else if(column == altitudeColumn){ fix.altitude = fromMetres(atof(field)); found++; }
+					else if(column == latitudeColumn){ fix.latitude = fromDegrees(atof(field)); found++; }
+					else if(column == longitudeColumn){ fix.longitude = fromDegrees(atof(field)); found++; }
+				}
+				if(found == 4){ track.push_back(fix); }
+			}
+			fclose(file);
+			return !track.empty();
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		replay																	|
+	|	Purpose: 	Flies a track through the phase and the prediction, and scores each		|
+	|				prediction made while descending against the track's last fix.			|
+	|	Arguments:	const std::vector<trackFix>&, std::vector<scoredPrediction>&			|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void replay(const std::vector<trackFix>& track, std::vector<scoredPrediction>& scored){
+			HAB_Phase phase(fromMetres(STOP_ALTITUDE));
+			HAB_Landing landing;
+			CentimetresPerSecond climbRate;
+			Centimetres lastAltitude;
+			unsigned long lastTime = 0;
+
+			//Came down at the first fix near where it ended up
+			const trackFix& end = track.back();
+			uint32_t landingTime = end.time;
+			size_t peak = 0;
+			for(size_t i = 0; i != track.size(); i++){
+				if(track[i].altitude > track[peak].altitude){ peak = i; }
+			}
+			for(size_t i = peak; i != track.size(); i++){
+				if(track[i].altitude < end.altitude + fromMetres(30)){
+					landingTime = track[i].time;
+					break;
+				}
+			}
+			float metresPerLongitude = METRES_PER_MICRODEGREE * cos(toFloat(end.latitude) * DEG_TO_RAD);
+
+			unsigned long start = millis();
+			for(const trackFix& fix : track){
+				unsigned long due = start + (fix.time - track[0].time) * 1000UL;
+				if(due > millis()){ delay(due - millis()); }
+
+				//As the readings block does it
+				unsigned long now = millis();
+				if(lastTime != 0){
+					int32_t climb = (fix.altitude - lastAltitude).value() * 1000 / (int32_t)(now - lastTime);
+					climbRate = CentimetresPerSecond(climbRate.value() + (climb - climbRate.value()) / 4);
+				}
+				lastAltitude = fix.altitude;
+				lastTime = now;
+				phase.update(fix.altitude, climbRate, false);
+				landing.update(fix.altitude, climbRate, fix.latitude, fix.longitude, phase.getPadAltitude(), phase.getPhase() == PHASE_DESCENT);
+
+				if(phase.getPhase() == PHASE_DESCENT && landing.hasPrediction() && fix.time < landingTime){
+					scoredPrediction prediction;
+					prediction.altitude = toFloat(fix.altitude);
+					prediction.east = (landing.getLongitude() - end.longitude).value() * metresPerLongitude;
+					prediction.north = (landing.getLatitude() - end.latitude).value() * METRES_PER_MICRODEGREE;
+					prediction.errorEast = max(landing.getErrorEast(), (uint16_t)1);
+					prediction.errorNorth = max(landing.getErrorNorth(), (uint16_t)1);
+					prediction.timeToLanding = landing.getTimeToLanding();
+					prediction.actualTime = landingTime - fix.time;
+					scored.push_back(prediction);
+				}
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		report																	|
+	|	Purpose: 	Prints a track's predictions as it passed each checkpoint, and how		|
+	|				they did through the whole descent. Returns false if they failed.		|
+	|	Arguments:	const char*, const std::vector<scoredPrediction>&						|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		static bool report(const char* name, const std::vector<scoredPrediction>& scored){
+			printf("%s\n", name);
+			if(scored.empty()){
+				printf("  FAILED: no prediction while descending\n\n");
+				return false;
+			}
+
+			printf("  %9s %9s %9s %9s %9s %9s %10s %10s\n", "alt m", "miss m", "east m", "north m", "sigma E", "sigma N", "predict s", "actual s");
+			uint8_t next = 0;
+			const uint8_t checkpointCount = sizeof(checkpoints) / sizeof(checkpoints[0]);
+			uint32_t within = 0;
+			float finalMiss = -1;
+			for(const scoredPrediction& prediction : scored){
+				float miss = hypot(prediction.east, prediction.north);
+				float normalised = hypot(prediction.east / prediction.errorEast, prediction.north / prediction.errorNorth);
+				if(normalised <= 2){ within++; }
+				if(prediction.altitude > 1000){ finalMiss = miss; }
+
+				//The first prediction below each checkpoint
+				if(next != checkpointCount && prediction.altitude <= checkpoints[next]){
+					printf("  %9.0f %9.0f %9.0f %9.0f %9.0f %9.0f %10.0f %10.0f\n", prediction.altitude, miss, prediction.east,
+						prediction.north, prediction.errorEast, prediction.errorNorth, prediction.timeToLanding, prediction.actualTime);
+					while(next != checkpointCount && prediction.altitude <= checkpoints[next]){ next++; }
+				}
+			}
+
+			float share = (float)within / scored.size();
+			printf("  %u predictions, %.0f%% with the landing inside 2 sigma, %.0f m off above the last km\n\n", (unsigned)scored.size(),
+				share * 100, finalMiss);
+			bool passed = share >= REPLAY_MIN_WITHIN && finalMiss >= 0 && finalMiss <= REPLAY_FINAL_MISS;
+			if(!passed){ printf("  FAILED: the predictions missed by more than their errors allow\n\n"); }
+			return passed;
+		}
+
+
+	int main(int argc, char** argv){
+		if(argc < 2){
+			printf("Usage: landing_replay <datalog.txt>...\n");
+			return 1;
+		}
+
+		bool passed = true;
+		for(int i = 1; i != argc; i++){
+			std::vector<trackFix> track;
+			if(!readTrack(argv[i], track)){
+				printf("FAILED: can't read %s\n", argv[i]);
+				passed = false;
+				continue;
+			}
+			std::vector<scoredPrediction> scored;
+			replay(track, scored);
+			passed &= report(argv[i], scored);
+		}
+		return (passed ? 0 : 1);
+	}
@@ -0,0 +1,138 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : make_track.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : Writes a synthetic flight as the board's datalog.txt, for landing_replay until a recorded flight's log is
+#                    added beside it. It is not a recording: the winds are a made up profile (a jet stream over London,
+#                    turning above it, and drifting on through the flight) with gusts, the climb and the parachute descent
+#                    follow simple models, and the GPS fixes have noise. The rows are thinned to every 5 s (the board logs
+#                    every second in flight) to keep the file small. A fixed seed makes the same track every run.
+#
+#                    python3 make_track.py [output]
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import math
+import os
+import random
+import sys
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Variables                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+track_directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tracks")
+
+#Flight
+launch_latitude = 43.009953
+launch_longitude = -81.273613
+ground = 250.0 #m
+pad_time = 600 #s on the pad, after the board has started
+start_uptime = 60 #s the board has been up when logging starts
+climb_rate = 5.0 #m/s
+burst_altitude = 30000.0 #m
+descent_rate = 5.2 #m/s at sea level, the parachute's
+density_scale = 7500.0 #m, the descent speeds up with the thinner air
+row_step = 5 #s between rows
+
+#Noise
+gust_sigma = 1.5 #m/s
+gust_time = 60.0 #s the gusts are correlated over
+wind_drift = 3.0 #m/s the winds have moved on by the end of the flight
+gps_horizontal = 3.0 #m
+gps_vertical = 5.0 #m
+
+metres_per_degree = 111320.0
+pod_count = 4
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Functions                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def wind(altitude, flightTime):
+    #(east, north) m/s, a westerly jet at the tropopause, light easterlies above 22 km, drifting through the flight
+    east = 6 + 28 * math.exp(-((altitude - 11000) / 4000.0) ** 2)
+    if(altitude > 22000): east -= 12 * min(1.0, (altitude - 22000) / 6000.0)
+    north = 4 * math.sin(altitude / 6000.0) - 2
+    drift = wind_drift * flightTime / 9000.0
+    return east + drift, north + 0.5 * drift
+
+def standardAtmosphere(altitude):
+    #(C, Pa)
+    if(altitude < 11000):
+        temperature = 15 - 6.5 * altitude / 1000
+        pressure = 101325 * (1 - 2.25577e-5 * altitude) ** 5.25588
+    else:
+        temperature = -56.5 + max(0.0, altitude - 20000) / 1000
+        pressure = 22632 * math.exp(-(altitude - 11000) / 6341.6)
+    return temperature, pressure
+
+def uptime(seconds):
+    return "%02d:%02d:%02d" % (seconds // 3600, seconds % 3600 // 60, seconds % 60)
+
+def makeTrack(outputName):
+    rng = random.Random(2026)
+    header = "Time(s),Altitude(m),Speed(m/s),Longitude(deg),Latitude(deg),Temperature(C),Pressure(hPa),Humidity(%)"
+    for i in range(pod_count):
+        header += ",%d_position,%d_temperature,%d_act_status,%d_heat_status,%d_motion" % (i, i, i, i, i)
+    rows = [header]
+
+    #Stepped every second, a row every row_step
+    latitude, longitude, altitude = launch_latitude, launch_longitude, ground
+    gustEast, gustNorth = 0.0, 0.0
+    descending, landed = False, False
+    second = 0
+    while(not landed):
+        flightTime = second - pad_time
+        east, north = 0.0, 0.0
+        if(flightTime >= 0):
+            #Gusts, first order so they persist
+            decay = math.exp(-1 / gust_time)
+            gustEast = gustEast * decay + rng.gauss(0, gust_sigma * math.sqrt(1 - decay * decay))
+            gustNorth = gustNorth * decay + rng.gauss(0, gust_sigma * math.sqrt(1 - decay * decay))
+            east, north = wind(altitude, flightTime)
+            east, north = east + gustEast, north + gustNorth
+
+            if(not descending):
+                altitude += climb_rate * (1 + 0.05 * rng.gauss(0, 1))
+                descending = altitude >= burst_altitude
+            else:
+                altitude -= descent_rate * math.exp(altitude / (2 * density_scale)) * (1 + 0.03 * rng.gauss(0, 1))
+                if(altitude <= ground):
+                    altitude = ground
+                    landed = True
+            latitude += north / metres_per_degree
+            longitude += east / (metres_per_degree * math.cos(math.radians(latitude)))
+
+        if(second % row_step == 0 or landed):
+            temperature, pressure = standardAtmosphere(altitude)
+            row = [uptime(start_uptime + second),
+                "%.2f" % (altitude + rng.gauss(0, gps_vertical)),
+                "%.2f" % math.hypot(east, north),
+                "%.6f" % (longitude + rng.gauss(0, gps_horizontal) / (metres_per_degree * math.cos(math.radians(latitude)))),
+                "%.6f" % (latitude + rng.gauss(0, gps_horizontal) / metres_per_degree),
+                "%.2f" % temperature, "%d" % pressure, "%.2f" % max(0.0, 60 - altitude / 300)]
+            for i in range(pod_count):
+                row += ["10", "%.2f" % max(temperature, -30.0), "AUTO", "AUTO", "IDLE"]
+            rows.append(",".join(row))
+        second += 1
+
+    #Lies on the ground a while, as the board logs once landed
+    for i in range(1, 6):
+        rows.append(",".join([uptime(start_uptime + second + 60 * i)] + rows[-1].split(",")[1:]))
+
+    with open(outputName, "w") as outputFile:
+        outputFile.write("\n".join(rows) + "\n")
+
+
+if __name__ == "__main__":
+    makeTrack(sys.argv[1] if len(sys.argv) > 1 else os.path.join(track_directory, "synthetic_london.txt"))
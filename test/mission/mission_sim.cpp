@@ -0,0 +1,844 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Monte Carlo flights of the host build of the sketch, to choose the pod altitudes
+*				and timing constants: setup() and loop() run as on the board, so handleActuator,
+*				the pods' isInInterval, updateHeating and HAB_Thermal, HAB_Motion and the link
+*				handling are the flight code itself. Only the board around them is modelled: the
+*				balloon's climb and descent through the air, each pod's heater and thermal body
+*				(read through its thermistor), its actuator's travel (read through its position
+*				pot, slowed by the cold, stalled when frozen, and sometimes noisy), the GPS's NMEA
+*				with dropouts, the BME's air, and a lossy link with outages to a groundstation
+*				that heartbeats, answers pings and has an operator commanding the pods from the
+*				telemetry. Each flight draws its own of all these.
+*
+*				Flights are run by a pool of forked workers, each with a range of the flights; one
+*				that runs out steals half of the largest range left. Every flight is forked from
+*				its worker, so it starts with a board fresh from reset (the sketch's globals and
+*				the simulated clock are per process) and only its results, in shared memory, come
+*				back. Per pod band: how often it was crossed, the share of it sampled (mean and
+*				10th percentile), and how often the pod never opened, stalled, was left unsealed
+*				or left open. Exits 1 if a flight crashed or never landed.
+*
+*				--trace writes the first flight's timeline (stubs/HAB_Trace.h) as a Chrome trace:
+*				its commands, phase changes and actuator transitions over the whole flight, and the
+*				loop's sections and the SD, UDP, UART and I2C time within them for the window
+*				given, in seconds from launch (the first 10 s by default).
+*
+*				mission_sim [-n flights] [-j workers] [--seed N] [--pod N=OPEN:CLOSE]... [--scaling]
+*							[--trace FILE [--trace-start S] [--trace-length S]]
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Sketch.h>
+	#include <HAB_Trace.h>
+	#include <algorithm>
+	#include <atomic>
+	#include <chrono>
+	#include <random>
+	#include <vector>
+	#include <sys/mman.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define MISSION_MAX_PODS 4
+	#define MISSION_PHYSICS_US 100000 //Step of the board model
+	#define MISSION_GROUND_US 50000 //How often the groundstation looks at its socket
+	#define MISSION_PAD_TIME 300 //s on the pad after setup
+	#define MISSION_LANDED_WAIT 1800 //s after touchdown the board has to call it landed
+	#define MISSION_MAX_TIME (12 * 3600UL) //s, a flight still going is given up on
+	#define MISSION_LEFT_OPEN 60 //s open outside its interval that counts as left open
+	#define MISSION_LOOP_US 1000 //The loop's own computation on the board, which the host build doesn't charge (test/avr profiles it)
+
+	//What the flights draw from, (mean, standard deviation) unless noted. These are the model, not the
+	//flight software, which is compiled in as the board has it.
+	struct missionDraw {
+		float mean, deviation;
+	};
+	static const missionDraw PAD_ALTITUDE = { 250, 50 }; //m
+	static const missionDraw ASCENT_RATE = { 5.0, 0.7 }; //m/s
+	static const missionDraw BURST_ALTITUDE = { 31000, 2500 }; //m
+	static const missionDraw DESCENT_RATE = { 5.0, 0.5 }; //m/s at sea level, faster in the thin air above
+	static const missionDraw GROUND_TEMPERATURE = { 10, 8 }; //C
+	static const missionDraw LAPSE_RATE = { 6.5, 0.5 }; //C/km up to the tropopause
+	static const missionDraw TROPOPAUSE = { 11000, 1500 }; //m
+	static const missionDraw STRATOSPHERE_WARMING = { 1.0, 0.3 }; //C/km above 20km
+	static const missionDraw POD_TAU = { 1.0, 0.2 }; //Fraction of THERMAL_DEFAULT_TAU
+	static const missionDraw POD_RISE = { 1.0, 0.2 }; //Fraction of THERMAL_DEFAULT_RISE
+	static const missionDraw TRAVEL_TIME = { 8, 1.5 }; //s for a warm actuator's full travel
+	static const missionDraw FREEZE_TEMPERATURE = { -25, 3 }; //C, an actuator this cold stalls
+	static const missionDraw OPERATOR_DELAY = { 5, 2 }; //s from seeing the altitude to sending the command
+	#define GUST_SIGMA 0.5 //m/s on the climb rate
+	#define GUST_TIME 10.0 //s the gusts are correlated over
+	#define PACKET_LOSS_MAX 0.3 //Drawn uniformly from 0, once per flight, each way
+	#define OUTAGE_RATE (1 / 3600.0) //Per second, the link is down entirely
+	#define OUTAGE_LENGTH 120 //s, mean
+	#define GPS_DROPOUT_RATE (1 / 1800.0) //Per second
+	#define GPS_DROPOUT_LENGTH 60 //s, mean
+	#define LINK_LATENCY 30000 //us each way
+	#define OPERATOR_RETRY 15 //s before a command that changed nothing is sent again
+	#define COLD_SLOWDOWN 0.03 //Of the travel time added per C below 0C
+	#define NOISY_POSITION 0.15 //Chance a pod's position pot is noisy enough that the travel never settles
+	#define POSITION_NOISE 1.0 //ADC counts, sigma, of a quiet pot
+	#define NOISY_NOISE 4.0 //ADC counts, sigma, of a noisy one: enough that the travel never looks settled
+	#define SEAL_PUSH_MIN 0.2 //s a pod has to be pushed against its closed stop to seal, drawn per pod
+	#define SEAL_PUSH_MAX 0.6
+	#define STOP_SLACK 20 //ADC counts from a stop that is still at it
+
+	//Where each pod is wired, as the sketch has it
+	struct missionPins {
+		uint8_t heater, enable, push, pull, position, thermistor;
+	};
+	static const missionPins podPins[MISSION_MAX_PODS] = {
+		{ HEAT1_EN, ACT1_EN, ACT1_PUSH, ACT1_PULL, ACT1_POS, THERMISTOR1 },
+		{ HEAT2_EN, ACT2_EN, ACT2_PUSH, ACT2_PULL, ACT2_POS, THERMISTOR2 },
+		{ HEAT3_EN, ACT3_EN, ACT3_PUSH, ACT3_PULL, ACT3_POS, THERMISTOR3 },
+		{ HEAT4_EN, ACT4_EN, ACT4_PUSH, ACT4_PULL, ACT4_POS, THERMISTOR4 }
+	};
+
+	//A pod as it really is through a flight
+	struct missionPod {
+		float openAlt, closeAlt; //m, the actuator's interval
+		float tau, rise; //s, C
+		float freeze; //C
+		float travelTime; //s, warm
+		float openStop, closedStop; //ADC counts of its mechanical stops
+		float sealPush; //s
+		float noise; //ADC counts, sigma
+
+		float temperature; //C
+		float position; //ADC counts
+		float pushed; //s against the closed stop since it got there
+		bool sealed, reachedOpen, stalled, alarmed;
+		uint32_t heaterTicks, intervalTicks, sampledTicks, outsideTicks;
+	};
+
+	//One pod's part of a flight, as it comes back from the flight's process
+	struct podResult {
+		bool crossed, opened, stalled, unsealed, leftOpen;
+		float coverage; //Share of the interval it was open and still
+		float heaterEnergy; //J
+	};
+
+	struct flightResult {
+		bool done; //The flight's process finished it
+		bool landed; //The board got to PHASE_LANDED
+		uint8_t podCount;
+		podResult pods[MISSION_MAX_PODS];
+		uint16_t disconnects, spurious; //Heartbeat timeouts, and those while the link was up
+		float disconnected; //s
+		float duration; //s from launch to touchdown
+	};
+
+	//A worker's flights still to run, [begin, end) packed in one word so taking and stealing are each one
+	//compare and swap. Each is on a cache line of its own.
+	struct alignas(64) workerRange {
+		std::atomic<uint64_t> range;
+	};
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "the pool's ranges are shared between processes");
+
+	//A datagram on its way up to the board
+	struct uplinkPacket {
+		uint64_t due; //us
+		char text[64];
+	};
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//The flight this process is running
+	static std::mt19937 rng;
+	static missionPod pods[MISSION_MAX_PODS];
+	static uint8_t podCount;
+	static float padAltitude, ascentRate, burstAltitude, descentRate;
+	static float groundTemperature, lapseRate, tropopause, stratosphereWarming;
+	static float packetLoss;
+
+	//The balloon
+	static float altitude, latitude = 43.009953, longitude = -81.273613; //m, degrees
+	static float gust, speed; //m/s
+	static bool launched, descending, touchedDown;
+	static uint64_t launchTime, touchdownTime; //us
+
+	//The link and GPS
+	static float outageLeft, dropoutLeft; //s
+	static bool wasConnected, everConnected;
+	static uint16_t disconnects, spurious;
+	static uint32_t disconnectedTicks;
+
+	//The groundstation and its operator
+	static bool heard; //From the board, the heartbeats start once it is
+	static uint64_t lastHeartbeatSent;
+	static std::vector<uplinkPacket> uplink;
+	static float seenAltitude = -1; //m, from the last telemetry that got through
+	static bool seenDescending;
+	static uint8_t seenActive;
+	static int8_t pendingPod = -1;
+	static bool pendingOpen;
+	static uint64_t pendingDue, lastSent[MISSION_MAX_PODS][2];
+
+	//The trace of the first flight, and its window of spans (s from launch)
+	static const char* traceName = NULL;
+	static float traceStart = 0, traceLength = 10;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Flight model--------------------------------------------------------------------|
+
+		static float gauss(const missionDraw& draw){
+			return std::normal_distribution<float>(draw.mean, draw.deviation)(rng);
+		}
+		static float uniform(float low, float high){
+			return std::uniform_real_distribution<float>(low, high)(rng);
+		}
+		static bool chance(float probability){
+			return uniform(0, 1) < probability;
+		}
+
+		static float seconds(){
+			return HAB_Host::getMicros() / 1e6;
+		}
+
+		static float ambientTemperature(float metres){
+			//Standard-atmosphere shape: the lapse rate to the tropopause, then flat, then warming above 20km
+			float temperature = groundTemperature - lapseRate * (fmin(metres, tropopause) - padAltitude) / 1000;
+			return temperature + stratosphereWarming * fmax(0.0f, metres - 20000) / 1000;
+		}
+
+		static bool isLinkUp(){
+			return outageLeft <= 0 && !chance(packetLoss);
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		drawFlight																|
+	|	Purpose: 	Draws the flight's air, balloon, link and pods, with the pods on the	|
+	|				pad at the air's temperature and closed.								|
+	|	Arguments:	uint32_t (seed)															|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void drawFlight(uint32_t seed){
+			rng.seed(seed);
+			padAltitude = gauss(PAD_ALTITUDE);
+			ascentRate = fmax(gauss(ASCENT_RATE), 2.0f);
+			burstAltitude = gauss(BURST_ALTITUDE);
+			descentRate = fmax(gauss(DESCENT_RATE), 2.0f);
+			groundTemperature = gauss(GROUND_TEMPERATURE);
+			lapseRate = gauss(LAPSE_RATE);
+			tropopause = gauss(TROPOPAUSE);
+			stratosphereWarming = gauss(STRATOSPHERE_WARMING);
+			packetLoss = uniform(0, PACKET_LOSS_MAX);
+			altitude = padAltitude;
+
+			for(uint8_t i = 0; i != MISSION_MAX_PODS; i++){
+				missionPod& pod = pods[i];
+				pod = missionPod();
+				pod.tau = THERMAL_DEFAULT_TAU * fmax(gauss(POD_TAU), 0.3f);
+				pod.rise = THERMAL_DEFAULT_RISE * fmax(gauss(POD_RISE), 0.3f);
+				pod.freeze = gauss(FREEZE_TEMPERATURE);
+				pod.travelTime = fmax(gauss(TRAVEL_TIME), 1.0f);
+				pod.openStop = uniform(0, 5);
+				pod.closedStop = uniform(1022, 1023);
+				pod.sealPush = uniform(SEAL_PUSH_MIN, SEAL_PUSH_MAX);
+				pod.noise = (chance(NOISY_POSITION) ? NOISY_NOISE : POSITION_NOISE);
+				pod.temperature = groundTemperature;
+				pod.position = pod.closedStop;
+				pod.sealed = true;
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		analogReading															|
+	|	Purpose: 	The board model's ADC: each pod's position pot, with its noise, and its	|
+	|				thermistor's divider (the B equation the actuator inverts).				|
+	|	Arguments:	uint8_t (pin)															|
+	|	Returns:	int																		|
+	\*-------------------------------------------------------------------------------------*/
+		static int analogReading(uint8_t pin){
+			for(uint8_t i = 0; i != MISSION_MAX_PODS; i++){
+				if(pin == podPins[i].position){
+					return (int)lround(pods[i].position + std::normal_distribution<float>(0, pods[i].noise)(rng));
+				}
+				if(pin == podPins[i].thermistor){
+					float kelvin = pods[i].temperature + 273.15;
+					float resistance = THERMISTORNOMINAL * exp(BCOEFFICIENT * (1 / kelvin - 1 / (TEMPERATURENOMINAL + 273.15)));
+					return (int)lround(1023 * resistance / (resistance + SERIESRESISTOR));
+				}
+			}
+			return 512;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		physicsTick																|
+	|	Purpose: 	Moves the board's world on a step: the balloon, the air the BME reads,	|
+	|				each pod's temperature (heated while its heater pin is high) and its	|
+	|				actuator (driven by its enable, push and pull pins), and the link's		|
+	|				outages. Keeps the figures each pod and the link are scored on.			|
+	|	Arguments:	void																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void physicsTick(){
+			const float step = MISSION_PHYSICS_US / 1e6;
+			uint64_t now = HAB_Host::getMicros();
+
+			//Balloon---------------------------------------------------------|
+				if(!launched && launchTime != 0 && now >= launchTime){ launched = true; }
+				float decay = exp(-step / GUST_TIME);
+				gust = gust * decay + std::normal_distribution<float>(0, GUST_SIGMA * sqrt(1 - decay * decay))(rng);
+				float climb = 0;
+				if(launched && !touchedDown){
+					if(!descending){
+						climb = fmax(0.5f, ascentRate + gust);
+						descending = (altitude >= burstAltitude);
+					}
+					else{ climb = -descentRate * exp(altitude / 14000); }
+					altitude += climb * step;
+					if(altitude <= padAltitude){
+						altitude = padAltitude;
+						touchedDown = true;
+						touchdownTime = now;
+					}
+
+					//Drifting east with the winds, a jet at the tropopause
+					float east = 8 + 20 * exp(-pow((altitude - 11000) / 4000, 2));
+					longitude += east * step / (111320 * cos(latitude * DEG_TO_RAD));
+					speed = hypot(east, climb);
+				}
+				else{ speed = 0; }
+				float ambient = ambientTemperature(altitude);
+				hostEnvironment& air = HAB_Host::getEnvironment();
+				air.temperature = ambient;
+				air.pressure = 101325 * exp(-(altitude - padAltitude) / 7400) * exp(-padAltitude / 7400);
+				air.humidity = fmax(0.0f, 60 - altitude / 300);
+
+			//Pods------------------------------------------------------------|
+				bool flying = launched && !touchedDown;
+				for(uint8_t i = 0; i != podCount; i++){
+					missionPod& pod = pods[i];
+					const missionPins& pins = podPins[i];
+
+					bool heating = HAB_Host::getPin(pins.heater);
+					if(heating){ pod.heaterTicks++; }
+					pod.temperature += step / pod.tau * (ambient - pod.temperature + (heating ? pod.rise : 0));
+
+					//Pushing extends it (closing, towards the high stop), pulling retracts it
+					bool push = HAB_Host::getPin(pins.push), pull = HAB_Host::getPin(pins.pull);
+					bool driven = HAB_Host::getPin(pins.enable) && push != pull;
+					if(driven && pod.temperature < pod.freeze){ pod.stalled = true; }
+					else if(driven){
+						float rate = (pod.closedStop - pod.openStop) / (pod.travelTime * (1 + COLD_SLOWDOWN * fmax(0.0f, -pod.temperature)));
+						pod.position = constrain(pod.position + (push ? rate : -rate) * step, pod.openStop, pod.closedStop);
+						if(push && pod.position >= pod.closedStop){
+							pod.pushed += step;
+							pod.sealed = pod.sealed || pod.pushed >= pod.sealPush;
+						}
+						if(pull){
+							pod.pushed = 0;
+							pod.sealed = false;
+						}
+					}
+					bool atOpen = pod.position <= pod.openStop + STOP_SLACK;
+					bool atClosed = pod.position >= pod.closedStop - STOP_SLACK;
+					if(atOpen){ pod.reachedOpen = true; }
+
+					if(flying && !descending && altitude >= pod.openAlt && altitude < pod.closeAlt){
+						pod.intervalTicks++;
+						if(atOpen && !driven){ pod.sampledTicks++; }
+					}
+					else if(flying && !atClosed){ pod.outsideTicks++; }
+				}
+
+			//Link------------------------------------------------------------|
+				if(outageLeft > 0){ outageLeft -= step; }
+				else if(flying && chance(OUTAGE_RATE * step)){
+					outageLeft = std::exponential_distribution<float>(1.0f / OUTAGE_LENGTH)(rng);
+				}
+				if(!noConnection){ everConnected = true; }
+				if(wasConnected && noConnection){
+					disconnects++;
+					if(outageLeft <= 0){ spurious++; }
+				}
+				wasConnected = !noConnection;
+				if(noConnection && everConnected && flying){ disconnectedTicks++; }
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		gpsTick																	|
+	|	Purpose: 	The receiver's GGA and RMC each second, down the serial port at its		|
+	|				baud rate. Through a dropout they have no fix.							|
+	|	Arguments:	void																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void nmea(char* sentence, const char* body){
+			uint8_t checksum = 0;
+			for(const char* p = body; *p; p++){ checksum ^= *p; }
+			sprintf(sentence, "$%s*%02X\r\n", body, checksum);
+		}
+
+		static void gpsTick(){
+			if(dropoutLeft > 0){ dropoutLeft -= 1; }
+			else if(launched && chance(GPS_DROPOUT_RATE)){
+				dropoutLeft = std::exponential_distribution<float>(1.0f / GPS_DROPOUT_LENGTH)(rng);
+			}
+			bool fix = dropoutLeft <= 0;
+
+			uint32_t clock = 17 * 3600 + (uint32_t)seconds();
+			char time[16], lat[16], lng[16], body[128], sentences[256];
+			sprintf(time, "%02u%02u%02u.00", (unsigned)(clock / 3600 % 24), (unsigned)(clock / 60 % 60), (unsigned)(clock % 60));
+			sprintf(lat, "%02d%08.5f", (int)latitude, (latitude - (int)latitude) * 60);
+			float west = -longitude;
+			sprintf(lng, "%03d%08.5f", (int)west, (west - (int)west) * 60);
+
+			if(fix){ sprintf(body, "GPGGA,%s,%s,N,%s,W,1,08,0.9,%.1f,M,-34.0,M,,", time, lat, lng, altitude); }
+			else{ sprintf(body, "GPGGA,%s,,,,,0,00,99.9,,M,,M,,", time); }
+			nmea(sentences, body);
+			if(fix){ sprintf(body, "GPRMC,%s,A,%s,N,%s,W,%.2f,90.0,191026,,,A", time, lat, lng, speed * 1.943844); }
+			else{ sprintf(body, "GPRMC,%s,V,,,,,,,191026,,,N", time); }
+			nmea(sentences + strlen(sentences), body);
+			HAB_Host::feedSerial(Serial1, (const uint8_t*)sentences, strlen(sentences));
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Groundstation-------------------------------------------------------------------|
+
+		static void groundSend(const char* text){
+			if(!isLinkUp()){ return; }
+			uplinkPacket packet;
+			packet.due = HAB_Host::getMicros() + LINK_LATENCY;
+			snprintf(packet.text, sizeof(packet.text), "%s%s%s", GROUNDSTATION_NAME, FIELD_DELIMITER, text);
+			uplink.push_back(packet);
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		downlink																|
+	|	Purpose: 	A datagram the board sent, reaching the operator's groundstation if		|
+	|				the link lets it. Pings are echoed, as server.py does; anything else	|
+	|				updates what the operator sees, and a stall alarm is noted.				|
+	|	Arguments:	const hostDatagram&														|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void downlink(const hostDatagram& datagram){
+			if(datagram.ip[3] != GS1_IP_O4 || datagram.port != GS1_PORT || !isLinkUp()){ return; }
+			heard = true;
+
+			char text[sizeof(datagram.data) + 1];
+			memcpy(text, datagram.data, datagram.length);
+			text[datagram.length] = '\0';
+			if(!strncmp(text, "[PING]", 6)){
+				char pong[sizeof(text) + 5];
+				snprintf(pong, sizeof(pong), "PONG,%s", text + 6);
+				groundSend(pong);
+				return;
+			}
+
+			//The telemetry carries the altitude, phase and active pod
+			seenAltitude = toFloat(_HABGPSreadings.altitude);
+			seenDescending = (_phase->getPhase() == PHASE_DESCENT);
+			seenActive = activeIndex;
+			for(uint8_t i = 0; i != podCount; i++){
+				char alarm[48];
+				snprintf(alarm, sizeof(alarm), "Actuator of %s stalled", _actArray[i].getName());
+				if(strstr(text, alarm)){ pods[i].alarmed = true; }
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		operate																	|
+	|	Purpose: 	The operator, once a second: the pod that should be in use is opened	|
+	|				while the telemetry puts it within its interval on the way up, and		|
+	|				closed once out of it. A stalled pod is given up on. Each command is	|
+	|				sent after a reaction time, and again if nothing has changed.			|
+	|	Arguments:	void																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void operate(){
+			if(seenAltitude < 0){ return; }
+			int8_t wanted = -1;
+			bool open = false;
+			for(uint8_t i = 0; i != podCount && wanted < 0; i++){
+				missionPod& pod = pods[i];
+				if(pod.alarmed){ continue; }
+				bool inInterval = seenAltitude >= pod.openAlt && seenAltitude < pod.closeAlt;
+				bool closed = pod.position >= pod.closedStop - STOP_SLACK;
+				bool opened = pod.position <= pod.openStop + STOP_SLACK;
+				if(!closed && !inInterval){ wanted = i; }
+				else if(inInterval && !seenDescending && !opened && !(closed && pod.reachedOpen)){
+					wanted = i;
+					open = true;
+				}
+			}
+			if(wanted < 0){
+				pendingPod = -1;
+				return;
+			}
+
+			uint64_t now = HAB_Host::getMicros();
+			if(pendingPod != wanted || pendingOpen != open){
+				pendingPod = wanted;
+				pendingOpen = open;
+				pendingDue = now + (uint64_t)(fmax(0.0f, gauss(OPERATOR_DELAY)) * 1e6);
+			}
+			uint64_t& sent = lastSent[wanted][open];
+			if(now < pendingDue || (sent != 0 && now - sent < OPERATOR_RETRY * 1000000ULL)){ return; }
+			sent = now;
+
+			char command[32];
+			if(seenActive != wanted){
+				snprintf(command, sizeof(command), "SET_ACTIVE %s", _actArray[wanted].getName());
+				groundSend(command);
+			}
+			groundSend(open ? "OVR_ACT_OPEN" : "OVR_ACT_CLOSE");
+		}
+
+		static void groundTick(){
+			uint64_t now = HAB_Host::getMicros();
+			for(size_t i = 0; i != uplink.size();){
+				if(uplink[i].due <= now){
+					HAB_Host::sendToBoard(IPAddress(GS1_IP_O1, GS1_IP_O2, GS1_IP_O3, GS1_IP_O4), GS1_PORT, LOCAL_PORT,
+						uplink[i].text, strlen(uplink[i].text));
+					uplink.erase(uplink.begin() + i);
+				}
+				else{ i++; }
+			}
+
+			//A heartbeat every second once the board is heard from, and the operator
+			if(now - lastHeartbeatSent >= 1000000){
+				lastHeartbeatSent = now;
+				if(heard){ groundSend("HBT"); }
+				operate();
+			}
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Flights-------------------------------------------------------------------------|
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		runFlight																|
+	|	Purpose: 	Runs one flight in this process: the board is set up on the pad, then	|
+	|				its loop runs through launch, the climb, burst and descent until it		|
+	|				calls itself landed. Intervals given on the command line replace the	|
+	|				sketch's. A traced flight writes its timeline to traceName.				|
+	|	Arguments:	uint32_t (seed), const std::vector<std::pair<float, float>>&, flightResult&,|
+	|				bool (traced)															|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void runFlight(uint32_t seed, const std::vector<std::pair<float, float>>& intervals, flightResult& result, bool traced){
+			char threadName[24];
+			snprintf(threadName, sizeof(threadName), "Flight %u", seed);
+			HAB_Trace::setThreadName(threadName);
+			HAB_Trace::setSpans(false);
+			HAB_Trace::setEnabled(traced);
+
+			drawFlight(seed);
+			podCount = MISSION_MAX_PODS;
+			HAB_Host::setAnalogHook(analogReading);
+			HAB_Host::setNetworkHook(downlink);
+			HAB_Host::addTicker(physicsTick, MISSION_PHYSICS_US);
+			HAB_Host::addTicker(gpsTick, 1000000);
+			HAB_Host::addTicker(groundTick, MISSION_GROUND_US);
+
+			setup();
+			podCount = min(act_arr_len, (uint8_t)MISSION_MAX_PODS);
+			for(uint8_t i = 0; i != podCount; i++){
+				if(i < intervals.size() && intervals[i].second > 0){
+					_actArray[i].setOpenAltitude(fromMetres(intervals[i].first));
+					_actArray[i].setCloseAltitude(fromMetres(intervals[i].second));
+				}
+				pods[i].openAlt = toFloat(_actArray[i].getOpenAlt());
+				pods[i].closeAlt = toFloat(_actArray[i].getCloseAlt());
+			}
+			launchTime = HAB_Host::getMicros() + MISSION_PAD_TIME * 1000000ULL;
+
+			while(HAB_Host::getMicros() < MISSION_MAX_TIME * 1000000ULL){
+				if(traced){
+					float sinceLaunch = ((int64_t)HAB_Host::getMicros() - (int64_t)launchTime) / 1e6;
+					HAB_Trace::setSpans(sinceLaunch >= traceStart && sinceLaunch < traceStart + traceLength);
+				}
+				loop();
+				HAB_Host::spend(MISSION_LOOP_US);
+				if(touchedDown && (_phase->getPhase() == PHASE_LANDED || HAB_Host::getMicros() - touchdownTime > MISSION_LANDED_WAIT * 1000000ULL)){
+					break;
+				}
+			}
+
+			result.landed = (_phase->getPhase() == PHASE_LANDED);
+			result.podCount = podCount;
+			result.disconnects = disconnects;
+			result.spurious = spurious;
+			result.disconnected = disconnectedTicks * (MISSION_PHYSICS_US / 1e6);
+			result.duration = ((touchedDown ? touchdownTime : HAB_Host::getMicros()) - launchTime) / 1e6;
+			for(uint8_t i = 0; i != podCount; i++){
+				missionPod& pod = pods[i];
+				podResult& out = result.pods[i];
+				out.crossed = pod.intervalTicks != 0;
+				out.coverage = (out.crossed ? (float)pod.sampledTicks / pod.intervalTicks : 0);
+				out.opened = pod.reachedOpen;
+				out.stalled = pod.stalled;
+				out.unsealed = pod.reachedOpen && pod.position >= pod.closedStop - STOP_SLACK && !pod.sealed;
+				out.leftOpen = pod.position < pod.closedStop - STOP_SLACK || pod.outsideTicks * (MISSION_PHYSICS_US / 1e6) > MISSION_LEFT_OPEN;
+				out.heaterEnergy = pod.heaterTicks * (MISSION_PHYSICS_US / 1e6) * HEATER_POWER;
+			}
+
+			if(traced){
+				if(HAB_Trace::write(traceName, "mission_sim")){
+					printf("Trace of flight %u written to %s, %u events dropped\n", seed, traceName, HAB_Trace::getDropped());
+				}
+				else{ printf("FAILED: couldn't write the trace to %s\n", traceName); }
+				fflush(stdout);
+			}
+			result.done = true;
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Pool----------------------------------------------------------------------------|
+
+		static uint64_t packRange(uint32_t begin, uint32_t end){
+			return ((uint64_t)end << 32) | begin;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		takeFlight																|
+	|	Purpose: 	The next flight for a worker: the front of its own range, else half of	|
+	|				the largest range left, taken from its back. Returns false once no		|
+	|				worker has any left.													|
+	|	Arguments:	workerRange*, uint8_t (workers), uint8_t (this one), uint32_t&			|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		static bool takeFlight(workerRange* ranges, uint8_t workers, uint8_t self, uint32_t& flight){
+			for(;;){
+				uint64_t own = ranges[self].range.load();
+				uint32_t begin = (uint32_t)own, end = (uint32_t)(own >> 32);
+				if(begin < end){
+					if(ranges[self].range.compare_exchange_weak(own, packRange(begin + 1, end))){
+						flight = begin;
+						return true;
+					}
+					continue;
+				}
+
+				//Empty, so only this worker writes its range until it has one again
+				int8_t victim = -1;
+				uint32_t most = 0;
+				for(uint8_t i = 0; i != workers; i++){
+					uint64_t range = ranges[i].range.load();
+					uint32_t left = (uint32_t)(range >> 32) - min((uint32_t)range, (uint32_t)(range >> 32));
+					if(i != self && left > most){
+						most = left;
+						victim = i;
+					}
+				}
+				if(victim < 0){ return false; }
+
+				uint64_t range = ranges[victim].range.load();
+				begin = (uint32_t)range;
+				end = (uint32_t)(range >> 32);
+				if(begin >= end){ continue; }
+				uint32_t middle = begin + (end - begin) / 2;
+				if(ranges[victim].range.compare_exchange_strong(range, packRange(begin, middle))){
+					ranges[self].range.store(packRange(middle, end));
+				}
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		runPool																	|
+	|	Purpose: 	Runs the flights on forked workers, each flight in a process forked		|
+	|				from its worker, into results (shared). The first is traced if asked.	|
+	|				Returns the wall time (s).												|
+	|	Arguments:	uint32_t (flights), uint8_t (workers), uint32_t (first seed),			|
+	|				const std::vector<std::pair<float, float>>&, flightResult*, bool (trace)|
+	|	Returns:	double																	|
+	\*-------------------------------------------------------------------------------------*/
+		static double runPool(uint32_t flights, uint8_t workers, uint32_t seed, const std::vector<std::pair<float, float>>& intervals,
+				flightResult* results, bool trace){
+			workerRange* ranges = (workerRange*)mmap(NULL, sizeof(workerRange) * workers, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			for(uint8_t i = 0; i != workers; i++){
+				new(&ranges[i].range) std::atomic<uint64_t>(packRange(flights * i / workers, flights * (i + 1) / workers));
+			}
+			memset(results, 0, sizeof(flightResult) * flights);
+			fflush(stdout);
+
+			auto start = std::chrono::steady_clock::now();
+			std::vector<pid_t> pids;
+			for(uint8_t self = 0; self != workers; self++){
+				pid_t pid = fork();
+				if(pid != 0){
+					pids.push_back(pid);
+					continue;
+				}
+
+				uint32_t flight;
+				while(takeFlight(ranges, workers, self, flight)){
+					pid_t child = fork();
+					if(child == 0){
+						runFlight(seed + flight, intervals, results[flight], trace && flight == 0);
+						_exit(0);
+					}
+					int status;
+					waitpid(child, &status, 0);
+				}
+				_exit(0);
+			}
+			for(pid_t pid : pids){
+				int status;
+				waitpid(pid, &status, 0);
+			}
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			munmap(ranges, sizeof(workerRange) * workers);
+			return elapsed;
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Report--------------------------------------------------------------------------|
+
+		static float percentile(std::vector<float> values, float fraction){
+			if(values.empty()){ return 0; }
+			std::sort(values.begin(), values.end());
+			return values[min(values.size() - 1, (size_t)(fraction * values.size()))];
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		report																	|
+	|	Purpose: 	Prints the link and each pod band's figures over the flights. Returns	|
+	|				false if a flight crashed or never landed.								|
+	|	Arguments:	const flightResult*, uint32_t (flights), double (s), uint8_t (workers)	|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		static bool report(const flightResult* results, uint32_t flights, double elapsed, uint8_t workers){
+			uint32_t done = 0, landed = 0;
+			float disconnects = 0, spurious = 0, disconnected = 0, duration = 0;
+			uint8_t reported = 0;
+			for(uint32_t i = 0; i != flights; i++){
+				if(!results[i].done){ continue; }
+				done++;
+				landed += results[i].landed;
+				disconnects += results[i].disconnects;
+				spurious += results[i].spurious;
+				disconnected += results[i].disconnected;
+				duration += results[i].duration;
+				reported = max(reported, results[i].podCount);
+			}
+			printf("%u flights in %.1f s on %u workers (%.1f flights/s), %u crashed, %u never landed\n", flights, elapsed, workers,
+				flights / fmax(elapsed, 1e-9), flights - done, done - landed);
+			if(done == 0){ return false; }
+			printf("Flights %.0f min from launch to touchdown, on average\n", duration / done / 60);
+			printf("Link: %.2f disconnects per flight (%.2f with the link up), %.0f s disconnected per flight\n", disconnects / done,
+				spurious / done, disconnected / done);
+
+			printf("%-6s %13s %9s %9s %9s %9s %9s %9s %9s %9s\n", "Pod", "Band (m)", "Crossed", "Mean cov", "P10 cov", "No open", "Stalled",
+				"Unsealed", "Left open", "Heat (J)");
+			for(uint8_t p = 0; p != reported; p++){
+				std::vector<float> coverage;
+				uint32_t neverOpened = 0, stalled = 0, unsealed = 0, leftOpen = 0;
+				float energy = 0;
+				for(uint32_t i = 0; i != flights; i++){
+					if(!results[i].done){ continue; }
+					const podResult& pod = results[i].pods[p];
+					if(pod.crossed){
+						coverage.push_back(pod.coverage);
+						neverOpened += !pod.opened;
+					}
+					stalled += pod.stalled;
+					unsealed += pod.unsealed;
+					leftOpen += pod.leftOpen;
+					energy += pod.heaterEnergy;
+				}
+				float crossed = fmax(coverage.size(), 1);
+				float mean = 0;
+				for(float share : coverage){ mean += share; }
+				printf("%-6s %6.0f-%-6.0f %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %8.1f%% %9.0f\n", _actArray[p].getName(),
+					toFloat(_actArray[p].getOpenAlt()), fmin(toFloat(_actArray[p].getCloseAlt()), 99999), 100.0 * coverage.size() / done,
+					100 * mean / crossed, 100 * percentile(coverage, 0.1), 100 * neverOpened / crossed, 100.0 * stalled / done,
+					100.0 * unsealed / done, 100.0 * leftOpen / done, energy / done);
+			}
+			return done == flights && landed == done;
+		}
+
+
+	int main(int argc, char** argv){
+		uint32_t flights = 100, seed = 1;
+		long cores = sysconf(_SC_NPROCESSORS_ONLN);
+		uint8_t workers = (uint8_t)constrain(cores, 1, 255);
+		bool scaling = false;
+		std::vector<std::pair<float, float>> intervals(MISSION_MAX_PODS, std::make_pair(0.0f, 0.0f));
+		for(int i = 1; i < argc; i++){
+			unsigned pod;
+			float open, close;
+			//Read before they are limited, the Arduino macros take their arguments more than once
+			if(!strcmp(argv[i], "-n") && i + 1 < argc){
+				long count = atol(argv[++i]);
+				flights = max(count, 1L);
+			}
+			else if(!strcmp(argv[i], "-j") && i + 1 < argc){
+				long count = atol(argv[++i]);
+				workers = (uint8_t)constrain(count, 1, 255);
+			}
+			else if(!strcmp(argv[i], "--seed") && i + 1 < argc){ seed = atol(argv[++i]); }
+			else if(!strcmp(argv[i], "--scaling")){ scaling = true; }
+			else if(!strcmp(argv[i], "--trace") && i + 1 < argc){ traceName = argv[++i]; }
+			else if(!strcmp(argv[i], "--trace-start") && i + 1 < argc){ traceStart = atof(argv[++i]); }
+			else if(!strcmp(argv[i], "--trace-length") && i + 1 < argc){ traceLength = atof(argv[++i]); }
+			else if(!strcmp(argv[i], "--pod") && i + 1 < argc && sscanf(argv[++i], "%u=%f:%f", &pod, &open, &close) == 3
+				&& pod >= 1 && pod <= MISSION_MAX_PODS){
+				intervals[pod - 1] = std::make_pair(open, close);
+			}
+			else{
+				printf("Usage: mission_sim [-n flights] [-j workers] [--seed N] [--pod N=OPEN:CLOSE]... [--scaling]\n"
+					"                   [--trace FILE [--trace-start S] [--trace-length S]]\n");
+				return 1;
+			}
+		}
+
+		//The pods' names and intervals, as the sketch builds them, for the report
+		for(uint8_t i = 0; i != MISSION_MAX_PODS; i++){
+			if(intervals[i].second > 0){
+				_actArray[i].setOpenAltitude(fromMetres(intervals[i].first));
+				_actArray[i].setCloseAltitude(fromMetres(intervals[i].second));
+			}
+		}
+
+		flightResult* results = (flightResult*)mmap(NULL, sizeof(flightResult) * flights, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		if(results == MAP_FAILED){
+			printf("FAILED: no memory for %u flights\n", flights);
+			return 1;
+		}
+
+		//The same flights on 1, 2, 4... workers, up to the most asked for
+		if(scaling){
+			printf("%ld cores online\n", cores);
+			printf("%8s %10s %12s %8s %11s\n", "workers", "wall s", "flights/s", "speedup", "efficiency");
+			double single = 0;
+			for(uint16_t count = 1; count <= workers; count = (count * 2 > workers && count != workers ? workers : count * 2)){
+				double elapsed = runPool(flights, count, seed, intervals, results, false);
+				if(count == 1){ single = elapsed; }
+				printf("%8u %10.2f %12.1f %7.2fx %10.0f%%\n", count, elapsed, flights / elapsed, single / elapsed, 100 * single / elapsed / count);
+			}
+			printf("\n");
+		}
+
+		double elapsed = runPool(flights, workers, seed, intervals, results, traceName != NULL);
+		bool passed = report(results, flights, elapsed, workers);
+		if(!passed){ printf("FAILED: a flight crashed or never landed\n"); }
+		return (passed ? 0 : 1);
+	}
@@ -0,0 +1,108 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Checks HAB_Outbox keeps events whole: a message as long as the sketch's msgPtr
+*				goes out uncut, events that differ only past the old 64 byte slots are both sent,
+*				identical ones are merged, a full text buffer drops the least important events
+*				first, and telemetry that didn't fit in a datagram goes in the next. Exits 1 on
+*				the first check that fails.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Outbox.h>
+	#include <string>
+	#include <vector>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Every line sent to the ground, without the [EVENT] tag and timestamp
+	static std::vector<std::string> sent;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static void capture(const hostDatagram& datagram){
+		std::string packet((const char*)datagram.data, datagram.length);
+		size_t start = 0, end;
+		while((end = packet.find('\n', start)) != std::string::npos){
+			std::string line = packet.substr(start, end - start);
+			size_t stamp = line.find("] ", 7);
+			sent.push_back(stamp == std::string::npos ? line : line.substr(stamp + 2));
+			start = end + 1;
+		}
+	}
+
+	static bool check(bool condition, const char* what){
+		if(!condition){ printf("FAILED: %s\n", what); }
+		return condition;
+	}
+
+	static bool wasSent(const std::string& msg){
+		for(size_t i = 0; i != sent.size(); i++){
+			if(sent[i] == msg){ return true; }
+		}
+		return false;
+	}
+
+
+	int main(){
+		HAB_Host::setNetworkHook(capture);
+		EthernetUDP conn;
+		conn.begin(10027);
+		HAB_Outbox outbox(&conn);
+		outbox.addDestination(IPAddress(172, 20, 3, 240), 54444, true);
+
+		//A 99 character message, and two that only differ at the end
+		std::string full(99, 'A');
+		for(size_t i = 0; i != full.size(); i++){ full[i] = 'A' + i % 26; }
+		std::string first = std::string(60, 'X') + " POD_1", second = std::string(60, 'X') + " POD_2";
+		bool passed = check(outbox.queue(full.c_str(), MSG_INFO), "long event queued");
+		passed &= check(outbox.queue(first.c_str(), MSG_ALARM), "first event queued");
+		passed &= check(outbox.queue(second.c_str(), MSG_ALARM), "second event queued");
+		passed &= check(outbox.queue(first.c_str(), MSG_ALARM) && outbox.getCoalescedCount() == 1, "identical event merged");
+		passed &= check(outbox.getCoalescedCount() == 1, "different events not merged");
+		outbox.flushAll();
+		passed &= check(wasSent(full), "long event sent whole");
+		passed &= check(wasSent(first) && wasSent(second), "both alarms sent");
+		passed &= check(outbox.getQueuedCount() == 0, "queue emptied");
+
+		//Fills the text with information, then alarms take its room
+		sent.clear();
+		uint8_t infos = 0;
+		while(outbox.queue((full + (char)('0' + infos)).c_str(), MSG_INFO)){ infos++; }
+		passed &= check(infos > 0 && infos < OUTBOX_SLOTS, "text buffer fills before the slots");
+		passed &= check(outbox.queue((std::string(90, 'Z') + " ALARM").c_str(), MSG_ALARM), "alarm makes room");
+		passed &= check(outbox.getDroppedCount(MSG_INFO) >= 2, "oldest information dropped");
+		passed &= check(!outbox.queue((full + "!").c_str(), MSG_INFO), "information does not push out information");
+		outbox.flushAll();
+		passed &= check(wasSent(std::string(90, 'Z') + " ALARM"), "alarm sent");
+		passed &= check(!wasSent(full + "0") && wasSent(full + (char)('0' + infos - 1)), "newest information kept");
+
+		//Telemetry left out of a datagram full of alarms waits for the next one
+		sent.clear();
+		std::string telemetry = "TELEMETRY," + std::string(150, 'T');
+		outbox.setTelemetry(0, telemetry.c_str());
+		passed &= check(outbox.queue((std::string(120, 'Y') + " 1").c_str(), MSG_ALARM)
+			&& outbox.queue((std::string(120, 'Y') + " 2").c_str(), MSG_ALARM), "alarms queued");
+		HAB_Host::spend(1000000);
+		outbox.flush();
+		passed &= check(wasSent(std::string(120, 'Y') + " 2") && !wasSent(telemetry) && outbox.hasTelemetry(0),
+			"telemetry kept when it doesn't fit");
+		HAB_Host::spend(1000000);
+		outbox.flush();
+		passed &= check(wasSent(telemetry) && !outbox.hasTelemetry(0), "kept telemetry sent next");
+
+		if(passed){ printf("HAB_Outbox: all checks passed\n"); }
+		return (passed ? 0 : 1);
+	}
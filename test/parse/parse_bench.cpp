@@ -0,0 +1,159 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Packets per second through HAB_Parse, through the sketch's handlePacket, and
+*				through recievePacketsUDP draining the W5100's queue, for the packets the board
+*				gets: PRISM's GPS, the groundstation's heartbeats, and its commands. The parse
+*				rates are the host's, the drain is also timed on the simulated board clock (the
+*				UDP and SPI costs in HAB_Host.h). Exits 1 if a packet is not parsed as sent.
+*
+*				parse_bench [iterations]
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Sketch.h>
+	#include <HAB_Parse.h>
+	#include <chrono>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	struct benchPacket {
+		const char* name;
+		const char* text;
+	};
+
+	static const benchPacket packets[] = {
+		{ "PRISM GPS", "PRISM,1042,17:21:09,POS0,43.009953,-81.273613,18234.56" },
+		{ "Heartbeat", "GROUNDSTATION,HBT" },
+		{ "Command", "GROUNDSTATION,ACT_ENABLE_LOCK" }
+	};
+	static const uint8_t packetCount = sizeof(packets) / sizeof(packets[0]);
+
+	static bool failed = false;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static double hostSeconds(){
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static void check(bool condition, const char* what){
+		if(!condition){
+			printf("FAILED: %s\n", what);
+			failed = true;
+		}
+	}
+
+	static void report(const char* stage, const char* packet, double seconds, uint32_t count){
+		printf("%-20s %-12s %9.0f ns %12.0f packets/s\n", stage, packet, seconds * 1e9 / count, count / seconds);
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		tokenize																|
+	|	Purpose: 	HAB_Parse on its own: every field of a copy of the packet, with the		|
+	|				numbers parsed as handlePacket would. Returns the sum of the numbers.	|
+	|	Arguments:	const char*, char* (buffer), uint16_t (length)							|
+	|	Returns:	int32_t																	|
+	\*-------------------------------------------------------------------------------------*/
+		static int32_t tokenize(const char* text, char* buffer, uint16_t length){
+			memcpy(buffer, text, length + 1);
+			HAB_Cursor cursor = HAB_Parse::begin(buffer, length);
+			HAB_Token field;
+			int32_t value, sum = 0;
+			while(HAB_Parse::next(cursor, FIELD_DELIMITER[0], field)){
+				if(HAB_Parse::parseFixed(field, 6, value)){ sum += value; }
+				else{ HAB_Parse::toUpper(field); }
+			}
+			return sum;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		queuePackets															|
+	|	Purpose: 	Sends the board as many copies of a packet as recievePacketsUDP takes	|
+	|				in one call, from the first groundstation (or PRISM).					|
+	|	Arguments:	const benchPacket&														|
+	|	Returns:	uint8_t (how many)														|
+	\*-------------------------------------------------------------------------------------*/
+		static uint8_t queuePackets(const benchPacket& packet){
+			bool prism = !strncmp(packet.text, PRISM_NAME, strlen(PRISM_NAME));
+			IPAddress from = (prism ? IPAddress(PRISM_IP_O1, PRISM_IP_O2, PRISM_IP_O3, PRISM_IP_O4) : IPAddress(GS1_IP_O1, GS1_IP_O2, GS1_IP_O3, GS1_IP_O4));
+			uint8_t count = min((size_t)RECEIVE_MAX_PACKETS, HOST_UDP_RX_BUFFER / (strlen(packet.text) + 8));
+			for(uint8_t i = 0; i != count; i++){
+				HAB_Host::sendToBoard(from, (prism ? PRISM_PORT : GS1_PORT), LOCAL_PORT, packet.text, strlen(packet.text));
+			}
+			return count;
+		}
+
+
+	int main(int argc, char** argv){
+		uint32_t iterations = (argc > 1 ? strtoul(argv[1], NULL, 10) : 200000);
+		char buffer[UDP_TX_PACKET_MAX_SIZE];
+
+		//----------------------------------------------------------\
+		//HAB_Parse-------------------------------------------------|
+			volatile int32_t sink = 0;
+			for(uint8_t p = 0; p != packetCount; p++){
+				uint16_t length = strlen(packets[p].text);
+				double start = hostSeconds();
+				for(uint32_t i = 0; i != iterations; i++){ sink += tokenize(packets[p].text, buffer, length); }
+				report("HAB_Parse", packets[p].name, hostSeconds() - start, iterations);
+			}
+
+		//----------------------------------------------------------\
+		//The sketch------------------------------------------------|
+			//Brought up as on the pad, the subsystems missing from the host (GPS, pods) go late
+			setup();
+			check(_outbox != NULL, "setup ran");
+
+			//handlePacket on its own, without the command (which queues its acknowledgement). PRISM's fix
+			//starts cleared, so a field read from the wrong place fails the check below.
+			_CSAGPSreadings.latitude = MicroDegrees(0);
+			_CSAGPSreadings.longitude = MicroDegrees(0);
+			_CSAGPSreadings.altitude = Centimetres(0);
+			for(uint8_t p = 0; p != 2; p++){
+				uint16_t length = strlen(packets[p].text);
+				double start = hostSeconds();
+				for(uint32_t i = 0; i != iterations; i++){
+					memcpy(buffer, packets[p].text, length + 1);
+					handlePacket(buffer, length);
+				}
+				report("handlePacket", packets[p].name, hostSeconds() - start, iterations);
+			}
+			check(_CSAGPSreadings.latitude.value() == 43009953 && _CSAGPSreadings.longitude.value() == -81273613
+				&& _CSAGPSreadings.altitude.value() == 1823456, "PRISM's GPS parsed");
+			check(!noConnection, "heartbeat connected");
+
+			//recievePacketsUDP draining a full call's worth each time, on both clocks. Commands are logged
+			//to the card, so they can take more than one call's time budget.
+			for(uint8_t p = 0; p != packetCount; p++){
+				uint32_t rounds = max(1UL, iterations / (20 * RECEIVE_MAX_PACKETS)), count = 0;
+				uint64_t boardTime = 0;
+				double hostTime = 0;
+				for(uint32_t r = 0; r != rounds; r++){
+					uint8_t queued = queuePackets(packets[p]);
+					uint64_t boardStart = HAB_Host::getMicros();
+					double start = hostSeconds();
+					while(HAB_Host::getBoardBuffered(LOCAL_PORT)){ recievePacketsUDP(); }
+					hostTime += hostSeconds() - start;
+					boardTime += HAB_Host::getMicros() - boardStart;
+					count += queued;
+					_outbox->flush();
+				}
+				report("recievePacketsUDP", packets[p].name, hostTime, count);
+				report("  on the board", packets[p].name, boardTime / 1e6, count);
+			}
+
+		return (failed ? 1 : 0);
+	}
@@ -0,0 +1,73 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The sketch's entry points and the globals the host drivers reach into, from the
+*				host build of flight_software_manual.ino (converted by tools/ino2cpp.py). The
+*				libraries are included in the sketch's order, HAB_Definitions last, so the drivers
+*				see the same definitions the sketch was built with.
+*/
+
+
+#ifndef HAB_Sketch_h
+#define HAB_Sketch_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Actuator.h>
+	#include <HAB_BME280.h>
+	#include <HAB_Burst.h>
+	#include <HAB_Calibration.h>
+	#include <HAB_GPS.h>
+	#include <HAB_Link.h>
+	#include <HAB_Outbox.h>
+	#include <HAB_Phase.h>
+	#include <HAB_Startup.h>
+	#include <HAB_Logging.h>
+	#include <Ethernet.h>
+	#include <EthernetUdp.h>
+	#include <HAB_Structs.h>
+	#include <HAB_Definitions.h>
+	#include <HAB_Profile.h>
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	void setup();
+	void loop();
+	void recievePacketsUDP();
+	void handlePacket(char* packet, uint16_t len);
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	extern EthernetUDP _conn;
+	extern char rcvBuffer[UDP_TX_PACKET_MAX_SIZE];
+	extern bool noConnection;
+	extern unsigned long lastHeartbeat;
+
+	extern HAB_Phase* _phase;
+	extern HAB_Startup* _startup;
+	extern HAB_Outbox* _outbox;
+	extern HAB_BME280 _bme;
+	extern HAB_GPS* _gps;
+	extern GPSReadings _HABGPSreadings;
+	extern GPSReadings _CSAGPSreadings;
+
+	extern HAB_Calibration* _calibration;
+	extern HAB_Burst* _burst;
+	extern HAB_Link* _link;
+	extern HAB_Actuator _actArray[];
+	extern uint8_t act_arr_len;
+	extern uint8_t activeIndex;
+
+#endif
@@ -0,0 +1,53 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	Checks HAB_Sleep::idle leaves the board as it found it: the SPI set up as the
+*				Ethernet and SD libraries left it (the host's power_spi_enable clears it, as
+*				gating can on the board), the ADC enabled, and no module's clock gated. Exits 1
+*				on the first check that fails.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Sleep.h>
+	#include <SPI.h>
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static void check(bool condition, const char* what){
+		if(!condition){
+			printf("FAILED: %s\n", what);
+			exit(1);
+		}
+		printf("ok: %s\n", what);
+	}
+
+
+	int main(){
+		//Master at twice the clock, as the W5100 library sets it
+		SPI.begin();
+		SPSR |= _BV(SPI2X);
+		uint8_t spiControl = SPCR, spiStatus = SPSR, adc = ADCSRA;
+
+		unsigned long start = millis();
+		HAB_Sleep::idle(20);
+		check(millis() - start >= 20, "slept its time");
+		check(SPCR == spiControl, "SPI control register restored");
+		check(SPSR == spiStatus, "SPI double speed restored");
+		check(ADCSRA == adc, "ADC enabled again");
+		check(PRR0 == 0, "no module left gated");
+
+		//Nothing to sleep, nothing touched
+		SPCR = 0;
+		HAB_Sleep::idle(0);
+		check(SPCR == 0, "a zero idle leaves the SPI alone");
+
+		return 0;
+	}
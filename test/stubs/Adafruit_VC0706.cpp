@@ -0,0 +1,115 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for the VC0706 camera library, see Adafruit_VC0706.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Adafruit_VC0706.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	static bool cameraPresent = true;
+
+	//us a byte at 38400 baud
+	static const uint32_t BYTE_TIME = 260;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	void HAB_Host::setCameraPresent(bool present){
+		cameraPresent = present;
+	}
+	bool HAB_Host::isCameraPresent(){
+		return cameraPresent;
+	}
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		exchange																|
+	|	Purpose: 	The time of a 5 byte command and its reply on the serial line.			|
+	|	Arguments:	uint8_t																	|
+	|	Returns:	bool (false if there is no camera)										|
+	\*-------------------------------------------------------------------------------------*/
+		bool Adafruit_VC0706::exchange(uint8_t replyLength){
+			HAB_Host::spend((5 + replyLength) * BYTE_TIME);
+			return cameraPresent;
+		}
+
+	bool Adafruit_VC0706::begin(uint16_t baud){
+		return reset();
+	}
+
+	bool Adafruit_VC0706::reset(){
+		frozen = false;
+		frameLeft = 0;
+		return exchange(5);
+	}
+
+	char* Adafruit_VC0706::getVersion(){
+		if(!exchange(16)){ return NULL; }
+		strcpy((char*)buffer, "VC0703 1.00");
+		return (char*)buffer;
+	}
+
+	bool Adafruit_VC0706::setImageSize(uint8_t size){
+		imageSize = size;
+		return exchange(5);
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		takePicture																|
+	|	Purpose: 	Freezes a frame, of about the length the size gives in flight.			|
+	|	Arguments:	void																	|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		bool Adafruit_VC0706::takePicture(){
+			if(!exchange(5)){ return false; }
+			HAB_Host::spend(50000); //Compression
+			frozen = true;
+			frameSize = (imageSize == VC0706_640x480 ? 48000 : (imageSize == VC0706_320x240 ? 14000 : 4200));
+			frameSize += (HAB_Host::getMicros() / 1000) % 512;
+			frameLeft = frameSize;
+			return true;
+		}
+
+	bool Adafruit_VC0706::resumeVideo(){
+		frozen = false;
+		return exchange(5);
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		readPicture																|
+	|	Purpose: 	The next n bytes of the frame: a JPEG start, filler, and its end.		|
+	|	Arguments:	uint8_t																	|
+	|	Returns:	uint8_t* (NULL past the end or without a frame)							|
+	\*-------------------------------------------------------------------------------------*/
+		uint8_t* Adafruit_VC0706::readPicture(uint8_t n){
+			if(!frozen || n > sizeof(buffer) || !exchange(n + 5)){ return NULL; }
+			for(uint8_t i = 0; i != n; i++){
+				uint32_t offset = frameSize - frameLeft + i;
+				if(offset == 0){ buffer[i] = 0xFF; }
+				else if(offset == 1){ buffer[i] = 0xD8; }
+				else if(offset == frameSize - 2){ buffer[i] = 0xFF; }
+				else if(offset == frameSize - 1){ buffer[i] = 0xD9; }
+				else { buffer[i] = (uint8_t)(offset * 2654435761UL >> 24); }
+			}
+			frameLeft = (n < frameLeft ? frameLeft - n : 0);
+			return buffer;
+		}
@@ -0,0 +1,60 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the VC0706 camera library. A capture holds a made up JPEG
+*				of the size's usual length, read out at the camera's 38400 baud.
+*/
+
+
+#ifndef Adafruit_VC0706_h
+#define Adafruit_VC0706_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include "SoftwareSerial.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define VC0706_640x480 0x00
+	#define VC0706_320x240 0x11
+	#define VC0706_160x120 0x22
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	class Adafruit_VC0706 {
+		public:
+			Adafruit_VC0706(SoftwareSerial* serial){}
+
+			bool begin(uint16_t baud = 38400);
+			bool reset();
+			char* getVersion();
+			bool setImageSize(uint8_t size);
+			uint8_t getImageSize(){ return imageSize; }
+			bool takePicture();
+			bool resumeVideo();
+			uint32_t frameLength(){ return frameLeft; }
+			uint8_t* readPicture(uint8_t n);
+
+		private:
+			bool exchange(uint8_t replyLength);
+
+			uint8_t imageSize = VC0706_640x480;
+			bool frozen = false;
+			uint32_t frameSize = 0, frameLeft = 0;
+			uint8_t buffer[100];
+	};
+
+#endif
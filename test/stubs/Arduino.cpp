@@ -0,0 +1,310 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for the Arduino Mega core, see Arduino.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include "HAB_Trace.h"
+	#include <chrono>
+	#include <thread>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	volatile uint8_t PORTA = 0, PORTC = 0, DDRA = 0, DDRC = 0, PINA = 0, PINC = 0;
+	volatile uint8_t SREG = 0x80, ADCSRA = _BV(ADEN), SPCR = 0, SPSR = 0, PRR0 = 0;
+	uint16_t SP = 0x21FF;
+	char* __brkval = NULL;
+	char __heap_start = 0;
+
+	HardwareSerial Serial(0), Serial1(1), Serial2(2), Serial3(3);
+
+	//What a port waiting on its transmit queue is called on the trace
+	static const char* const waitNames[] = { "Serial wait", "Serial1 wait", "Serial2 wait", "Serial3 wait" };
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Clock---------------------------------------------------------------------------|
+
+		unsigned long millis(){
+			HAB_Host::spend(HOST_CLOCK_READ_US);
+			return (unsigned long)(HAB_Host::getMicros() / 1000);
+		}
+
+		unsigned long micros(){
+			HAB_Host::spend(HOST_CLOCK_READ_US);
+			return (unsigned long)HAB_Host::getMicros();
+		}
+
+		void delay(unsigned long ms){
+			uint64_t end = HAB_Host::getMicros() + (uint64_t)ms * 1000;
+			while(HAB_Host::getMicros() < end){
+				uint64_t before = HAB_Host::getMicros(), left = end - before;
+				HAB_Host::spend((uint32_t)min(left, (uint64_t)1000000));
+				if(HAB_Host::getMicros() == before){
+					//Real time only, the clock did not move on its own
+					std::this_thread::sleep_for(std::chrono::microseconds(min(left, (uint64_t)1000)));
+				}
+			}
+		}
+
+		void delayMicroseconds(unsigned int us){
+			HAB_Host::spend(us);
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//Pins----------------------------------------------------------------------------|
+
+		void pinMode(uint8_t pin, uint8_t mode){
+			if(mode == INPUT_PULLUP){ HAB_Host::setPin(pin, HIGH); }
+		}
+
+		void digitalWrite(uint8_t pin, uint8_t value){
+			HAB_Host::setPin(pin, value != LOW);
+		}
+
+		int digitalRead(uint8_t pin){
+			return (HAB_Host::getPin(pin) ? HIGH : LOW);
+		}
+
+		int analogRead(uint8_t pin){
+			if(pin < A0){ pin += A0; }
+			HAB_Host::spend(HOST_ANALOG_READ_US);
+			return HAB_Host::readAnalog(pin);
+		}
+
+		void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode){}
+
+
+	//--------------------------------------------------------------------------------\
+	//AVR C library-------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		ultoa, utoa, ltoa, itoa													|
+		|	Purpose: 	Number to text in a radix from 2 to 36, lower case. As in the AVR C		|
+		|				library, only radix 10 gives a sign.									|
+		|	Arguments:	value, char*, int														|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* ultoa(unsigned long value, char* buffer, int radix){
+				char digits[sizeof(unsigned long) * 8 + 1];
+				uint8_t count = 0;
+				if(radix < 2 || radix > 36){
+					buffer[0] = '\0';
+					return buffer;
+				}
+				do {
+					uint8_t digit = value % radix;
+					digits[count++] = (digit < 10 ? '0' + digit : 'a' + digit - 10);
+					value /= radix;
+				} while(value);
+				for(uint8_t i = 0; i != count; i++){ buffer[i] = digits[count - 1 - i]; }
+				buffer[count] = '\0';
+				return buffer;
+			}
+
+			char* utoa(unsigned int value, char* buffer, int radix){
+				return ultoa(value, buffer, radix);
+			}
+
+			char* ltoa(long value, char* buffer, int radix){
+				if(radix == 10 && value < 0){
+					buffer[0] = '-';
+					ultoa(-(unsigned long)value, buffer + 1, radix);
+					return buffer;
+				}
+				return ultoa((unsigned long)value, buffer, radix);
+			}
+
+			char* itoa(int value, char* buffer, int radix){
+				if(radix == 10){ return ltoa(value, buffer, radix); }
+				return ultoa((unsigned int)value, buffer, radix);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		dtostrf																	|
+		|	Purpose: 	A double as text with a width (negative to left align) and precision.	|
+		|	Arguments:	double, signed char, unsigned char, char*								|
+		|	Returns:	char*																	|
+		\*-------------------------------------------------------------------------------------*/
+			char* dtostrf(double value, signed char width, unsigned char precision, char* buffer){
+				sprintf(buffer, "%*.*f", width, precision, value);
+				return buffer;
+			}
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Print---------------------------------------------------------------------------|
+
+		size_t Print::write(const uint8_t* buffer, size_t size){
+			size_t written = 0;
+			while(size--){
+				if(!write(*buffer++)){ break; }
+				written++;
+			}
+			return written;
+		}
+
+		size_t Print::print(long value, int base){
+			char text[sizeof(long) * 8 + 2];
+			if(base == 0){ return write((uint8_t)value); }
+			if(base == 10){ return write(ltoa(value, text, 10)); }
+			return write(ultoa((unsigned long)value, text, base));
+		}
+
+		size_t Print::print(unsigned long value, int base){
+			char text[sizeof(long) * 8 + 1];
+			if(base == 0){ return write((uint8_t)value); }
+			return write(ultoa(value, text, (base < 2 ? 10 : base)));
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		print (double)															|
+		|	Purpose: 	As the core's printFloat: rounds half up at the last digit, and prints	|
+		|				"nan", "inf" or "ovf" past what an unsigned long holds.					|
+		|	Arguments:	double, int																|
+		|	Returns:	size_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			size_t Print::print(double value, int digits){
+				if(isnan(value)){ return write("nan"); }
+				if(isinf(value)){ return write("inf"); }
+				if(value > 4294967040.0 || value < -4294967040.0){ return write("ovf"); }
+
+				size_t n = 0;
+				if(value < 0.0){
+					n += write((uint8_t)'-');
+					value = -value;
+				}
+
+				double rounding = 0.5;
+				for(int i = 0; i < digits; i++){ rounding /= 10.0; }
+				value += rounding;
+
+				unsigned long whole = (unsigned long)value;
+				double remainder = value - (double)whole;
+				n += print(whole);
+				if(digits > 0){ n += write((uint8_t)'.'); }
+				while(digits-- > 0){
+					remainder *= 10.0;
+					unsigned int digit = (unsigned int)remainder;
+					n += print(digit);
+					remainder -= digit;
+				}
+				return n;
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//HardwareSerial------------------------------------------------------------------|
+
+		HardwareSerial::HardwareSerial(uint8_t number) : number(number){}
+
+		void HardwareSerial::begin(unsigned long baud){
+			byteTime = (uint32_t)(10000000UL / baud); //10 bits a byte
+			reset();
+		}
+
+		void HardwareSerial::reset(){
+			txDoneAt = 0;
+			incomingHead = incomingCount = 0;
+			rxHead = rxCount = 0;
+			overruns = 0;
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		receive																	|
+		|	Purpose: 	Moves the bytes that have arrived by now into the receive buffer, as	|
+		|				its interrupt would have. A full buffer loses them.						|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HardwareSerial::receive(){
+				uint64_t now = HAB_Host::getMicros();
+				while(incomingCount && arrival[incomingHead] <= now){
+					if(rxCount == RX_SIZE){ overruns++; }
+					else { rx[(rxHead + rxCount++) % RX_SIZE] = incoming[incomingHead]; }
+					incomingHead = (incomingHead + 1) % INCOMING_SIZE;
+					incomingCount--;
+				}
+			}
+
+		void HardwareSerial::feed(const uint8_t* data, size_t length){
+			uint64_t next = HAB_Host::getMicros();
+			if(incomingCount){
+				uint64_t last = arrival[(incomingHead + incomingCount - 1) % INCOMING_SIZE];
+				if(last > next){ next = last; }
+			}
+			for(size_t i = 0; i != length && incomingCount != INCOMING_SIZE; i++){
+				next += byteTime;
+				size_t slot = (incomingHead + incomingCount++) % INCOMING_SIZE;
+				incoming[slot] = data[i];
+				arrival[slot] = next;
+			}
+		}
+
+		int HardwareSerial::available(){
+			receive();
+			return (int)rxCount;
+		}
+
+		int HardwareSerial::peek(){
+			receive();
+			return (rxCount ? rx[rxHead] : -1);
+		}
+
+		int HardwareSerial::read(){
+			receive();
+			if(!rxCount){ return -1; }
+			uint8_t b = rx[rxHead];
+			rxHead = (rxHead + 1) % RX_SIZE;
+			rxCount--;
+			return b;
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		write																	|
+		|	Purpose: 	Queues a byte to leave at the baud rate, waiting while 64 are queued.	|
+		|	Arguments:	uint8_t																	|
+		|	Returns:	size_t																	|
+		\*-------------------------------------------------------------------------------------*/
+			size_t HardwareSerial::write(uint8_t b){
+				uint64_t now = HAB_Host::getMicros();
+				if(txDoneAt > now + (uint64_t)RX_SIZE * byteTime){
+					hostSpan span(waitNames[number], "uart");
+					HAB_Host::spend((uint32_t)(txDoneAt - now - (uint64_t)RX_SIZE * byteTime));
+					now = HAB_Host::getMicros();
+				}
+				txDoneAt = max(txDoneAt, now) + byteTime;
+
+				if(number == 0 && HAB_Host::getEcho()){ putchar(b); }
+				if(hook){ hook(b); }
+				return 1;
+			}
+
+		void HardwareSerial::flush(){
+			uint64_t now = HAB_Host::getMicros();
+			if(txDoneAt > now){
+				hostSpan span(waitNames[number], "uart");
+				HAB_Host::spend((uint32_t)(txDoneAt - now));
+			}
+		}
@@ -0,0 +1,232 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the Arduino Mega core: the clock, pins, ADC and serial ports,
+*				Print and Stream, the AVR C library's number formatting, and the registers the
+*				libraries write. The clock and peripherals are simulated, see HAB_Host.h.
+*/
+
+
+#ifndef Arduino_h
+#define Arduino_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <stdint.h>
+	#include <stddef.h>
+	#include <string.h>
+	#include <stdlib.h>
+	#include <stdio.h>
+	#include <math.h>
+	#include <ctype.h>
+	#include <type_traits>
+	#include "HAB_Host.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef F_CPU
+		#define F_CPU 16000000UL
+	#endif
+
+	typedef uint8_t byte;
+	typedef bool boolean;
+
+	#define HIGH 1
+	#define LOW 0
+	#define INPUT 0
+	#define OUTPUT 1
+	#define INPUT_PULLUP 2
+	#define CHANGE 1
+	#define FALLING 2
+	#define RISING 3
+
+	//Mega analog pins
+	#define A0 54
+	#define A1 55
+	#define A2 56
+	#define A3 57
+	#define A4 58
+	#define A5 59
+	#define A6 60
+	#define A7 61
+	#define A8 62
+	#define A9 63
+	#define A10 64
+	#define A11 65
+	#define A12 66
+	#define A13 67
+	#define A14 68
+	#define A15 69
+
+	#define DEC 10
+	#define HEX 16
+	#define BIN 2
+	#define DEG_TO_RAD 0.017453292519943295
+	#define RAD_TO_DEG 57.29577951308232
+
+	//Flash reads are plain reads on the host
+	#define PROGMEM
+	#define PSTR(s) (s)
+	#define F(s) (s)
+	#define pgm_read_byte(p) (*(const uint8_t*)(p))
+	#define pgm_read_word(p) (*(const uint16_t*)(p))
+	#define pgm_read_dword(p) (*(const uint32_t*)(p))
+
+	#define _BV(bit) (1 << (bit))
+	#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+	#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : ((p) >= 18 && (p) <= 21 ? 23 - (p) : -1)))
+	#define noInterrupts() cli()
+	#define interrupts() sei()
+
+	//The core's min and max are macros, these take the same mixed types
+	template <class A, class B> inline typename std::common_type<A, B>::type min(A a, B b){ return (a < b ? a : b); }
+	template <class A, class B> inline typename std::common_type<A, B>::type max(A a, B b){ return (a > b ? a : b); }
+
+	//Registers the libraries write, plain bytes on the host
+	extern volatile uint8_t PORTA, PORTC, DDRA, DDRC, PINA, PINC;
+	extern volatile uint8_t SREG, ADCSRA, SPCR, SPSR, PRR0;
+	extern uint16_t SP;
+	#define ADEN 7
+	#define SPE 6
+	#define MSTR 4
+	#define SPI2X 0
+	#define PRSPI 2
+	#define PRADC 0
+
+	//Heap and stack markers from the AVR C library, only HAB_Profile reads them
+	extern char* __brkval;
+	extern char __heap_start;
+
+	inline void cli(){ SREG &= 0x7F; }
+	inline void sei(){ SREG |= 0x80; }
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//Clock
+	unsigned long millis();
+	unsigned long micros();
+	void delay(unsigned long ms);
+	void delayMicroseconds(unsigned int us);
+
+	//Pins
+	void pinMode(uint8_t pin, uint8_t mode);
+	void digitalWrite(uint8_t pin, uint8_t value);
+	int digitalRead(uint8_t pin);
+	int analogRead(uint8_t pin);
+	void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode);
+
+	//AVR C library
+	char* itoa(int value, char* buffer, int radix);
+	char* ltoa(long value, char* buffer, int radix);
+	char* utoa(unsigned int value, char* buffer, int radix);
+	char* ultoa(unsigned long value, char* buffer, int radix);
+	char* dtostrf(double value, signed char width, unsigned char precision, char* buffer);
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		Print																	|
+	|	Purpose: 	Text output as the core formats it, on top of a byte write.				|
+	\*-------------------------------------------------------------------------------------*/
+	class Print {
+		public:
+			virtual ~Print(){}
+			virtual size_t write(uint8_t b) = 0;
+			virtual size_t write(const uint8_t* buffer, size_t size);
+			size_t write(const char* text){ return (text ? write((const uint8_t*)text, strlen(text)) : 0); }
+			size_t write(const char* buffer, size_t size){ return write((const uint8_t*)buffer, size); }
+			virtual void flush(){}
+
+			size_t print(const char* text){ return write(text); }
+			size_t print(char c){ return write((uint8_t)c); }
+			size_t print(unsigned char value, int base = DEC){ return print((unsigned long)value, base); }
+			size_t print(int value, int base = DEC){ return print((long)value, base); }
+			size_t print(unsigned int value, int base = DEC){ return print((unsigned long)value, base); }
+			size_t print(long value, int base = DEC);
+			size_t print(unsigned long value, int base = DEC);
+			size_t print(double value, int digits = 2);
+
+			size_t println(){ return write("\r\n"); }
+			template <class T> size_t println(T value){ size_t n = print(value); return n + println(); }
+			template <class T> size_t println(T value, int format){ size_t n = print(value, format); return n + println(); }
+	};
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		Stream																	|
+	|	Purpose: 	Input on top of Print.													|
+	\*-------------------------------------------------------------------------------------*/
+	class Stream : public Print {
+		public:
+			virtual int available() = 0;
+			virtual int read() = 0;
+			virtual int peek() = 0;
+	};
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		HardwareSerial															|
+	|	Purpose: 	A UART with the core's 64 byte buffers. Output leaves at the baud rate	|
+	|				and a write waits while the buffer is full. Input arrives at the baud	|
+	|				rate from HAB_Host::feedSerial, bytes are lost once the buffer is full.	|
+	\*-------------------------------------------------------------------------------------*/
+	class HardwareSerial : public Stream {
+		public:
+			HardwareSerial(uint8_t number);
+
+			void begin(unsigned long baud);
+			void end(){}
+			int available();
+			int read();
+			int peek();
+			size_t write(uint8_t b);
+			using Print::write;
+			void flush();
+			operator bool(){ return true; }
+
+			uint8_t getNumber(){ return number; }
+			uint32_t getOverruns(){ return overruns; }
+			uint32_t getByteTime(){ return byteTime; }
+
+			//Used by HAB_Host
+			void feed(const uint8_t* data, size_t length);
+			void setHook(void (*hook)(uint8_t b)){ this->hook = hook; }
+			void reset();
+
+		private:
+			void receive();
+
+			uint8_t number;
+			uint32_t byteTime = 1042; //us, 9600 baud
+			uint64_t txDoneAt = 0; //When the last byte written has left
+
+			//Bytes on the way in, with when each arrives, and the receive buffer
+			static const size_t RX_SIZE = 64;
+			static const size_t INCOMING_SIZE = 4096;
+			uint8_t incoming[INCOMING_SIZE];
+			uint64_t arrival[INCOMING_SIZE];
+			size_t incomingHead = 0, incomingCount = 0;
+			uint8_t rx[RX_SIZE];
+			size_t rxHead = 0, rxCount = 0;
+			uint32_t overruns = 0;
+
+			void (*hook)(uint8_t b) = NULL;
+	};
+
+	extern HardwareSerial Serial, Serial1, Serial2, Serial3;
+
+#endif
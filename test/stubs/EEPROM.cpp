@@ -0,0 +1,9 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in's EEPROM, see EEPROM.h.
+*/
+
+	#include "EEPROM.h"
+
+	EEPROMClass EEPROM;
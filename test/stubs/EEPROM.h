@@ -0,0 +1,44 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the EEPROM library: the Mega's 4KB, erased (0xFF) at the start.
+*				Each byte put changes costs an erase and write.
+*/
+
+
+#ifndef EEPROM_h
+#define EEPROM_h
+
+	#include "Arduino.h"
+
+	class EEPROMClass {
+		public:
+			EEPROMClass(){ memset(bytes, 0xFF, sizeof(bytes)); }
+
+			uint8_t read(int address){ return bytes[address]; }
+			void write(int address, uint8_t value){
+				HAB_Host::spend(HOST_EEPROM_WRITE_US);
+				bytes[address] = value;
+			}
+			void update(int address, uint8_t value){
+				if(bytes[address] != value){ write(address, value); }
+			}
+			uint16_t length(){ return sizeof(bytes); }
+
+			template <class T> T& get(int address, T& value){
+				memcpy(&value, bytes + address, sizeof(T));
+				return value;
+			}
+			template <class T> const T& put(int address, const T& value){
+				const uint8_t* data = (const uint8_t*)&value;
+				for(size_t i = 0; i != sizeof(T); i++){ update(address + i, data[i]); }
+				return value;
+			}
+
+		private:
+			uint8_t bytes[4096];
+	};
+
+	extern EEPROMClass EEPROM;
+
+#endif
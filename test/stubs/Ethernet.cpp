@@ -0,0 +1,285 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for the Ethernet library, see Ethernet.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Ethernet.h"
+	#include "HAB_Trace.h"
+	#include <deque>
+	#include <map>
+	#include <sys/socket.h>
+	#include <netinet/in.h>
+	#include <arpa/inet.h>
+	#include <unistd.h>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	EthernetClass Ethernet;
+
+	static bool sockets = false;
+	static bool hardware = true;
+	static void (*networkHook)(const hostDatagram& datagram) = NULL;
+
+	//Datagrams waiting for the board, and the bytes each open port's buffer holds. Never freed, the
+	//sketch's global sockets are closed after the statics here would be destroyed.
+	static std::deque<hostDatagram>& inbound = *new std::deque<hostDatagram>();
+	static std::map<uint16_t, size_t>& portBuffered = *new std::map<uint16_t, size_t>();
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Host----------------------------------------------------------------------------|
+
+		void HAB_Host::setSockets(bool sockets){
+			::sockets = sockets;
+		}
+		bool HAB_Host::getSockets(){
+			return sockets;
+		}
+		void HAB_Host::setNetworkHook(void (*hook)(const hostDatagram& datagram)){
+			networkHook = hook;
+		}
+		bool HAB_Host::hasNetworkHardware(){
+			return hardware;
+		}
+		void HAB_Host::setNetworkHardware(bool present){
+			hardware = present;
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sendToBoard																|
+		|	Purpose: 	A datagram from a ground station (ip, port) to one of the board's		|
+		|				ports. Lost if the port isn't open or its buffer is full, as on the		|
+		|				W5100 (each datagram takes an 8 byte header there too).				|
+		|	Arguments:	IPAddress, uint16_t, uint16_t, char*, uint16_t							|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::sendToBoard(const IPAddress& ip, uint16_t port, uint16_t localPort, const char* data, uint16_t length){
+				if(sockets){
+					int fd = socket(AF_INET, SOCK_DGRAM, 0);
+					sockaddr_in from = {}, to = {};
+					from.sin_family = to.sin_family = AF_INET;
+					from.sin_addr.s_addr = to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+					from.sin_port = htons(port);
+					to.sin_port = htons(localPort);
+					int reuse = 1;
+					setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+					bind(fd, (sockaddr*)&from, sizeof(from));
+					sendto(fd, data, length, 0, (sockaddr*)&to, sizeof(to));
+					close(fd);
+					return;
+				}
+
+				std::map<uint16_t, size_t>::iterator open = portBuffered.find(localPort);
+				if(open == portBuffered.end() || length > sizeof(hostDatagram::data) || open->second + length + 8 > HOST_UDP_RX_BUFFER){ return; }
+				open->second += length + 8;
+
+				hostDatagram datagram;
+				for(uint8_t i = 0; i != 4; i++){ datagram.ip[i] = ip[i]; }
+				datagram.port = port;
+				datagram.localPort = localPort;
+				datagram.length = length;
+				memcpy(datagram.data, data, length);
+				inbound.push_back(datagram);
+			}
+
+			size_t HAB_Host::getBoardBuffered(uint16_t localPort){
+				std::map<uint16_t, size_t>::iterator open = portBuffered.find(localPort);
+				return (open == portBuffered.end() ? 0 : open->second);
+			}
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//EthernetClass-------------------------------------------------------------------|
+
+		EthernetHardwareStatus EthernetClass::hardwareStatus(){
+			HAB_Host::spend(4 * HOST_SPI_BYTE_US);
+			return (hardware ? EthernetW5100 : EthernetNoHardware);
+		}
+
+		EthernetLinkStatus EthernetClass::linkStatus(){
+			return (hardware ? LinkON : Unknown);
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//EthernetUDP---------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		begin, stop																|
+		|	Purpose: 	Opens the socket on a local port. With real sockets it is bound on		|
+		|				the loopback address.													|
+		|	Arguments:	uint16_t																|
+		|	Returns:	uint8_t (1 if opened)													|
+		\*-------------------------------------------------------------------------------------*/
+			uint8_t EthernetUDP::begin(uint16_t port){
+				stop();
+				if(!hardware){ return 0; }
+				HAB_Host::spend(HOST_UDP_PACKET_US);
+
+				if(sockets){
+					socketFd = socket(AF_INET, SOCK_DGRAM, 0);
+					sockaddr_in local = {};
+					local.sin_family = AF_INET;
+					local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+					local.sin_port = htons(port);
+					int reuse = 1;
+					setsockopt(socketFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+					if(socketFd < 0 || bind(socketFd, (sockaddr*)&local, sizeof(local)) != 0){
+						stop();
+						return 0;
+					}
+				}
+				else { portBuffered[port] = 0; }
+
+				localPort = port;
+				return 1;
+			}
+
+			void EthernetUDP::stop(){
+				if(socketFd >= 0){ close(socketFd); }
+				socketFd = -1;
+				if(localPort){ portBuffered.erase(localPort); }
+				localPort = 0;
+				inLength = inPos = 0;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		beginPacket, write, endPacket											|
+		|	Purpose: 	Builds a datagram and sends it, the bytes cross the SPI bus as they		|
+		|				are written. With real sockets it goes to the loopback address.			|
+		|	Arguments:	IPAddress, uint16_t / uint8_t / uint8_t*, size_t						|
+		|	Returns:	int (1 if started or sent), size_t										|
+		\*-------------------------------------------------------------------------------------*/
+			int EthernetUDP::beginPacket(IPAddress ip, uint16_t port){
+				if(!localPort){ return 0; }
+				HAB_Host::spend(8 * HOST_SPI_BYTE_US);
+				destAddress = ip;
+				destPort = port;
+				outLength = 0;
+				writing = true;
+				return 1;
+			}
+
+			size_t EthernetUDP::write(uint8_t b){
+				return write(&b, 1);
+			}
+
+			size_t EthernetUDP::write(const uint8_t* buffer, size_t size){
+				if(!writing){ return 0; }
+				size = min(size, sizeof(out) - outLength);
+				memcpy(out + outLength, buffer, size);
+				outLength += size;
+				hostSpan span("UDP write", "udp");
+				HAB_Host::spend(size * HOST_SPI_BYTE_US);
+				return size;
+			}
+
+			int EthernetUDP::endPacket(){
+				if(!writing){ return 0; }
+				writing = false;
+				{
+					hostSpan span("UDP send", "udp");
+					HAB_Host::spend(HOST_UDP_PACKET_US);
+				}
+
+				if(sockets){
+					sockaddr_in to = {};
+					to.sin_family = AF_INET;
+					to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+					to.sin_port = htons(destPort);
+					return (sendto(socketFd, out, outLength, 0, (sockaddr*)&to, sizeof(to)) == (ssize_t)outLength);
+				}
+
+				if(networkHook){
+					hostDatagram datagram;
+					for(uint8_t i = 0; i != 4; i++){ datagram.ip[i] = destAddress[i]; }
+					datagram.port = destPort;
+					datagram.localPort = localPort;
+					datagram.length = outLength;
+					memcpy(datagram.data, out, outLength);
+					networkHook(datagram);
+				}
+				return 1;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		parsePacket																|
+		|	Purpose: 	Drops what's left of the last datagram and starts on the next.			|
+		|	Arguments:	void																	|
+		|	Returns:	int (its length, 0 if none)												|
+		\*-------------------------------------------------------------------------------------*/
+			int EthernetUDP::parsePacket(){
+				inLength = inPos = 0;
+				if(!localPort){ return 0; }
+				HAB_Host::spend(4 * HOST_SPI_BYTE_US); //Received size register
+
+				if(sockets){
+					sockaddr_in from = {};
+					socklen_t fromLength = sizeof(from);
+					ssize_t received = recvfrom(socketFd, in, sizeof(in), MSG_DONTWAIT, (sockaddr*)&from, &fromLength);
+					if(received <= 0){ return 0; }
+					uint32_t address = ntohl(from.sin_addr.s_addr);
+					remoteAddress = IPAddress(address >> 24, address >> 16, address >> 8, address);
+					remote = ntohs(from.sin_port);
+					inLength = received;
+				}
+				else {
+					std::deque<hostDatagram>::iterator next = inbound.begin();
+					while(next != inbound.end() && next->localPort != localPort){ next++; }
+					if(next == inbound.end()){ return 0; }
+					remoteAddress = IPAddress(next->ip);
+					remote = next->port;
+					inLength = next->length;
+					memcpy(in, next->data, inLength);
+					portBuffered[localPort] -= inLength + 8;
+					inbound.erase(next);
+				}
+
+				hostSpan span("UDP receive", "udp");
+				HAB_Host::spend(HOST_UDP_PACKET_US + 8 * HOST_SPI_BYTE_US);
+				return (int)inLength;
+			}
+
+			int EthernetUDP::available(){
+				return (int)(inLength - inPos);
+			}
+
+			int EthernetUDP::read(){
+				if(inPos == inLength){ return -1; }
+				HAB_Host::spend(HOST_SPI_BYTE_US);
+				return in[inPos++];
+			}
+
+			int EthernetUDP::read(unsigned char* buffer, size_t length){
+				if(inPos == inLength){ return -1; }
+				length = min(length, inLength - inPos);
+				memcpy(buffer, in + inPos, length);
+				inPos += length;
+				hostSpan span("UDP read", "udp");
+				HAB_Host::spend(length * HOST_SPI_BYTE_US);
+				return (int)length;
+			}
+
+			int EthernetUDP::peek(){
+				return (inPos == inLength ? -1 : in[inPos]);
+			}
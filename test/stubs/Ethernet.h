@@ -0,0 +1,120 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the Ethernet library (W5100). Datagrams go through
+*				HAB_Host (a queue in and a hook out), or through real UDP sockets on the loopback
+*				address once HAB_Host::setSockets(true), for tests talking to a ground station.
+*/
+
+
+#ifndef Ethernet_h
+#define Ethernet_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include "IPAddress.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define UDP_TX_PACKET_MAX_SIZE 24
+
+	//Bytes of a W5100 socket's receive buffer, datagrams arriving past it are lost
+	#ifndef HOST_UDP_RX_BUFFER
+		#define HOST_UDP_RX_BUFFER 2048
+	#endif
+
+	enum EthernetHardwareStatus {
+		EthernetNoHardware,
+		EthernetW5100,
+		EthernetW5200,
+		EthernetW5500
+	};
+
+	enum EthernetLinkStatus {
+		Unknown,
+		LinkON,
+		LinkOFF
+	};
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	class EthernetClass {
+		public:
+			void init(uint8_t chipSelect){}
+			void begin(uint8_t* mac, IPAddress ip){ localAddress = ip; }
+			void begin(uint8_t* mac, IPAddress ip, IPAddress dns){ localAddress = ip; }
+			void begin(uint8_t* mac, IPAddress ip, IPAddress dns, IPAddress gateway){ localAddress = ip; }
+			void begin(uint8_t* mac, IPAddress ip, IPAddress dns, IPAddress gateway, IPAddress subnet){ localAddress = ip; }
+			void setRetransmissionCount(uint8_t count){}
+			void setRetransmissionTimeout(uint16_t ms){}
+			EthernetHardwareStatus hardwareStatus();
+			EthernetLinkStatus linkStatus();
+			IPAddress localIP(){ return localAddress; }
+
+		private:
+			IPAddress localAddress;
+	};
+
+	extern EthernetClass Ethernet;
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		EthernetUDP																|
+	|	Purpose: 	One UDP socket. A packet is written between beginPacket and endPacket,	|
+	|				and read after parsePacket. Each costs the SPI transfers and socket		|
+	|				commands the W5100 would take.											|
+	\*-------------------------------------------------------------------------------------*/
+	class EthernetUDP : public Stream {
+		public:
+			~EthernetUDP(){ stop(); }
+
+			uint8_t begin(uint16_t port);
+			void stop();
+
+			int beginPacket(IPAddress ip, uint16_t port);
+			int endPacket();
+			size_t write(uint8_t b);
+			size_t write(const uint8_t* buffer, size_t size);
+			using Print::write;
+
+			int parsePacket();
+			int available();
+			int read();
+			int read(unsigned char* buffer, size_t length);
+			int read(char* buffer, size_t length){ return read((unsigned char*)buffer, length); }
+			int peek();
+			void flush(){}
+			IPAddress remoteIP(){ return remoteAddress; }
+			uint16_t remotePort(){ return remote; }
+
+		private:
+			uint16_t localPort = 0;
+			int socketFd = -1;
+
+			//Being written
+			IPAddress destAddress;
+			uint16_t destPort = 0;
+			uint8_t out[2048];
+			size_t outLength = 0;
+			bool writing = false;
+
+			//Being read
+			IPAddress remoteAddress;
+			uint16_t remote = 0;
+			uint8_t in[2048];
+			size_t inLength = 0, inPos = 0;
+	};
+
+#endif
@@ -0,0 +1,2 @@
+//Kept for sketches including it, as the Ethernet library does
+#include "Ethernet.h"
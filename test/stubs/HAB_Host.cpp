@@ -0,0 +1,208 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The simulated clock and pins of the host stand-ins. The network, SD card and
+*				sensors keep their own state, with their peripheral (Ethernet.cpp, SD.cpp, Wire.cpp).
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+	#include <chrono>
+	#include <thread>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	//Simulated time (us), or the host's clock since the start in real time
+	static uint64_t now = 0;
+	static bool realTime = false;
+	static std::chrono::steady_clock::time_point realStart = std::chrono::steady_clock::now();
+
+	//Called as the clock passes each of their periods, e.g. the board model's physics
+	struct hostTicker {
+		void (*ticker)();
+		uint32_t period;
+		uint64_t next;
+	};
+	static hostTicker tickers[8];
+	static uint8_t tickerCount = 0;
+	static bool ticking = false;
+
+	//Pin levels (pins 22-37 are kept in the port registers) and ADC readings
+	static bool pins[HOST_MAX_PINS];
+	static uint16_t analogValues[HOST_MAX_PINS];
+	static int (*analogHook)(uint8_t pin) = NULL;
+
+	//Serial output is echoed to stdout
+	static bool echo = false;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Clock---------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getMicros																|
+		|	Purpose: 	Returns the time since the start (us) without spending any.				|
+		|	Arguments:	void																	|
+		|	Returns:	uint64_t																|
+		\*-------------------------------------------------------------------------------------*/
+			uint64_t HAB_Host::getMicros(){
+				if(realTime){
+					return now + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - realStart).count();
+				}
+				return now;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		spend																	|
+		|	Purpose: 	Moves the clock on, running each ticker as its period comes up. A		|
+		|				ticker spending time only moves the clock.								|
+		|	Arguments:	uint32_t (us)															|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::spend(uint32_t us){
+				if(realTime){ return; }
+				uint64_t end = now + us;
+				if(ticking){
+					now = end;
+					return;
+				}
+
+				ticking = true;
+				for(;;){
+					hostTicker* due = NULL;
+					for(uint8_t i = 0; i != tickerCount; i++){
+						if(tickers[i].next <= end && (due == NULL || tickers[i].next < due->next)){ due = tickers + i; }
+					}
+					if(due == NULL){ break; }
+					if(due->next > now){ now = due->next; }
+					due->next += due->period;
+					due->ticker();
+				}
+				ticking = false;
+				if(end > now){ now = end; }
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sleepTick																|
+		|	Purpose: 	A sleep_cpu(), until timer 0's next millisecond interrupt.				|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::sleepTick(){
+				if(realTime){
+					std::this_thread::sleep_for(std::chrono::microseconds(1000));
+					return;
+				}
+				spend(1000 - (uint32_t)(now % 1000));
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setRealTime																|
+		|	Purpose: 	Makes the clock follow the host's, for tests talking to real sockets.	|
+		|	Arguments:	bool																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::setRealTime(bool realTime){
+				now = getMicros();
+				realStart = std::chrono::steady_clock::now();
+				::realTime = realTime;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		addTicker																|
+		|	Purpose: 	Runs a function every period (us) of simulated time, first one period	|
+		|				from now.																|
+		|	Arguments:	void (*)(), uint32_t													|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::addTicker(void (*ticker)(), uint32_t period){
+				if(tickerCount == sizeof(tickers) / sizeof(tickers[0])){ abort(); }
+				tickers[tickerCount++] = { ticker, period, now + period };
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Pins----------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		getPin, setPin															|
+		|	Purpose: 	Read and write a pin's level. Mega pins 22 to 29 are PA0 to PA7, 30 to	|
+		|				37 are PC7 down to PC0, so these agree with the port registers.			|
+		|	Arguments:	uint8_t, bool															|
+		|	Returns:	bool, void																|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Host::getPin(uint8_t pin){
+				if(pin >= 22 && pin <= 29){ return (PORTA >> (pin - 22)) & 1; }
+				if(pin >= 30 && pin <= 37){ return (PORTC >> (37 - pin)) & 1; }
+				return (pin < HOST_MAX_PINS && pins[pin]);
+			}
+			void HAB_Host::setPin(uint8_t pin, bool high){
+				if(pin >= 22 && pin <= 29){ PORTA = (high ? PORTA | _BV(pin - 22) : PORTA & ~_BV(pin - 22)); }
+				else if(pin >= 30 && pin <= 37){ PORTC = (high ? PORTC | _BV(37 - pin) : PORTC & ~_BV(37 - pin)); }
+				else if(pin < HOST_MAX_PINS){ pins[pin] = high; }
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setAnalog, setAnalogHook, readAnalog									|
+		|	Purpose: 	An analog pin's reading (0 to 1023), fixed or from a hook the board		|
+		|				model sets.																|
+		|	Arguments:	uint8_t, uint16_t / int (*)(uint8_t)									|
+		|	Returns:	void, int																|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::setAnalog(uint8_t pin, uint16_t value){
+				if(pin < HOST_MAX_PINS){ analogValues[pin] = min(value, (uint16_t)1023); }
+			}
+			void HAB_Host::setAnalogHook(int (*hook)(uint8_t pin)){
+				analogHook = hook;
+			}
+			int HAB_Host::readAnalog(uint8_t pin){
+				if(analogHook){
+					int reading = analogHook(pin); //Once, the macro would ask a noisy model more than once
+					return constrain(reading, 0, 1023);
+				}
+				return (pin < HOST_MAX_PINS ? analogValues[pin] : 0);
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Serial ports--------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		setEcho, getEcho														|
+		|	Purpose: 	Whether what the sketch writes to Serial is shown on stdout.			|
+		|	Arguments:	bool																	|
+		|	Returns:	void, bool																|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::setEcho(bool echo){
+				::echo = echo;
+			}
+			bool HAB_Host::getEcho(){
+				return echo;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		feedSerial, setSerialHook												|
+		|	Purpose: 	Sends bytes to a port (they arrive at its baud rate), and is told of	|
+		|				each byte the board writes to it.										|
+		|	Arguments:	HardwareSerial&, uint8_t*, size_t / void (*)(uint8_t)					|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Host::feedSerial(HardwareSerial& serial, const uint8_t* data, size_t length){
+				serial.feed(data, length);
+			}
+			void HAB_Host::setSerialHook(HardwareSerial& serial, void (*hook)(uint8_t b)){
+				serial.setHook(hook);
+			}
@@ -0,0 +1,147 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host side of the Arduino stand-ins, so the flight libraries and sketch can be
+*				built and run with g++. Time is simulated: it only moves when the code spends it
+*				(each clock read, a delay, a sleep, or the bytes a peripheral moves at its bus
+*				speed), so a run is repeatable and an hour of flight takes seconds. Tests and the
+*				board model reach the peripherals through here.
+*/
+
+
+#ifndef HAB_Host_h
+#define HAB_Host_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <stdint.h>
+	#include <stddef.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//What the peripherals cost on the board (us), the clock moves on by these
+	#ifndef HOST_CLOCK_READ_US
+		#define HOST_CLOCK_READ_US 1 //millis() or micros(), with the interrupts held off
+	#endif
+	#ifndef HOST_ANALOG_READ_US
+		#define HOST_ANALOG_READ_US 112 //13 ADC clocks at 125kHz, and the call
+	#endif
+	#ifndef HOST_SPI_BYTE_US
+		#define HOST_SPI_BYTE_US 2 //A byte to the W5100 or SD card, with the libraries' per-byte overhead
+	#endif
+	#ifndef HOST_UDP_PACKET_US
+		#define HOST_UDP_PACKET_US 150 //Socket commands of a datagram sent or received
+	#endif
+	#ifndef HOST_SD_OPEN_US
+		#define HOST_SD_OPEN_US 2500 //Finding a file in the FAT directory
+	#endif
+	#ifndef HOST_SD_BLOCK_US
+		#define HOST_SD_BLOCK_US 3000 //Writing a 512 byte block, flushed on close
+	#endif
+	#ifndef HOST_I2C_BYTE_US
+		#define HOST_I2C_BYTE_US 90 //9 bits at 100kHz
+	#endif
+	#ifndef HOST_EEPROM_WRITE_US
+		#define HOST_EEPROM_WRITE_US 3300 //Erase and write of one byte
+	#endif
+	#ifndef HOST_MAX_PINS
+		#define HOST_MAX_PINS 70
+	#endif
+
+	class HardwareSerial;
+	class IPAddress;
+
+	//The air around the board, read by the BME280 model
+	struct hostEnvironment {
+		float temperature; //C
+		float pressure; //Pa
+		float humidity; //%
+	};
+
+	//A UDP datagram, as it leaves or reaches the board
+	struct hostDatagram {
+		uint8_t ip[4]; //The other end
+		uint16_t port; //The other end's
+		uint16_t localPort; //The board's
+		uint16_t length;
+		uint8_t data[2048];
+	};
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+class HAB_Host {
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+
+		//--------------------------------------------------------------------------------\
+		//Clock---------------------------------------------------------------------------|
+			static uint64_t getMicros();
+			static void spend(uint32_t us);
+			static void sleepTick();
+			static void setRealTime(bool realTime);
+			static void addTicker(void (*ticker)(), uint32_t period);
+
+
+		//--------------------------------------------------------------------------------\
+		//Pins----------------------------------------------------------------------------|
+			static bool getPin(uint8_t pin);
+			static void setPin(uint8_t pin, bool high);
+			static void setAnalog(uint8_t pin, uint16_t value);
+			static void setAnalogHook(int (*hook)(uint8_t pin));
+			static int readAnalog(uint8_t pin);
+
+
+		//--------------------------------------------------------------------------------\
+		//Serial ports--------------------------------------------------------------------|
+			static void setEcho(bool echo);
+			static bool getEcho();
+			static void feedSerial(HardwareSerial& serial, const uint8_t* data, size_t length);
+			static void setSerialHook(HardwareSerial& serial, void (*hook)(uint8_t b));
+
+
+		//--------------------------------------------------------------------------------\
+		//Network-------------------------------------------------------------------------|
+			static void setSockets(bool sockets);
+			static bool getSockets();
+			static void setNetworkHook(void (*hook)(const hostDatagram& datagram));
+			static void sendToBoard(const IPAddress& ip, uint16_t port, uint16_t localPort, const char* data, uint16_t length);
+			static size_t getBoardBuffered(uint16_t localPort); //Bytes waiting in the port's buffer
+			static bool hasNetworkHardware();
+			static void setNetworkHardware(bool present);
+
+
+		//--------------------------------------------------------------------------------\
+		//SD card-------------------------------------------------------------------------|
+			static bool writeFile(const char* name, const uint8_t* data, size_t length);
+			static size_t getFileSize(const char* name);
+			static size_t readFile(const char* name, uint8_t* data, size_t size, size_t offset = 0);
+			static void setCardPresent(bool present);
+			static bool isCardPresent();
+
+
+		//--------------------------------------------------------------------------------\
+		//Sensors-------------------------------------------------------------------------|
+			static hostEnvironment& getEnvironment();
+			static void setSensorPresent(bool present);
+			static bool isSensorPresent();
+			static void setCameraPresent(bool present);
+			static bool isCameraPresent();
+};
+
+#endif
@@ -0,0 +1,271 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host build's timeline, see HAB_Trace.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "HAB_Trace.h"
+	#include "HAB_Host.h"
+	#include <atomic>
+	#include <mutex>
+	#include <string>
+	#include <vector>
+	#include <stdio.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//A span ('X') or an instant event ('i'). Span names are the callers' literals, an instant's is copied.
+	struct hostTraceEvent {
+		char phase;
+		const char* name;
+		const char* category;
+		uint64_t start, duration; //us
+		std::string text;
+	};
+
+	//One thread's events, and its spans still open
+	struct hostTraceBuffer {
+		uint32_t thread;
+		std::string name;
+		std::vector<hostTraceEvent> events;
+		std::vector<size_t> open;
+		size_t loop, section; //Open, or SIZE_MAX
+		uint32_t dropped;
+	};
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	static std::atomic<bool> enabled(false);
+	static std::atomic<bool> spans(true);
+
+	//Every thread's buffer, only locked to add one or to write them. Never freed, a thread's events
+	//outlive it.
+	static std::mutex buffersLock;
+	static std::vector<hostTraceBuffer*>& buffers = *new std::vector<hostTraceBuffer*>();
+	static thread_local hostTraceBuffer* buffer = NULL;
+
+	//The sketch's PROFILE slots
+	static const char* const* slotNames = NULL;
+	static uint8_t slotCount = 0;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	static hostTraceBuffer& getBuffer(){
+		if(buffer == NULL){
+			buffer = new hostTraceBuffer();
+			buffer->loop = buffer->section = SIZE_MAX;
+			buffer->dropped = 0;
+			std::lock_guard<std::mutex> lock(buffersLock);
+			buffer->thread = (uint32_t)buffers.size();
+			buffers.push_back(buffer);
+		}
+		return *buffer;
+	}
+
+	//Index of the new event, SIZE_MAX if the buffer is full
+	static size_t record(char phase, const char* name, const char* category){
+		hostTraceBuffer& events = getBuffer();
+		if(events.events.size() >= HOST_TRACE_MAX_EVENTS){
+			events.dropped++;
+			return SIZE_MAX;
+		}
+		hostTraceEvent event = { phase, name, category, HAB_Host::getMicros(), 0, std::string() };
+		events.events.push_back(event);
+		return events.events.size() - 1;
+	}
+
+	static void finish(size_t index){
+		if(index == SIZE_MAX){ return; }
+		hostTraceEvent& event = buffer->events[index];
+		event.duration = HAB_Host::getMicros() - event.start;
+	}
+
+	static void writeString(FILE* file, const char* text){
+		fputc('"', file);
+		for(const char* c = text; *c; c++){
+			if(*c == '"' || *c == '\\'){ fprintf(file, "\\%c", *c); }
+			else if((unsigned char)*c < 0x20){ fprintf(file, "\\u%04x", *c); }
+			else{ fputc(*c, file); }
+		}
+		fputc('"', file);
+	}
+
+
+	//--------------------------------------------------------------------------------\
+	//Recording-----------------------------------------------------------------------|
+
+		void HAB_Trace::setEnabled(bool enabled){
+			::enabled = enabled;
+		}
+		bool HAB_Trace::isEnabled(){
+			return enabled;
+		}
+		void HAB_Trace::setSpans(bool spans){
+			::spans = spans;
+		}
+		void HAB_Trace::setThreadName(const char* name){
+			getBuffer().name = name;
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		begin, end																|
+		|	Purpose: 	Opens a span on this thread, and closes the last one opened. One		|
+		|				opened before recording was on is not closed by it, one open when it	|
+		|				was turned off still is.												|
+		|	Arguments:	const char* (name and category, kept not copied) / void					|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Trace::begin(const char* name, const char* category){
+				if(!enabled || !spans){ return; }
+				getBuffer().open.push_back(record('X', name, category));
+			}
+
+			void HAB_Trace::end(){
+				if(buffer == NULL || buffer->open.empty()){ return; }
+				finish(buffer->open.back());
+				buffer->open.pop_back();
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		instant																	|
+		|	Purpose: 	Records an event at this moment, named by the text and the detail		|
+		|				after it if there is one. Both are copied.								|
+		|	Arguments:	const char*, const char* (or NULL), const char*							|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Trace::instant(const char* name, const char* detail, const char* category){
+				if(!enabled){ return; }
+				size_t index = record('i', NULL, category);
+				if(index == SIZE_MAX){ return; }
+				std::string& text = buffer->events[index].text;
+				text = name;
+				if(detail != NULL){
+					text += ' ';
+					text += detail;
+				}
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//The sketch's loop---------------------------------------------------------------|
+
+		void HAB_Trace::setSlotNames(const char* const* names, uint8_t count){
+			slotNames = names;
+			slotCount = count;
+		}
+
+		void HAB_Trace::beginSlot(uint8_t slot){
+			begin((slot < slotCount ? slotNames[slot] : "PROFILE"), "profile");
+		}
+
+		void HAB_Trace::endSlot(uint8_t slot){
+			end();
+		}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		loop, section															|
+		|	Purpose: 	Marks the start of a pass of the loop, and of each of its sections.		|
+		|				Each ends where the next begins, the last section with the pass.		|
+		|	Arguments:	void / const char* (kept not copied)									|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			void HAB_Trace::loop(){
+				if(buffer != NULL){
+					finish(buffer->section);
+					finish(buffer->loop);
+					buffer->section = buffer->loop = SIZE_MAX;
+				}
+				if(!enabled || !spans){ return; }
+				getBuffer().loop = record('X', "loop", "loop");
+			}
+
+			void HAB_Trace::section(const char* name){
+				if(buffer != NULL){
+					finish(buffer->section);
+					buffer->section = SIZE_MAX;
+				}
+				if(!enabled || !spans){ return; }
+				getBuffer().section = record('X', name, "section");
+			}
+
+
+	//--------------------------------------------------------------------------------\
+	//Output--------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		write																	|
+		|	Purpose: 	Writes every thread's events as a Chrome trace, each thread a track		|
+		|				of the process named. Spans still open end now.							|
+		|	Arguments:	const char*, const char*												|
+		|	Returns:	bool (false if it couldn't be written)									|
+		\*-------------------------------------------------------------------------------------*/
+			bool HAB_Trace::write(const char* fileName, const char* processName){
+				FILE* file = fopen(fileName, "w");
+				if(file == NULL){ return false; }
+
+				std::lock_guard<std::mutex> lock(buffersLock);
+				uint64_t now = HAB_Host::getMicros();
+				fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":");
+				writeString(file, processName);
+				fprintf(file, "}}");
+				for(hostTraceBuffer* thread : buffers){
+					std::string name = (thread->name.empty() ? "Thread " + std::to_string(thread->thread) : thread->name);
+					fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", thread->thread);
+					writeString(file, name.c_str());
+					fprintf(file, "}}");
+
+					//Still open: the spans on its stack, and the loop and its section
+					std::vector<size_t> open = thread->open;
+					open.push_back(thread->loop);
+					open.push_back(thread->section);
+					for(size_t index : open){
+						if(index != SIZE_MAX){ thread->events[index].duration = now - thread->events[index].start; }
+					}
+
+					for(const hostTraceEvent& event : thread->events){
+						fprintf(file, ",\n{\"name\":");
+						writeString(file, (event.name != NULL ? event.name : event.text.c_str()));
+						fprintf(file, ",\"cat\":");
+						writeString(file, event.category);
+						fprintf(file, ",\"ph\":\"%c\",\"pid\":0,\"tid\":%u,\"ts\":%llu", event.phase, thread->thread, (unsigned long long)event.start);
+						if(event.phase == 'X'){ fprintf(file, ",\"dur\":%llu}", (unsigned long long)event.duration); }
+						else{ fprintf(file, ",\"s\":\"t\"}"); }
+					}
+				}
+				fprintf(file, "\n]}\n");
+				return fclose(file) == 0;
+			}
+
+			uint32_t HAB_Trace::getDropped(){
+				std::lock_guard<std::mutex> lock(buffersLock);
+				uint32_t dropped = 0;
+				for(hostTraceBuffer* thread : buffers){ dropped += thread->dropped; }
+				return dropped;
+			}
+
+			void HAB_Trace::clear(){
+				std::lock_guard<std::mutex> lock(buffersLock);
+				for(hostTraceBuffer* thread : buffers){
+					thread->events.clear();
+					thread->open.clear();
+					thread->loop = thread->section = SIZE_MAX;
+					thread->dropped = 0;
+				}
+			}
@@ -0,0 +1,86 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A timeline of the host build, written in Chrome's trace format (chrome://tracing,
+*				ui.perfetto.dev). The stand-ins mark what the peripherals cost as spans (SD, UDP,
+*				UART and I2C), the sketch marks its loop sections and profiled slots through
+*				HAB_Profile's macros, and its commands, phase changes and actuator transitions as
+*				instant events. Times are the simulated clock's. Each thread records into a buffer
+*				of its own, so recording takes no locks; only a thread's first event registers its
+*				buffer. Nothing is recorded until it is enabled.
+*/
+
+
+#ifndef HAB_Trace_h
+#define HAB_Trace_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <stdint.h>
+	#include <stddef.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#ifndef HOST_TRACE_MAX_EVENTS
+		#define HOST_TRACE_MAX_EVENTS 4000000 //Per thread, later events are counted and dropped
+	#endif
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+class HAB_Trace {
+
+	//--------------------------------------------------------------------------\
+	//								   Functions					   			|
+	//--------------------------------------------------------------------------/
+		public:
+
+
+		//--------------------------------------------------------------------------------\
+		//Recording-----------------------------------------------------------------------|
+			static void setEnabled(bool enabled);
+			static bool isEnabled();
+			static void setSpans(bool spans); //Instant events only while off, for a long run
+			static void setThreadName(const char* name);
+
+			static void begin(const char* name, const char* category);
+			static void end();
+			static void instant(const char* name, const char* detail, const char* category);
+
+
+		//--------------------------------------------------------------------------------\
+		//The sketch's loop---------------------------------------------------------------|
+			static void setSlotNames(const char* const* names, uint8_t count);
+			static void beginSlot(uint8_t slot);
+			static void endSlot(uint8_t slot);
+			static void loop();
+			static void section(const char* name);
+
+
+		//--------------------------------------------------------------------------------\
+		//Output--------------------------------------------------------------------------|
+			static bool write(const char* fileName, const char* processName);
+			static uint32_t getDropped();
+			static void clear();
+};
+
+
+	//A span for the scope it is declared in
+	class hostSpan {
+		public:
+			hostSpan(const char* name, const char* category){ HAB_Trace::begin(name, category); }
+			~hostSpan(){ HAB_Trace::end(); }
+	};
+
+#endif
@@ -0,0 +1,59 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the Arduino core's IPv4 address.
+*/
+
+
+#ifndef IPAddress_h
+#define IPAddress_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <stdint.h>
+	#include <string.h>
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	class IPAddress {
+		public:
+			IPAddress(){ memset(bytes, 0, 4); }
+			IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d){ bytes[0] = a; bytes[1] = b; bytes[2] = c; bytes[3] = d; }
+			IPAddress(const uint8_t* address){ memcpy(bytes, address, 4); }
+
+			uint8_t operator[](int index) const { return bytes[index]; }
+			uint8_t& operator[](int index){ return bytes[index]; }
+			bool operator==(const IPAddress& other) const { return !memcmp(bytes, other.bytes, 4); }
+			bool operator!=(const IPAddress& other) const { return !(*this == other); }
+
+			//Dotted decimal, false (and unchanged) unless all four parts are 0 to 255
+			bool fromString(const char* text){
+				uint8_t parsed[4];
+				for(uint8_t i = 0; i != 4; i++){
+					uint16_t part = 0;
+					uint8_t digits = 0;
+					while(*text >= '0' && *text <= '9' && digits != 4){
+						part = part * 10 + (*text++ - '0');
+						digits++;
+					}
+					if(!digits || part > 255 || *text != (i == 3 ? '\0' : '.')){ return false; }
+					parsed[i] = part;
+					text++;
+				}
+				memcpy(bytes, parsed, 4);
+				return true;
+			}
+
+		private:
+			uint8_t bytes[4];
+	};
+
+#endif
@@ -0,0 +1,188 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for the SD library, see SD.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "SD.h"
+	#include "SPI.h"
+	#include "HAB_Trace.h"
+	#include <map>
+	#include <string>
+	#include <vector>
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	SDClass SD;
+	SPIClass SPI;
+
+	//FAT names aren't case sensitive, the files are kept under their upper case name
+	static std::map<std::string, std::vector<uint8_t> > files;
+	static bool cardPresent = true;
+	static bool mounted = false;
+
+	static std::string key(const char* name){
+		std::string upper = (name[0] == '/' ? name + 1 : name);
+		for(size_t i = 0; i != upper.size(); i++){ upper[i] = toupper(upper[i]); }
+		return upper;
+	}
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Host----------------------------------------------------------------------------|
+
+		bool HAB_Host::writeFile(const char* name, const uint8_t* data, size_t length){
+			files[key(name)].assign(data, data + length);
+			return true;
+		}
+
+		size_t HAB_Host::getFileSize(const char* name){
+			std::map<std::string, std::vector<uint8_t> >::iterator file = files.find(key(name));
+			return (file == files.end() ? 0 : file->second.size());
+		}
+
+		size_t HAB_Host::readFile(const char* name, uint8_t* data, size_t size, size_t offset){
+			std::map<std::string, std::vector<uint8_t> >::iterator file = files.find(key(name));
+			if(file == files.end() || offset >= file->second.size()){ return 0; }
+			size = min(size, file->second.size() - offset);
+			memcpy(data, file->second.data() + offset, size);
+			return size;
+		}
+
+		void HAB_Host::setCardPresent(bool present){
+			cardPresent = present;
+			if(!present){ mounted = false; }
+		}
+
+		bool HAB_Host::isCardPresent(){
+			return cardPresent;
+		}
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//SDClass-------------------------------------------------------------------------|
+
+		bool SDClass::begin(uint8_t chipSelect){
+			hostSpan span("SD begin", "sd");
+			HAB_Host::spend(20 * HOST_SD_OPEN_US); //Card reset, then the volume is mounted
+			mounted = cardPresent;
+			return mounted;
+		}
+
+		File SDClass::open(const char* name, uint8_t mode){
+			if(!mounted){ return File(); }
+			hostSpan span("SD open", "sd");
+			HAB_Host::spend(HOST_SD_OPEN_US);
+
+			std::string name_ = key(name);
+			if(files.find(name_) == files.end()){
+				if(mode == FILE_READ){ return File(); }
+				files[name_];
+			}
+			return File(name, mode, (mode == FILE_READ ? 0 : files[name_].size()));
+		}
+
+		bool SDClass::exists(const char* name){
+			if(!mounted){ return false; }
+			hostSpan span("SD exists", "sd");
+			HAB_Host::spend(HOST_SD_OPEN_US);
+			return (files.find(key(name)) != files.end());
+		}
+
+		bool SDClass::remove(const char* name){
+			if(!mounted){ return false; }
+			hostSpan span("SD remove", "sd");
+			HAB_Host::spend(HOST_SD_OPEN_US);
+			return (files.erase(key(name)) != 0);
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//File----------------------------------------------------------------------------|
+
+		File::File(const char* name, uint8_t mode, uint32_t position) : mode(mode), pos(position), open(true){
+			strncpy(fileName, name, sizeof(fileName) - 1);
+			fileName[sizeof(fileName) - 1] = '\0';
+		}
+
+		size_t File::write(const uint8_t* buffer, size_t size){
+			if(!open || mode == FILE_READ || !mounted){ return 0; }
+			std::vector<uint8_t>& data = files[key(fileName)];
+			pos = data.size();
+			data.insert(data.end(), buffer, buffer + size);
+			pos += size;
+			written += size;
+			return size;
+		}
+
+		int File::available(){
+			if(!open){ return 0; }
+			uint32_t length = size();
+			return (int)(pos < length ? min(length - pos, (uint32_t)0x7FFF) : 0);
+		}
+
+		int File::read(){
+			uint8_t b;
+			return (read(&b, 1) == 1 ? b : -1);
+		}
+
+		int File::read(void* buffer, uint16_t length){
+			if(!open){ return -1; }
+			std::vector<uint8_t>& data = files[key(fileName)];
+			if(pos >= data.size()){ return 0; }
+			length = min((uint32_t)length, (uint32_t)data.size() - pos);
+			memcpy(buffer, data.data() + pos, length);
+			pos += length;
+			hostSpan span("SD read", "sd");
+			HAB_Host::spend(length * HOST_SPI_BYTE_US);
+			return length;
+		}
+
+		int File::peek(){
+			if(!open){ return -1; }
+			std::vector<uint8_t>& data = files[key(fileName)];
+			return (pos < data.size() ? data[pos] : -1);
+		}
+
+		bool File::seek(uint32_t position){
+			if(!open || position > size()){ return false; }
+			pos = position;
+			return true;
+		}
+
+		uint32_t File::size(){
+			return (open ? (uint32_t)files[key(fileName)].size() : 0);
+		}
+
+		void File::flush(){
+			if(written){
+				hostSpan span("SD flush", "sd");
+				HAB_Host::spend((written + 511) / 512 * HOST_SD_BLOCK_US);
+			}
+			written = 0;
+		}
+
+		void File::close(){
+			if(!open){ return; }
+			flush();
+			open = false;
+		}
@@ -0,0 +1,79 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the SD library, with the card's files held in memory. Opening
+*				a file costs a directory search, and a written file costs its blocks when closed.
+*				Tests load and read the files through HAB_Host.
+*/
+
+
+#ifndef SD_h
+#define SD_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define FILE_READ 0x01
+	#define FILE_WRITE 0x13 //Read, write, create, append
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		File																	|
+	|	Purpose: 	An open file, false if the open failed. Writing appends.				|
+	\*-------------------------------------------------------------------------------------*/
+	class File : public Stream {
+		public:
+			File(){ fileName[0] = '\0'; }
+			File(const char* name, uint8_t mode, uint32_t position);
+
+			size_t write(uint8_t b){ return write(&b, 1); }
+			size_t write(const uint8_t* buffer, size_t size);
+			using Print::write;
+			int available();
+			int read();
+			int read(void* buffer, uint16_t length);
+			int peek();
+			bool seek(uint32_t position);
+			uint32_t position(){ return pos; }
+			uint32_t size();
+			void flush();
+			void close();
+			const char* name(){ return fileName; }
+			operator bool(){ return open; }
+
+		private:
+			char fileName[64];
+			uint8_t mode = 0;
+			uint32_t pos = 0;
+			uint32_t written = 0; //Since the last flush
+			bool open = false;
+	};
+
+	class SDClass {
+		public:
+			bool begin(uint8_t chipSelect = 10);
+			File open(const char* name, uint8_t mode = FILE_READ);
+			bool exists(const char* name);
+			bool remove(const char* name);
+			bool mkdir(const char* name){ return true; }
+	};
+
+	extern SDClass SD;
+
+#endif
@@ -0,0 +1,21 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the SPI library, only included for its side effects on the board.
+*/
+
+
+#ifndef SPI_h
+#define SPI_h
+
+	#include "Arduino.h"
+
+	class SPIClass {
+		public:
+			static void begin(){ SPCR |= _BV(SPE) | _BV(MSTR); }
+			static void end(){ SPCR &= ~_BV(SPE); }
+	};
+
+	extern SPIClass SPI;
+
+#endif
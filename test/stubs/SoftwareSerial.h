@@ -0,0 +1,25 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for SoftwareSerial. Nothing is on the other end, the camera is
+*				modelled by the Adafruit_VC0706 stand-in instead.
+*/
+
+
+#ifndef SoftwareSerial_h
+#define SoftwareSerial_h
+
+	#include "Arduino.h"
+
+	class SoftwareSerial : public Stream {
+		public:
+			SoftwareSerial(uint8_t rxPin, uint8_t txPin){}
+			void begin(long baud){}
+			int available(){ return 0; }
+			int read(){ return -1; }
+			int peek(){ return -1; }
+			size_t write(uint8_t b){ return 1; }
+			using Print::write;
+	};
+
+#endif
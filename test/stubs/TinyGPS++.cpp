@@ -0,0 +1,173 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for TinyGPS++, see TinyGPS++.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "TinyGPS++.h"
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		encode																	|
+	|	Purpose: 	Collects a sentence from '$' to the end of the line.					|
+	|	Arguments:	char																	|
+	|	Returns:	bool (true if a sentence was committed)									|
+	\*-------------------------------------------------------------------------------------*/
+		bool TinyGPSPlus::encode(char c){
+			chars++;
+			if(c == '$'){
+				inSentence = true;
+				length = 0;
+				return false;
+			}
+			if(!inSentence){ return false; }
+			if(c == '\r' || c == '\n'){
+				inSentence = false;
+				sentence[length] = '\0';
+				return endSentence();
+			}
+			if(length == sizeof(sentence) - 1){
+				inSentence = false;
+				return false;
+			}
+			sentence[length++] = c;
+			return false;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		endSentence																|
+	|	Purpose: 	Checks the checksum, splits the fields, and commits a GGA or RMC.		|
+	|	Arguments:	void																	|
+	|	Returns:	bool																	|
+	\*-------------------------------------------------------------------------------------*/
+		bool TinyGPSPlus::endSentence(){
+			char* star = strchr(sentence, '*');
+			if(!star || strlen(star) < 3){ return false; }
+			uint8_t checksum = 0;
+			for(char* p = sentence; p != star; p++){ checksum ^= *p; }
+			if(strtoul(star + 1, NULL, 16) != checksum){
+				failed++;
+				return false;
+			}
+			passed++;
+			*star = '\0';
+
+			//Fields, empty ones included
+			const char* fields[20];
+			uint8_t count = 0;
+			char* field = sentence;
+			while(count != 20){
+				fields[count++] = field;
+				char* comma = strchr(field, ',');
+				if(!comma){ break; }
+				*comma = '\0';
+				field = comma + 1;
+			}
+			if(count < 10 || strlen(fields[0]) != 5){ return false; }
+			const char* type = fields[0] + 2;
+
+			if(!strcmp(type, "GGA")){
+				bool fix = (atoi(fields[6]) > 0);
+				if(*fields[1]){
+					time.time = parseDecimal(fields[1]);
+					time.commit();
+				}
+				if(fix && parseDegrees(fields[2], location.newLat) && parseDegrees(fields[4], location.newLng)){
+					location.newLat.negative = (fields[3][0] == 'S');
+					location.newLng.negative = (fields[5][0] == 'W');
+					location.lat_ = location.newLat;
+					location.lng_ = location.newLng;
+					location.commit();
+					altitude.val = parseDecimal(fields[9]);
+					altitude.commit();
+					withFix++;
+				}
+				if(*fields[7]){
+					satellites.val = atol(fields[7]);
+					satellites.commit();
+				}
+				if(*fields[8]){
+					hdop.val = parseDecimal(fields[8]);
+					hdop.commit();
+				}
+				return true;
+			}
+
+			if(!strcmp(type, "RMC")){
+				bool fix = (fields[2][0] == 'A');
+				if(*fields[1]){
+					time.time = parseDecimal(fields[1]);
+					time.commit();
+				}
+				if(*fields[9]){
+					date.date = atol(fields[9]);
+					date.commit();
+				}
+				if(fix && parseDegrees(fields[3], location.newLat) && parseDegrees(fields[5], location.newLng)){
+					location.newLat.negative = (fields[4][0] == 'S');
+					location.newLng.negative = (fields[6][0] == 'W');
+					location.lat_ = location.newLat;
+					location.lng_ = location.newLng;
+					location.commit();
+					speed.val = parseDecimal(fields[7]);
+					speed.commit();
+					course.val = parseDecimal(fields[8]);
+					course.commit();
+					withFix++;
+				}
+				return true;
+			}
+			return false;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		parseDegrees															|
+	|	Purpose: 	NMEA's (d)ddmm.mmmm as whole degrees and billionths.					|
+	|	Arguments:	char*, RawDegrees&														|
+	|	Returns:	bool (false if empty)													|
+	\*-------------------------------------------------------------------------------------*/
+		bool TinyGPSPlus::parseDegrees(const char* text, RawDegrees& degrees){
+			if(!*text){ return false; }
+			uint32_t whole = strtoul(text, NULL, 10);
+			uint64_t fraction = 0, scale = 1;
+			const char* dot = strchr(text, '.');
+			if(dot){
+				for(const char* p = dot + 1; *p >= '0' && *p <= '9' && scale < 1000000000ULL; p++){
+					fraction = fraction * 10 + (*p - '0');
+					scale *= 10;
+				}
+			}
+			degrees.deg = whole / 100;
+			uint64_t minutes = (whole % 100) * 1000000000ULL + fraction * 1000000000ULL / scale;
+			degrees.billionths = (uint32_t)((minutes + 30) / 60);
+			degrees.negative = false;
+			return true;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		parseDecimal															|
+	|	Purpose: 	A decimal in hundredths, as TinyGPS++ keeps them.						|
+	|	Arguments:	char*																	|
+	|	Returns:	int32_t																	|
+	\*-------------------------------------------------------------------------------------*/
+		int32_t TinyGPSPlus::parseDecimal(const char* text){
+			bool negative = (*text == '-');
+			if(negative){ text++; }
+			int32_t value = atol(text) * 100;
+			const char* dot = strchr(text, '.');
+			if(dot && dot[1] >= '0' && dot[1] <= '9'){
+				value += 10 * (dot[1] - '0');
+				if(dot[2] >= '0' && dot[2] <= '9'){ value += dot[2] - '0'; }
+			}
+			return (negative ? -value : value);
+		}
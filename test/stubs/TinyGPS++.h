@@ -0,0 +1,166 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for TinyGPS++: parses the GGA and RMC sentences, checks their
+*				checksums, and keeps the same fields (with their validity and age) the library does.
+*/
+
+
+#ifndef TinyGPSPlus_h
+#define TinyGPSPlus_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	struct RawDegrees {
+		uint16_t deg = 0;
+		uint32_t billionths = 0;
+		bool negative = false;
+	};
+
+	//Validity and age, common to every field
+	class TinyGPSField {
+		public:
+			bool isValid() const { return valid; }
+			bool isUpdated() const { return updated; }
+			uint32_t age() const { return (valid ? millis() - updateTime : 0xFFFFFFFFUL); }
+
+		protected:
+			void commit(){
+				valid = updated = true;
+				updateTime = millis();
+			}
+			bool valid = false, updated = false;
+			uint32_t updateTime = 0;
+			friend class TinyGPSPlus;
+	};
+
+	class TinyGPSLocation : public TinyGPSField {
+		public:
+			const RawDegrees& rawLat(){ updated = false; return lat_; }
+			const RawDegrees& rawLng(){ updated = false; return lng_; }
+			double lat(){ updated = false; return toDouble(lat_); }
+			double lng(){ updated = false; return toDouble(lng_); }
+
+		private:
+			static double toDouble(const RawDegrees& raw){
+				double value = raw.deg + raw.billionths / 1000000000.0;
+				return (raw.negative ? -value : value);
+			}
+			RawDegrees lat_, lng_, newLat, newLng;
+			friend class TinyGPSPlus;
+	};
+
+	class TinyGPSDate : public TinyGPSField {
+		public:
+			uint32_t value(){ updated = false; return date; }
+			uint16_t year(){ updated = false; return date % 100 + 2000; }
+			uint8_t month(){ updated = false; return (date / 100) % 100; }
+			uint8_t day(){ updated = false; return date / 10000; }
+
+		private:
+			uint32_t date = 0;
+			friend class TinyGPSPlus;
+	};
+
+	class TinyGPSTime : public TinyGPSField {
+		public:
+			uint32_t value(){ updated = false; return time; }
+			uint8_t hour(){ updated = false; return time / 1000000; }
+			uint8_t minute(){ updated = false; return (time / 10000) % 100; }
+			uint8_t second(){ updated = false; return (time / 100) % 100; }
+			uint8_t centisecond(){ updated = false; return time % 100; }
+
+		private:
+			uint32_t time = 0;
+			friend class TinyGPSPlus;
+	};
+
+	//Fixed point, in hundredths
+	class TinyGPSDecimal : public TinyGPSField {
+		public:
+			int32_t value(){ updated = false; return val; }
+
+		protected:
+			int32_t val = 0;
+			friend class TinyGPSPlus;
+	};
+
+	class TinyGPSAltitude : public TinyGPSDecimal {
+		public:
+			double meters(){ return value() / 100.0; }
+			double feet(){ return 3.2808399 * value() / 100.0; }
+	};
+
+	class TinyGPSSpeed : public TinyGPSDecimal {
+		public:
+			double knots(){ return value() / 100.0; }
+			double mps(){ return 0.514444444 * value() / 100.0; }
+			double kmph(){ return 1.852 * value() / 100.0; }
+	};
+
+	class TinyGPSCourse : public TinyGPSDecimal {
+		public:
+			double deg(){ return value() / 100.0; }
+	};
+
+	class TinyGPSHDOP : public TinyGPSDecimal {
+		public:
+			double hdop(){ return value() / 100.0; }
+	};
+
+	class TinyGPSInteger : public TinyGPSField {
+		public:
+			uint32_t value(){ updated = false; return val; }
+
+		private:
+			uint32_t val = 0;
+			friend class TinyGPSPlus;
+	};
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		TinyGPSPlus																|
+	|	Purpose: 	Fed one character at a time, commits a sentence's fields once its		|
+	|				checksum passes. Position, altitude, speed and course only with a fix.	|
+	\*-------------------------------------------------------------------------------------*/
+	class TinyGPSPlus {
+		public:
+			bool encode(char c);
+
+			TinyGPSLocation location;
+			TinyGPSDate date;
+			TinyGPSTime time;
+			TinyGPSSpeed speed;
+			TinyGPSCourse course;
+			TinyGPSAltitude altitude;
+			TinyGPSInteger satellites;
+			TinyGPSHDOP hdop;
+
+			uint32_t charsProcessed() const { return chars; }
+			uint32_t sentencesWithFix() const { return withFix; }
+			uint32_t failedChecksum() const { return failed; }
+			uint32_t passedChecksum() const { return passed; }
+
+		private:
+			bool endSentence();
+			static bool parseDegrees(const char* text, RawDegrees& degrees);
+			static int32_t parseDecimal(const char* text);
+
+			char sentence[100];
+			uint8_t length = 0;
+			bool inSentence = false;
+			uint32_t chars = 0, withFix = 0, failed = 0, passed = 0;
+	};
+
+#endif
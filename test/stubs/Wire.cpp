@@ -0,0 +1,277 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	The host stand-in for the Wire library and the BME280 on it, see Wire.h.
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Wire.h"
+	#include "HAB_Trace.h"
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	TwoWire Wire;
+
+	static hostEnvironment environment = { 20.0f, 101325.0f, 40.0f };
+	static bool sensorPresent = true;
+
+	//The datasheet's example calibration (section 8.2 of BST-BME280-DS002)
+	static const uint16_t T1 = 27504;
+	static const int16_t T2 = 26435, T3 = -1000;
+	static const uint16_t P1 = 36477;
+	static const int16_t P2 = -10685, P3 = 3024, P4 = 2855, P5 = 140, P6 = -7, P7 = 15500, P8 = -14600, P9 = 6000;
+	static const uint8_t H1 = 75, H3 = 0;
+	static const int16_t H2 = 362, H4 = 313, H5 = 50;
+	static const int8_t H6 = 30;
+
+	//The sensor's registers, the one a read starts at, and when a forced conversion ends
+	static uint8_t registers[256];
+	static bool registersSet = false;
+	static uint8_t pointer = 0;
+	static uint64_t conversionEnd = 0;
+	static bool converting = false;
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	//--------------------------------------------------------------------------------\
+	//Host----------------------------------------------------------------------------|
+
+		hostEnvironment& HAB_Host::getEnvironment(){
+			return environment;
+		}
+		void HAB_Host::setSensorPresent(bool present){
+			sensorPresent = present;
+		}
+		bool HAB_Host::isSensorPresent(){
+			return sensorPresent;
+		}
+
+
+	//--------------------------------------------------------------------------------\
+	//BME280--------------------------------------------------------------------------|
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		compensateT, compensateP, compensateH									|
+		|	Purpose: 	The datasheet's integer compensation (section 4.2.3), in 0.01C, Pa		|
+		|				in Q24.8 and %RH in Q22.10. Used to find the raw readings that give		|
+		|				the environment.														|
+		\*-------------------------------------------------------------------------------------*/
+			static int32_t compensateT(int32_t adcT, int32_t& tFine){
+				int32_t var1 = ((((adcT >> 3) - ((int32_t)T1 << 1))) * ((int32_t)T2)) >> 11;
+				int32_t var2 = (((((adcT >> 4) - ((int32_t)T1)) * ((adcT >> 4) - ((int32_t)T1))) >> 12) * ((int32_t)T3)) >> 14;
+				tFine = var1 + var2;
+				return (tFine * 5 + 128) >> 8;
+			}
+
+			static uint32_t compensateP(int32_t adcP, int32_t tFine){
+				int64_t var1 = ((int64_t)tFine) - 128000;
+				int64_t var2 = var1 * var1 * (int64_t)P6;
+				var2 = var2 + ((var1 * (int64_t)P5) << 17);
+				var2 = var2 + (((int64_t)P4) << 35);
+				var1 = ((var1 * var1 * (int64_t)P3) >> 8) + ((var1 * (int64_t)P2) << 12);
+				var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)P1) >> 33;
+				if(var1 == 0){ return 0; }
+				int64_t p = 1048576 - adcP;
+				p = (((p << 31) - var2) * 3125) / var1;
+				var1 = (((int64_t)P9) * (p >> 13) * (p >> 13)) >> 25;
+				var2 = (((int64_t)P8) * p) >> 19;
+				return (uint32_t)(((p + var1 + var2) >> 8) + (((int64_t)P7) << 4));
+			}
+
+			static uint32_t compensateH(int32_t adcH, int32_t tFine){
+				int32_t h = tFine - ((int32_t)76800);
+				h = (((((adcH << 14) - (((int32_t)H4) << 20) - (((int32_t)H5) * h)) + ((int32_t)16384)) >> 15)
+					* (((((((h * ((int32_t)H6)) >> 10) * (((h * ((int32_t)H3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) * ((int32_t)H2) + 8192) >> 14));
+				h = (h - (((((h >> 15) * (h >> 15)) >> 7) * ((int32_t)H1)) >> 4));
+				h = (h < 0 ? 0 : h);
+				h = (h > 419430400 ? 419430400 : h);
+				return (uint32_t)(h >> 12);
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		convert																	|
+		|	Purpose: 	Fills the data registers with the raw readings of the environment, by	|
+		|				a binary search through each (monotonic) compensation.					|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			static void convert(){
+				int32_t tFine = 0;
+				int32_t targetT = (int32_t)lround(environment.temperature * 100.0f);
+				int32_t low = 0, high = 0xFFFFF;
+				while(low < high){
+					int32_t mid = (low + high) / 2;
+					if(compensateT(mid, tFine) < targetT){ low = mid + 1; } else { high = mid; }
+				}
+				int32_t adcT = low;
+				compensateT(adcT, tFine);
+
+				//Pressure falls as its reading rises
+				uint32_t targetP = (uint32_t)lround(environment.pressure * 256.0f);
+				low = 0;
+				high = 0xFFFFF;
+				while(low < high){
+					int32_t mid = (low + high) / 2;
+					if(compensateP(mid, tFine) > targetP){ low = mid + 1; } else { high = mid; }
+				}
+				int32_t adcP = low;
+
+				uint32_t targetH = (uint32_t)lround(environment.humidity * 1024.0f);
+				low = 0;
+				high = 0xFFFF;
+				while(low < high){
+					int32_t mid = (low + high) / 2;
+					if(compensateH(mid, tFine) < targetH){ low = mid + 1; } else { high = mid; }
+				}
+				int32_t adcH = low;
+
+				//Readings that were skipped keep their reset value
+				uint8_t osrsP = (registers[0xF4] >> 2) & 0x07, osrsH = registers[0xF2] & 0x07;
+				if(!osrsP){ adcP = 0x80000; }
+				if(!osrsH){ adcH = 0x8000; }
+				registers[0xF7] = adcP >> 12;
+				registers[0xF8] = adcP >> 4;
+				registers[0xF9] = (adcP << 4) & 0xF0;
+				registers[0xFA] = adcT >> 12;
+				registers[0xFB] = adcT >> 4;
+				registers[0xFC] = (adcT << 4) & 0xF0;
+				registers[0xFD] = adcH >> 8;
+				registers[0xFE] = adcH;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		resetSensor																|
+		|	Purpose: 	Power on values: the chip ID, calibration, and every setting cleared.	|
+		|	Arguments:	void																	|
+		|	Returns:	void																	|
+		\*-------------------------------------------------------------------------------------*/
+			static void resetSensor(){
+				memset(registers, 0, sizeof(registers));
+				registers[0xD0] = 0x60;
+
+				const uint16_t tp[12] = { T1, (uint16_t)T2, (uint16_t)T3, P1, (uint16_t)P2, (uint16_t)P3, (uint16_t)P4, (uint16_t)P5, (uint16_t)P6, (uint16_t)P7, (uint16_t)P8, (uint16_t)P9 };
+				for(uint8_t i = 0; i != 12; i++){
+					registers[0x88 + 2 * i] = tp[i];
+					registers[0x89 + 2 * i] = tp[i] >> 8;
+				}
+				registers[0xA1] = H1;
+				registers[0xE1] = (uint8_t)H2;
+				registers[0xE2] = H2 >> 8;
+				registers[0xE3] = H3;
+				registers[0xE4] = H4 >> 4;
+				registers[0xE5] = (H4 & 0x0F) | ((H5 & 0x0F) << 4);
+				registers[0xE6] = H5 >> 4;
+				registers[0xE7] = H6;
+
+				//Skipped readings until the first conversion
+				registers[0xF7] = registers[0xFA] = 0x80;
+				registers[0xFD] = 0x80;
+				converting = false;
+				registersSet = true;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		conversionTime															|
+		|	Purpose: 	How long a forced conversion takes with the oversampling set (typical	|
+		|				figures from the datasheet's appendix B), in us.						|
+		|	Arguments:	void																	|
+		|	Returns:	uint32_t																|
+		\*-------------------------------------------------------------------------------------*/
+			static uint32_t conversionTime(){
+				uint8_t osrsT = registers[0xF4] >> 5, osrsP = (registers[0xF4] >> 2) & 0x07, osrsH = registers[0xF2] & 0x07;
+				uint32_t time = 1000;
+				if(osrsT){ time += 2000 * (1 << (min(osrsT, (uint8_t)5) - 1)); }
+				if(osrsP){ time += 2000 * (1 << (min(osrsP, (uint8_t)5) - 1)) + 500; }
+				if(osrsH){ time += 2000 * (1 << (min(osrsH, (uint8_t)5) - 1)) + 500; }
+				return time;
+			}
+
+		/*-------------------------------------------------------------------------------------*\
+		| 	Name: 		sensorWrite, sensorRead													|
+		|	Purpose: 	A write of register and value pairs (a lone register sets where reads	|
+		|				start), and a read from there. A forced conversion's results appear		|
+		|				once it ends, until then the status register shows it measuring.		|
+		\*-------------------------------------------------------------------------------------*/
+			static void sensorWrite(const uint8_t* data, uint8_t length){
+				if(!registersSet){ resetSensor(); }
+				if(length == 1){ pointer = data[0]; }
+				for(uint8_t i = 0; i + 1 < length; i += 2){
+					uint8_t reg = data[i], value = data[i + 1];
+					if(reg == 0xE0){
+						if(value == 0xB6){ resetSensor(); }
+						continue;
+					}
+					if(reg != 0xF2 && reg != 0xF4 && reg != 0xF5){ continue; }
+					registers[reg] = value;
+					if(reg == 0xF4 && (value & 0x03) == 0x01){
+						conversionEnd = HAB_Host::getMicros() + conversionTime();
+						converting = true;
+					}
+				}
+			}
+
+			static uint8_t sensorRead(uint8_t* data, uint8_t length){
+				if(!registersSet){ resetSensor(); }
+				if(converting && HAB_Host::getMicros() >= conversionEnd){
+					convert();
+					registers[0xF4] &= 0xFC; //Back to sleep
+					converting = false;
+				}
+				registers[0xF3] = (converting ? 0x08 : 0x00);
+				for(uint8_t i = 0; i != length; i++){ data[i] = registers[(uint8_t)(pointer + i)]; }
+				return length;
+			}
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	void TwoWire::beginTransmission(uint8_t address){
+		txAddress = address;
+		txLength = 0;
+	}
+
+	size_t TwoWire::write(uint8_t b){
+		if(txLength == sizeof(tx)){ return 0; }
+		tx[txLength++] = b;
+		return 1;
+	}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		endTransmission															|
+	|	Purpose: 	Sends the bytes written, returns 0 if acknowledged, 2 if no device		|
+	|				answered the address.													|
+	|	Arguments:	bool																	|
+	|	Returns:	uint8_t																	|
+	\*-------------------------------------------------------------------------------------*/
+		uint8_t TwoWire::endTransmission(bool stop){
+			hostSpan span("I2C write", "i2c");
+			HAB_Host::spend((1 + txLength) * HOST_I2C_BYTE_US);
+			if(txAddress != 0x77 || !sensorPresent){ return 2; }
+			sensorWrite(tx, txLength);
+			return 0;
+		}
+
+	uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity){
+		rxLength = rxPos = 0;
+		quantity = min(quantity, (uint8_t)sizeof(rx));
+		hostSpan span("I2C read", "i2c");
+		HAB_Host::spend((1 + quantity) * HOST_I2C_BYTE_US);
+		if(address != 0x77 || !sensorPresent){ return 0; }
+		rxLength = sensorRead(rx, quantity);
+		return rxLength;
+	}
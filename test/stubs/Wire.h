@@ -0,0 +1,52 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for the Wire library, with a BME280 on the bus at 0x77. The
+*				sensor's readings come from HAB_Host::getEnvironment(), encoded with the
+*				datasheet's example calibration.
+*/
+
+
+#ifndef Wire_h
+#define Wire_h
+
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include "Arduino.h"
+
+
+//--------------------------------------------------------------------------\
+//								    Classes					   				|
+//--------------------------------------------------------------------------/
+
+
+	class TwoWire : public Stream {
+		public:
+			void begin(){}
+			void setClock(uint32_t clock){}
+			void beginTransmission(uint8_t address);
+			void beginTransmission(int address){ beginTransmission((uint8_t)address); }
+			uint8_t endTransmission(bool stop = true);
+			uint8_t requestFrom(uint8_t address, uint8_t quantity);
+			uint8_t requestFrom(int address, int quantity){ return requestFrom((uint8_t)address, (uint8_t)quantity); }
+			size_t write(uint8_t b);
+			using Print::write;
+			int available(){ return rxLength - rxPos; }
+			int read(){ return (rxPos < rxLength ? rx[rxPos++] : -1); }
+			int peek(){ return (rxPos < rxLength ? rx[rxPos] : -1); }
+
+		private:
+			uint8_t txAddress = 0;
+			uint8_t tx[32];
+			uint8_t txLength = 0;
+			uint8_t rx[32];
+			uint8_t rxLength = 0, rxPos = 0;
+	};
+
+	extern TwoWire Wire;
+
+#endif
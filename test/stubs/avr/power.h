@@ -0,0 +1,24 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for avr/power.h. Gating a module's clock in PRR0 resets its
+*				registers here, as a module can't be relied on to keep them, so code that gates
+*				one has to set it up again.
+*/
+
+
+#ifndef HOST_AVR_POWER_H
+#define HOST_AVR_POWER_H
+
+	#include "Arduino.h"
+
+	inline void power_adc_disable(){ PRR0 |= _BV(PRADC); }
+	inline void power_adc_enable(){ PRR0 &= ~_BV(PRADC); }
+	inline void power_spi_disable(){ PRR0 |= _BV(PRSPI); }
+	inline void power_spi_enable(){
+		PRR0 &= ~_BV(PRSPI);
+		SPCR = 0;
+		SPSR = 0;
+	}
+
+#endif
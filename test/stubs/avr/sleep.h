@@ -0,0 +1,21 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for avr/sleep.h, sleep_cpu() waits for timer 0's next interrupt.
+*/
+
+
+#ifndef HOST_AVR_SLEEP_H
+#define HOST_AVR_SLEEP_H
+
+	#include "Arduino.h"
+
+	#define SLEEP_MODE_IDLE 0
+	#define SLEEP_MODE_PWR_DOWN 2
+
+	inline void set_sleep_mode(uint8_t mode){}
+	inline void sleep_enable(){}
+	inline void sleep_disable(){}
+	inline void sleep_cpu(){ HAB_Host::sleepTick(); }
+
+#endif
@@ -0,0 +1,21 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A host stand-in for util/crc16.h, the same CRC-16 (polynomial 0xA001) as avr-libc.
+*/
+
+
+#ifndef HOST_UTIL_CRC16_H
+#define HOST_UTIL_CRC16_H
+
+	#include <stdint.h>
+
+	inline uint16_t _crc16_update(uint16_t crc, uint8_t a){
+		crc ^= a;
+		for(uint8_t i = 0; i < 8; ++i){
+			crc = (crc & 1 ? (crc >> 1) ^ 0xA001 : crc >> 1);
+		}
+		return crc;
+	}
+
+#endif
@@ -0,0 +1,266 @@
+/*
+*	Author	:	Western University HAB team
+*	Date	:	Oct 19, 2026
+*	Purpose	: 	A flight of the four pods' heaters on the simulated clock: HAB_Actuator::updateHeating
+*				(the fitted model, pre-heating for each interval) against the bang-bang it replaced
+*				(on at or below MIN_ACTUATOR_TEMP, off above MAX_ACTUATOR_TEMP, on every pod all
+*				flight). Each pod is a first order thermal body with its own true time constant and
+*				heater rise, none of them the model's starting guess, read back through its
+*				thermistor and heated through its heater pin. The balloon climbs at 5 m/s to 34 km
+*				through the standard atmosphere, with the sketch's pods and intervals, and holds
+*				there for the last pod's. It is flown with the heaters as sized, then with heaters
+*				too weak to reach the target high up. Exits 1 if the model controller does not hold
+*				the band through the intervals it can reach, or uses more energy than bang-bang.
+*
+*				thermal_sim
+*/
+
+//--------------------------------------------------------------------------\
+//								    Imports					   				|
+//--------------------------------------------------------------------------/
+
+
+	#include <HAB_Actuator.h>
+	#include <HAB_Power.h>
+	#include <HAB_Definitions.h>
+	#include <math.h>
+
+
+//--------------------------------------------------------------------------\
+//								  Definitions					   			|
+//--------------------------------------------------------------------------/
+
+
+	#define SIM_LOOP_MS 100 //The sketch's loop, about
+	#define SIM_PHYSICS_US 100000 //Step of the pods' thermal model
+	#define SIM_LAUNCH_ALT 250 //m
+	#define SIM_CEILING 34000 //m
+	#define SIM_CLIMB 5 //m/s
+	#define SIM_HOLD 2400 //s at the ceiling
+
+	//What each pod really is, and where it is wired (the sketch's pins)
+	struct simPod {
+		const char* name;
+		uint8_t enable, push, pull, position, heater, thermistor;
+		float openAlt, closeAlt; //m
+		float tau; //s to settle to the ambient
+		float rise; //C above the ambient the heater alone holds it
+
+		//State through a flight
+		float temperature;
+		bool heating;
+		uint32_t onTicks, switches;
+		float arrival; //Temperature as its interval arrived
+		uint32_t intervalTicks, inBandTicks, coldTicks;
+		float worst; //Furthest below the band within its interval
+	};
+
+	//What a controller got through a flight
+	struct simResult {
+		float energy; //J
+		uint32_t switches;
+		bool held; //Every pod kept from below the band for SIM_IN_BAND of its interval, when it can be
+	};
+
+	#define SIM_IN_BAND 0.95
+	#define SIM_POD_COUNT 4
+
+
+//--------------------------------------------------------------------------\
+//                                 Variables                                |
+//--------------------------------------------------------------------------/
+
+
+	static simPod pods[SIM_POD_COUNT] = {
+		{ "POD_1", 23, 24, 25, A9, 22, A8, 2000, 10000, 1500, 45 },
+		{ "POD_2", 27, 28, 29, A11, 26, A10, 12000, 20000, 2400, 70 },
+		{ "POD_3", 31, 32, 33, A13, 30, A12, 22000, 30000, 1200, 60 },
+		{ "POD_4", 35, 36, 37, A15, 34, A14, 32000, 999999, 3000, 80 }
+	};
+
+	static HAB_Actuator actuators[SIM_POD_COUNT] = {
+		HAB_Actuator("POD_1", 23, 24, 25, A9, 22, A8, fromMetres(2000), fromMetres(10000)),
+		HAB_Actuator("POD_2", 27, 28, 29, A11, 26, A10, fromMetres(12000), fromMetres(20000)),
+		HAB_Actuator("POD_3", 31, 32, 33, A13, 30, A12, fromMetres(22000), fromMetres(30000)),
+		HAB_Actuator("POD_4", 35, 36, 37, A15, 34, A14, fromMetres(32000), fromMetres(999999))
+	};
+
+	static float altitude; //m
+	static float ambient; //C
+	static float riseScale; //The heaters' strength, as sized or weakened
+
+
+//--------------------------------------------------------------------------\
+//								   Functions					   			|
+//--------------------------------------------------------------------------/
+
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		standardAtmosphere														|
+	|	Purpose: 	The air temperature at an altitude, up to 47 km (C).					|
+	|	Arguments:	float (m)																|
+	|	Returns:	float																	|
+	\*-------------------------------------------------------------------------------------*/
+		static float standardAtmosphere(float metres){
+			if(metres < 11000){ return 15 - 6.5 * metres / 1000; }
+			if(metres < 20000){ return -56.5; }
+			if(metres < 32000){ return -56.5 + (metres - 20000) / 1000; }
+			return -44.5 + 2.8 * (metres - 32000) / 1000;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		thermistorReading														|
+	|	Purpose: 	The board model's ADC: the divider reading of a pod's thermistor,		|
+	|				the B equation the actuator inverts.									|
+	|	Arguments:	uint8_t (pin)															|
+	|	Returns:	int																		|
+	\*-------------------------------------------------------------------------------------*/
+		static int thermistorReading(uint8_t pin){
+			for(uint8_t i = 0; i != SIM_POD_COUNT; i++){
+				if(pods[i].thermistor != pin){ continue; }
+				float kelvin = pods[i].temperature + 273.15;
+				float resistance = THERMISTORNOMINAL * exp(BCOEFFICIENT * (1 / kelvin - 1 / (TEMPERATURENOMINAL + 273.15)));
+				return (int)lround(1023 * resistance / (resistance + SERIESRESISTOR));
+			}
+			return 0;
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		physicsTick																|
+	|	Purpose: 	Moves each pod's temperature on a step, heated while its heater pin		|
+	|				is high, and keeps the figures of how it went.							|
+	|	Arguments:	void																	|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void physicsTick(){
+			float step = SIM_PHYSICS_US / 1e6;
+			for(uint8_t i = 0; i != SIM_POD_COUNT; i++){
+				simPod& pod = pods[i];
+				bool heating = HAB_Host::getPin(pod.heater);
+				if(heating != pod.heating){ pod.switches++; }
+				pod.heating = heating;
+				if(heating){ pod.onTicks++; }
+				pod.temperature += step / pod.tau * (ambient - pod.temperature + (heating ? pod.rise * riseScale : 0));
+
+				if(altitude >= pod.openAlt && altitude < pod.closeAlt){
+					if(pod.intervalTicks == 0){ pod.arrival = pod.temperature; }
+					pod.intervalTicks++;
+					if(pod.temperature >= MIN_ACTUATOR_TEMP && pod.temperature <= MAX_ACTUATOR_TEMP){ pod.inBandTicks++; }
+					if(pod.temperature < MIN_ACTUATOR_TEMP){
+						pod.coldTicks++;
+						pod.worst = fmax(pod.worst, MIN_ACTUATOR_TEMP - pod.temperature);
+					}
+				}
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		bangBang																|
+	|	Purpose: 	The heating handleActuator did before the thermal model.				|
+	|	Arguments:	HAB_Actuator&															|
+	|	Returns:	void																	|
+	\*-------------------------------------------------------------------------------------*/
+		static void bangBang(HAB_Actuator& actuator){
+			if(actuator.getTemperature() <= fromCelsius(MIN_ACTUATOR_TEMP) && !actuator.isHeatEnabled()){
+				actuator.startHeating();
+			}
+			else if(actuator.getTemperature() > fromCelsius(MAX_ACTUATOR_TEMP) && actuator.isHeatEnabled()){
+				actuator.stopHeating();
+			}
+		}
+
+	/*-------------------------------------------------------------------------------------*\
+	| 	Name: 		fly																		|
+	|	Purpose: 	One flight with a controller, from the pad with the pods at the			|
+	|				ambient. The actuators are reused, so their heaters and models are		|
+	|				started over first. Prints each pod and the totals.						|
+	|	Arguments:	const char*, bool (the model controller)								|
+	|	Returns:	simResult																|
+	\*-------------------------------------------------------------------------------------*/
+		static simResult fly(const char* controller, bool model){
+			altitude = SIM_LAUNCH_ALT;
+			ambient = standardAtmosphere(altitude);
+			for(uint8_t i = 0; i != SIM_POD_COUNT; i++){
+				simPod& pod = pods[i];
+				pod.temperature = ambient;
+				pod.heating = false;
+				pod.onTicks = pod.switches = pod.intervalTicks = pod.inBandTicks = pod.coldTicks = 0;
+				pod.arrival = pod.worst = 0;
+
+				//An override ends the heater's step, so the first is not fitted across flights
+				actuators[i].overrideHeaterDisable();
+				actuators[i].overrideHeaterRelease();
+				actuators[i].stopHeating();
+				actuators[i].getThermal()->reset();
+			}
+
+			//A charged battery each flight, else the budget is halved and the heaters take turns
+			HAB_Power::setStateOfCharge(100);
+			unsigned long start = millis();
+			CentiCelsius target = CentiCelsius((fromCelsius(MIN_ACTUATOR_TEMP).value() + fromCelsius(MAX_ACTUATOR_TEMP).value()) / 2);
+			CentimetresPerSecond climbRate = CentimetresPerSecond(SIM_CLIMB * 100);
+			float flightTime = (SIM_CEILING - SIM_LAUNCH_ALT) / (float)SIM_CLIMB + SIM_HOLD;
+			while((millis() - start) / 1000.0 < flightTime){
+				altitude = fmin(SIM_LAUNCH_ALT + SIM_CLIMB * (millis() - start) / 1000.0, SIM_CEILING);
+				ambient = standardAtmosphere(altitude);
+				if(altitude >= SIM_CEILING){ climbRate = CentimetresPerSecond(0); }
+
+				HAB_Power::update();
+				for(uint8_t i = 0; i != SIM_POD_COUNT; i++){
+					if(model){
+						actuators[i].updateHeating(actuators[i].getTemperature(), fromCelsius(ambient), true, fromMetres(altitude), climbRate, target);
+					}
+					else{ bangBang(actuators[i]); }
+				}
+				delay(SIM_LOOP_MS);
+			}
+
+			simResult result = { 0, 0, true };
+			printf("%s, heaters at %.0f%%\n", controller, riseScale * 100);
+			printf("  %-6s %7s %7s %9s %9s %8s %9s %9s %9s\n", "pod", "tau s", "rise C", "energy J", "switches", "arrival", "in band", "below", "worst C");
+			for(uint8_t i = 0; i != SIM_POD_COUNT; i++){
+				simPod& pod = pods[i];
+				float energy = pod.onTicks * (SIM_PHYSICS_US / 1e6) * HEATER_POWER;
+				float inBand = (pod.intervalTicks ? (float)pod.inBandTicks / pod.intervalTicks : 1);
+				float cold = (pod.intervalTicks ? (float)pod.coldTicks / pod.intervalTicks : 0);
+				printf("  %-6s %7.0f %7.0f %9.0f %9u %8.2f %8.1f%% %8.1f%% %9.2f\n", pod.name, pod.tau, pod.rise * riseScale, energy,
+					pod.switches, pod.arrival, inBand * 100, cold * 100, pod.worst);
+				result.energy += energy;
+				result.switches += pod.switches;
+
+				//Only where the heater can hold the band against the coldest air of the interval. Above the band low
+				//down is the air's doing, the heater is off.
+				float coldest = fmin(standardAtmosphere(pod.openAlt), standardAtmosphere(fmin(pod.closeAlt, SIM_CEILING)));
+				if(coldest + pod.rise * riseScale > MIN_ACTUATOR_TEMP && 1 - cold < SIM_IN_BAND){ result.held = false; }
+			}
+			printf("  total  %25.0f %9u\n\n", result.energy, result.switches);
+			return result;
+		}
+
+
+	int main(int argc, char** argv){
+		HAB_Host::setAnalogHook(thermistorReading);
+		HAB_Host::addTicker(physicsTick, SIM_PHYSICS_US);
+		bool failed = false;
+
+		//As sized, then too weak to hold the target above the tropopause
+		const float strengths[] = { 1, 0.6 };
+		for(float strength : strengths){
+			riseScale = strength;
+			simResult bang = fly("Bang-bang", false);
+			simResult fitted = fly("Thermal model", true);
+			printf("Heaters at %.0f%%: the model used %.0f J against %.0f J (%.0f%% less), %u switches against %u\n\n",
+				strength * 100, fitted.energy, bang.energy, 100 * (1 - fitted.energy / bang.energy), fitted.switches, bang.switches);
+
+			if(!fitted.held){
+				printf("FAILED: the model did not hold the band through an interval it can reach\n");
+				failed = true;
+			}
+			if(fitted.energy >= bang.energy){
+				printf("FAILED: the model used more energy than bang-bang\n");
+				failed = true;
+			}
+		}
+
+		return (failed ? 1 : 0);
+	}
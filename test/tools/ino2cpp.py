@@ -0,0 +1,154 @@
+#--------------------------------------------------------------------------------------------------------------------------------------------
+#    Name          : ino2cpp.py
+#    Author        : Western University HAB team
+#    Date          : Oct. 19, 2026
+#    Purpose  	   : Turns a sketch into C++ the way the Arduino builder does, so the host build compiles the same code the
+#                    board runs: Arduino.h is included first, and a prototype of every function is added before the first
+#                    one defined (without default arguments, and without those the sketch already declares). #line
+#                    directives keep compiler errors and debuggers pointing at the sketch.
+#
+#                    python3 ino2cpp.py <sketch.ino> <output.cpp>
+#--------------------------------------------------------------------------------------------------------------------------------------------
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                    Imports                                                |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+import os
+import re
+import sys
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Variables                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+#A definition's head that is not a function's
+not_functions = re.compile(r"^\s*(struct|class|enum|union|namespace|typedef|extern)\b|=")
+signature = re.compile(r"^(?P<type>[\w:<>,\*&\s]+?[\s\*&]+)(?P<name>[A-Za-z_]\w*)\s*\((?P<arguments>[^()]*)\)\s*(const)?\s*$", re.S)
+
+
+#-----------------------------------------------------------------------------------------------------------\
+#                                                   Functions                                               |
+#-----------------------------------------------------------------------------------------------------------/
+
+
+def blankCode(text):
+    #The sketch with comments, strings, characters and preprocessor lines blanked (newlines kept), so braces and
+    #semicolons can be counted
+    out = list(text)
+    i = 0
+    lineStart = True
+    while(i < len(text)):
+        c = text[i]
+        if(lineStart and c == "#" or text.startswith("//", i)):
+            end = text.find("\n", i)
+            end = (len(text) if end < 0 else end)
+            #A preprocessor line carries on past a backslash
+            while(c == "#" and text[i:end].rstrip().endswith("\\") and end < len(text)):
+                next = text.find("\n", end + 1)
+                end = (len(text) if next < 0 else next)
+            for j in range(i, end):
+                if(out[j] != "\n"): out[j] = " "
+            i = end
+            continue
+        if(text.startswith("/*", i)):
+            end = text.find("*/", i + 2)
+            end = (len(text) if end < 0 else end + 2)
+            for j in range(i, end):
+                if(out[j] != "\n"): out[j] = " "
+            i = end
+            continue
+        if(c == '"' or c == "'"):
+            j = i + 1
+            while(j < len(text) and text[j] != c):
+                j += (2 if text[j] == "\\" else 1)
+            for k in range(i, min(j + 1, len(text))):
+                if(out[k] != "\n"): out[k] = " "
+            i = j + 1
+            lineStart = False
+            continue
+        if(c == "\n"):
+            lineStart = True
+        elif(not c.isspace()):
+            lineStart = False
+        i += 1
+    return "".join(out)
+
+def stripDefaults(arguments):
+    #Each argument without its "= value", split at the commas outside brackets
+    parts = []
+    depth = 0
+    current = ""
+    for c in arguments:
+        if(c in "(<[{"): depth += 1
+        if(c in ")>]}"): depth -= 1
+        if(c == "," and depth == 0):
+            parts.append(current)
+            current = ""
+        else:
+            current += c
+    parts.append(current)
+    return ", ".join(part.split("=")[0].strip() for part in parts if part.strip())
+
+def findFunctions(code):
+    #(offset of the head, name, prototype) of each function defined outside any braces, and the names declared
+    functions = []
+    declared = set()
+    depth = 0
+    statementStart = 0
+    for i, c in enumerate(code):
+        if(c == "{"):
+            if(depth == 0):
+                head = code[statementStart:i]
+                match = signature.match(head.strip())
+                if(match and not not_functions.search(head) and match.group("name") not in ("if", "while", "for", "switch")):
+                    prototype = " ".join((match.group("type") + match.group("name")).split())
+                    prototype += "(" + " ".join(stripDefaults(match.group("arguments")).split()) + ")"
+                    functions.append((statementStart + len(head) - len(head.lstrip()), match.group("name"), prototype))
+            depth += 1
+        elif(c == "}"):
+            depth -= 1
+            if(depth == 0):
+                statementStart = i + 1
+        elif(c == ";" and depth == 0):
+            match = signature.match(code[statementStart:i].strip())
+            if(match and not not_functions.search(code[statementStart:i])):
+                declared.add(match.group("name"))
+            statementStart = i + 1
+    return functions, declared
+
+def convert(sketchName, outputName):
+    with open(sketchName) as sketchFile:
+        text = sketchFile.read()
+    functions, declared = findFunctions(blankCode(text))
+    if(not functions):
+        raise SystemExit(sketchName + " defines no functions")
+
+    #Prototypes go before the first definition, after everything the sketch declares ahead of it
+    first = functions[0][0]
+    first = text.rfind("\n", 0, first) + 1
+    firstLine = text.count("\n", 0, first) + 1
+    path = os.path.abspath(sketchName).replace("\\", "/")
+
+    out = ["#include <Arduino.h>\n", '#line 1 "' + path + '"\n', text[:first]]
+    for offset, name, prototype in functions:
+        if(name not in declared):
+            out.append("#line " + str(text.count("\n", 0, offset) + 1) + ' "' + path + '"\n')
+            out.append(prototype + ";\n")
+            declared.add(name)
+    out.append("#line " + str(firstLine) + ' "' + path + '"\n')
+    out.append(text[first:])
+
+    with open(outputName + ".tmp", "w") as outputFile:
+        outputFile.write("".join(out))
+    os.replace(outputName + ".tmp", outputName)
+
+
+if __name__ == "__main__":
+    if(len(sys.argv) != 3):
+        raise SystemExit("Usage: ino2cpp.py <sketch.ino> <output.cpp>")
+    convert(sys.argv[1], sys.argv[2])